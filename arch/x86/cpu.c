@@ -57,6 +57,11 @@ static int proc_cpuinfo_match(char *tok)
 
 int cpu_init(void)
 {
+	static bool done;
+
+	if (done)
+		return 0;
+
 	if (parse_cpuinfo_features(proc_cpuinfo_match))
 		return -1;
 
@@ -79,5 +84,6 @@ int cpu_init(void)
 		 !!cpu_has(X86_FEATURE_FXSR),
 		 !!cpu_has(X86_FEATURE_XSAVE));
 
+	done = true;
 	return 0;
 }
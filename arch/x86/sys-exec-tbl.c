@@ -0,0 +1,89 @@
+/* Autogenerated, don't edit */
+SYSCALL( read , 0 )
+SYSCALL( write , 1 )
+SYSCALL( open , 2 )
+SYSCALL( close , 3 )
+SYSCALL( lseek , 8 )
+SYSCALL( mmap , 9 )
+SYSCALL( mprotect , 10 )
+SYSCALL( munmap , 11 )
+SYSCALL( brk , 12 )
+SYSCALL( sigaction , 13 )
+SYSCALL( sigprocmask , 14 )
+SYSCALL( rt_sigreturn , 15 )
+SYSCALL( ioctl , 16 )
+SYSCALL( pread , 17 )
+SYSCALL( mremap , 25 )
+SYSCALL( mincore , 27 )
+SYSCALL( madvise , 28 )
+SYSCALL( shmat , 30 )
+SYSCALL( pause , 34 )
+SYSCALL( nanosleep , 35 )
+SYSCALL( getitimer , 36 )
+SYSCALL( setitimer , 38 )
+SYSCALL( getpid , 39 )
+SYSCALL( socket , 41 )
+SYSCALL( connect , 42 )
+SYSCALL( sendto , 44 )
+SYSCALL( recvfrom , 45 )
+SYSCALL( sendmsg , 46 )
+SYSCALL( recvmsg , 47 )
+SYSCALL( shutdown , 48 )
+SYSCALL( bind , 49 )
+SYSCALL( setsockopt , 54 )
+SYSCALL( getsockopt , 55 )
+SYSCALL( clone , 56 )
+SYSCALL( exit , 60 )
+SYSCALL( waitpid , 61 )
+SYSCALL( kill , 62 )
+SYSCALL( fcntl , 72 )
+SYSCALL( flock , 73 )
+SYSCALL( mkdir , 83 )
+SYSCALL( rmdir , 84 )
+SYSCALL( unlink , 87 )
+SYSCALL( readlink , 89 )
+SYSCALL( umask , 95 )
+SYSCALL( getgroups , 115 )
+SYSCALL( setresuid , 117 )
+SYSCALL( setresgid , 119 )
+SYSCALL( getpgid , 121 )
+SYSCALL( setfsuid , 122 )
+SYSCALL( setfsgid , 123 )
+SYSCALL( getsid , 124 )
+SYSCALL( capset , 126 )
+SYSCALL( rt_sigqueueinfo , 129 )
+SYSCALL( sigaltstack , 131 )
+SYSCALL( personality , 135 )
+SYSCALL( setpriority , 141 )
+SYSCALL( sched_setscheduler , 144 )
+SYSCALL( prctl , 157 )
+SYSCALL( arch_prctl , 158 )
+SYSCALL( setrlimit , 160 )
+SYSCALL( mount , 165 )
+SYSCALL( umount2 , 166 )
+SYSCALL( gettid , 186 )
+SYSCALL( futex , 202 )
+SYSCALL( set_thread_area , 205 )
+SYSCALL( get_thread_area , 211 )
+SYSCALL( set_tid_address , 218 )
+SYSCALL( restart_syscall , 219 )
+SYSCALL( timer_create , 222 )
+SYSCALL( timer_settime , 223 )
+SYSCALL( timer_gettime , 224 )
+SYSCALL( timer_getoverrun , 225 )
+SYSCALL( timer_delete , 226 )
+SYSCALL( exit_group , 231 )
+SYSCALL( set_robust_list , 273 )
+SYSCALL( get_robust_list , 274 )
+SYSCALL( vmsplice , 278 )
+SYSCALL( signalfd , 289 )
+SYSCALL( rt_tgsigqueueinfo , 297 )
+SYSCALL( fanotify_init , 300 )
+SYSCALL( fanotify_mark , 301 )
+SYSCALL( prlimit64 , 302 )
+SYSCALL( open_by_handle_at , 304 )
+SYSCALL( setns , 308 )
+SYSCALL( kcmp , 312 )
+SYSCALL( memfd_create , 319 )
+SYSCALL( userfaultfd , 323 )
+SYSCALL( clone3 , 435 )
@@ -70,9 +70,13 @@ static int vdso_fill_self_symtable(struct vdso_symtable *s)
 
 int vdso_init(void)
 {
+	static bool done;
 	int ret = -1, fd;
 	off_t off;
 
+	if (done)
+		return 0;
+
 	if (vdso_fill_self_symtable(&vdso_sym_rt))
 		return -1;
 
@@ -92,6 +96,7 @@ int vdso_init(void)
 		ret = -1;
 	} else {
 		vdso_pfn = PME_PFRAME(vdso_pfn);
+		done = true;
 		ret = 0;
 	}
 out:
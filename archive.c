@@ -0,0 +1,662 @@
+#include <unistd.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/sendfile.h>
+
+#include "crtools.h"
+#include "cr_options.h"
+#include "servicefd.h"
+#include "image.h"
+#include "magic.h"
+#include "syscall.h"
+#include "util.h"
+#include "list.h"
+#include "archive.h"
+
+#undef	LOG_PREFIX
+#define LOG_PREFIX "archive: "
+
+/*
+ * Memfds with images being dumped are named by this prefix and
+ * the image number, so that archive_sync can find who uses them.
+ */
+#define ARCHIVE_DUMP_MEMFD	"criu-img-"
+#define ARCHIVE_RST_MEMFD	"criu-rst-img"
+
+#define ARCHIVE_HASH_SIZE	1024
+
+struct archive_img {
+	char		*name;
+	u64		off;
+	u64		len;
+	int		fd;		/* memfd while not in archive yet */
+	int		next;		/* in hash chain */
+};
+
+struct archive {
+	struct list_head	l;
+	dev_t			dev;
+	ino_t			ino;
+	bool			sfd;	/* the fd is IMG_ARCHIVE_FD_OFF */
+
+	int			fd;	/* archive being written */
+	u64			end;	/* where next image goes */
+
+	unsigned int		nr;
+	unsigned int		alloc;
+	struct archive_img	*imgs;
+	char			*index;	/* names of images read */
+	int			hash[ARCHIVE_HASH_SIZE];
+};
+
+static struct archive *dump_arch;
+static LIST_HEAD(archives);
+
+static bool archived_type(int type)
+{
+	switch (type) {
+	case CR_FD_STATS:	/* is read by others right after dump */
+	case CR_FD_PAGES:	/* are big, spliced and mapped */
+	case CR_FD_PAGES_OLD:
+	case CR_FD_SHM_PAGES_OLD:
+	case CR_FD_GHOST_FILE:	/* is files' contents */
+		return false;
+	}
+
+	/* Tarballs and ip tools output are fed into external tools */
+	return fdset_template[type].magic != RAW_IMAGE_MAGIC;
+}
+
+static struct archive *archive_alloc(void)
+{
+	struct archive *a;
+	int i;
+
+	a = xzalloc(sizeof(*a));
+	if (!a)
+		return NULL;
+
+	a->fd = -1;
+	for (i = 0; i < ARCHIVE_HASH_SIZE; i++)
+		a->hash[i] = -1;
+
+	return a;
+}
+
+static void archive_free(struct archive *a)
+{
+	unsigned int i;
+
+	for (i = 0; i < a->nr; i++) {
+		if (a->imgs[i].fd >= 0)
+			close(a->imgs[i].fd);
+		if (!a->index)
+			xfree(a->imgs[i].name);
+	}
+
+	if (a->fd >= 0)
+		close(a->fd);
+
+	xfree(a->imgs);
+	xfree(a->index);
+	xfree(a);
+}
+
+static unsigned int archive_hash(const char *name)
+{
+	unsigned int h = 5381;
+
+	while (*name)
+		h = h * 33 + *name++;
+
+	return h % ARCHIVE_HASH_SIZE;
+}
+
+static struct archive_img *archive_find(struct archive *a, const char *name)
+{
+	int i;
+
+	for (i = a->hash[archive_hash(name)]; i >= 0; i = a->imgs[i].next)
+		if (!strcmp(a->imgs[i].name, name))
+			return &a->imgs[i];
+
+	return NULL;
+}
+
+static struct archive_img *archive_add(struct archive *a, char *name)
+{
+	struct archive_img *img;
+	unsigned int h;
+
+	if (a->nr == a->alloc) {
+		unsigned int alloc = a->alloc ? a->alloc * 2 : 64;
+
+		if (xrealloc_safe(&a->imgs, alloc * sizeof(*a->imgs)))
+			return NULL;
+		a->alloc = alloc;
+	}
+
+	h = archive_hash(name);
+	img = &a->imgs[a->nr];
+	img->name = name;
+	img->off = 0;
+	img->len = 0;
+	img->fd = -1;
+	img->next = a->hash[h];
+	a->hash[h] = a->nr++;
+
+	return img;
+}
+
+static int archive_memfd(const char *name)
+{
+	int fd;
+
+	fd = sys_memfd_create(name, 0);
+	if (fd < 0) {
+		pr_err("Can't create memfd for image: %d\n", fd);
+		return -1;
+	}
+
+	return fd;
+}
+
+static int copy_range(int out, int in, off_t off, u64 len)
+{
+	while (len) {
+		ssize_t ret;
+
+		ret = sendfile(out, in, &off, len);
+		if (ret <= 0) {
+			pr_perror("Can't copy image (%"PRIu64" left)", len);
+			return -1;
+		}
+
+		len -= ret;
+	}
+
+	return 0;
+}
+
+/*
+ * Dump side
+ */
+
+static void archive_forget(int dfd)
+{
+	struct archive *a, *t;
+	struct stat st;
+
+	if (fstat(dfd, &st))
+		return;
+
+	list_for_each_entry_safe(a, t, &archives, l) {
+		if (a->dev != st.st_dev || a->ino != st.st_ino)
+			continue;
+
+		if (a->sfd)
+			close_service_fd(IMG_ARCHIVE_FD_OFF);
+		list_del(&a->l);
+		archive_free(a);
+	}
+}
+
+/*
+ * Called when dump starts writing images. An archive left in
+ * the images dir by previous dump is removed not to shadow the
+ * new images, and a new one is created if asked for.
+ */
+int archive_start(void)
+{
+	int dfd = get_service_fd(IMG_FD_OFF);
+	u32 magic = ARCHIVE_MAGIC;
+	struct archive *a;
+
+	archive_forget(dfd);
+
+	if (unlinkat(dfd, CR_ARCHIVE_NAME, 0) && errno != ENOENT) {
+		pr_perror("Can't remove old archive");
+		return -1;
+	}
+
+	if (!opts.archive)
+		return 0;
+
+	a = archive_alloc();
+	if (!a)
+		return -1;
+
+	a->fd = openat(dfd, CR_ARCHIVE_NAME, O_DUMP, CR_FD_PERM);
+	if (a->fd < 0) {
+		pr_perror("Can't create archive");
+		goto err;
+	}
+
+	if (write_img(a->fd, &magic))
+		goto err;
+
+	a->end = sizeof(magic);
+	dump_arch = a;
+	return 0;
+
+err:
+	archive_free(a);
+	return -1;
+}
+
+static int archive_dump_image(const char *path)
+{
+	struct archive_img *img;
+	char name[32];
+	int fd;
+
+	img = archive_find(dump_arch, path);
+	if (!img) {
+		char *n;
+
+		n = xstrdup(path);
+		if (!n)
+			return -1;
+
+		img = archive_add(dump_arch, n);
+		if (!img) {
+			xfree(n);
+			return -1;
+		}
+	} else if (img->fd >= 0) {
+		/* Re-created, the old contents is dropped */
+		close(img->fd);
+		img->fd = -1;
+	}
+
+	snprintf(name, sizeof(name), ARCHIVE_DUMP_MEMFD "%ld", (long)(img - dump_arch->imgs));
+	img->fd = archive_memfd(name);
+	if (img->fd < 0)
+		return -1;
+
+	fd = dup(img->fd);
+	if (fd < 0)
+		pr_perror("Can't dup image memfd");
+
+	return fd;
+}
+
+static int archive_put(struct archive *a, struct archive_img *img)
+{
+	off_t len;
+
+	len = lseek(img->fd, 0, SEEK_END);
+	if (len < 0) {
+		pr_perror("Can't get %s size", img->name);
+		return -1;
+	}
+
+	if (copy_range(a->fd, img->fd, 0, len))
+		return -1;
+
+	pr_debug("Put %s at %"PRIu64":%lu\n", img->name, a->end, (unsigned long)len);
+
+	img->off = a->end;
+	img->len = len;
+	a->end += len;
+
+	close(img->fd);
+	img->fd = -1;
+
+	return 0;
+}
+
+/*
+ * Moves images nobody has open any longer into the archive, so
+ * that the number of memfds doesn't grow with the number of tasks.
+ */
+int archive_sync(void)
+{
+	unsigned int *users, i, idx;
+	struct dirent *de;
+	DIR *d;
+	int ret = 0;
+
+	if (!dump_arch || !dump_arch->nr)
+		return 0;
+
+	users = xzalloc(dump_arch->nr * sizeof(*users));
+	if (!users)
+		return -1;
+
+	d = opendir("/proc/self/fd");
+	if (!d) {
+		pr_perror("Can't open self fds");
+		xfree(users);
+		return -1;
+	}
+
+	while ((de = readdir(d))) {
+		char link[64];
+		ssize_t len;
+
+		if (de->d_name[0] == '.')
+			continue;
+
+		len = readlinkat(dirfd(d), de->d_name, link, sizeof(link) - 1);
+		if (len < 0)
+			continue;
+		link[len] = '\0';
+
+		if (sscanf(link, "/memfd:" ARCHIVE_DUMP_MEMFD "%u", &idx) == 1 &&
+				idx < dump_arch->nr)
+			users[idx]++;
+	}
+
+	closedir(d);
+
+	for (i = 0; i < dump_arch->nr; i++) {
+		struct archive_img *img = &dump_arch->imgs[i];
+
+		/* Only our own fd is left */
+		if (img->fd >= 0 && users[i] == 1 && archive_put(dump_arch, img)) {
+			ret = -1;
+			break;
+		}
+	}
+
+	xfree(users);
+	return ret;
+}
+
+static int archive_write_index(struct archive *a)
+{
+	struct archive_tail tail;
+	unsigned int i;
+
+	if (img_buf_attach(a->fd, O_DUMP))
+		return -1;
+
+	for (i = 0; i < a->nr; i++) {
+		struct archive_img *img = &a->imgs[i];
+		struct archive_entry e;
+
+		e.off = img->off;
+		e.len = img->len;
+		e.name_len = strlen(img->name) + 1;
+
+		if (img_buf_write(a->fd, &e, sizeof(e)) != sizeof(e) ||
+		    img_buf_write(a->fd, img->name, e.name_len) != e.name_len) {
+			pr_perror("Can't write archive index");
+			return -1;
+		}
+	}
+
+	tail.index_off = a->end;
+	tail.nr_entries = a->nr;
+	tail.magic = ARCHIVE_MAGIC;
+
+	if (img_buf_write(a->fd, &tail, sizeof(tail)) != sizeof(tail)) {
+		pr_perror("Can't write archive tail");
+		return -1;
+	}
+
+	return img_buf_flush(a->fd);
+}
+
+/*
+ * Puts all the images left into the archive and writes the index,
+ * or removes the archive when dump has failed.
+ */
+int archive_close(bool ok)
+{
+	struct archive *a = dump_arch;
+	unsigned int i;
+	int ret = 0;
+
+	if (!a)
+		return 0;
+
+	dump_arch = NULL;
+
+	if (ok) {
+		for (i = 0; i < a->nr && !ret; i++)
+			if (a->imgs[i].fd >= 0)
+				ret = archive_put(a, &a->imgs[i]);
+
+		if (!ret)
+			ret = archive_write_index(a);
+
+		if (!ret)
+			pr_info("Archived %u images (%"PRIu64" bytes)\n", a->nr, a->end);
+	}
+
+	if (a->fd >= 0) {
+		close_image(a->fd);
+		a->fd = -1;
+	}
+
+	if (!ok || ret)
+		unlinkat(get_service_fd(IMG_FD_OFF), CR_ARCHIVE_NAME, 0);
+
+	archive_free(a);
+	return ret;
+}
+
+/*
+ * Restore side
+ */
+
+static int archive_read_index(struct archive *a, int fd)
+{
+	struct archive_tail tail;
+	off_t size, len;
+	unsigned int i;
+	u32 magic;
+	char *p, *end;
+
+	size = lseek(fd, 0, SEEK_END);
+	if (size < (off_t)(sizeof(magic) + sizeof(tail)))
+		goto bad;
+
+	if (pread(fd, &magic, sizeof(magic), 0) != sizeof(magic) ||
+	    pread(fd, &tail, sizeof(tail), size - sizeof(tail)) != sizeof(tail)) {
+		pr_perror("Can't read archive");
+		return -1;
+	}
+
+	if (magic != ARCHIVE_MAGIC || tail.magic != ARCHIVE_MAGIC ||
+	    tail.index_off > size - sizeof(tail))
+		goto bad;
+
+	len = size - sizeof(tail) - tail.index_off;
+	a->index = xmalloc(len);
+	if (!a->index)
+		return -1;
+
+	if (pread(fd, a->index, len, tail.index_off) != len) {
+		pr_perror("Can't read archive index");
+		return -1;
+	}
+
+	p = a->index;
+	end = a->index + len;
+	for (i = 0; i < tail.nr_entries; i++) {
+		struct archive_entry e;
+		struct archive_img *img;
+
+		if (p + sizeof(e) > end)
+			goto bad;
+		memcpy(&e, p, sizeof(e));
+		p += sizeof(e);
+
+		if (!e.name_len || p + e.name_len > end || p[e.name_len - 1] != '\0' ||
+		    e.off + e.len > tail.index_off)
+			goto bad;
+
+		img = archive_add(a, p);
+		if (!img)
+			return -1;
+
+		img->off = e.off;
+		img->len = e.len;
+		p += e.name_len;
+	}
+
+	pr_info("Read archive index of %u images\n", a->nr);
+	return 0;
+
+bad:
+	pr_err("Corrupted archive\n");
+	return -1;
+}
+
+static struct archive *archive_read(int dfd, struct stat *st, bool sfd)
+{
+	struct archive *a;
+	int fd;
+
+	a = archive_alloc();
+	if (!a)
+		return NULL;
+
+	a->dev = st->st_dev;
+	a->ino = st->st_ino;
+
+	fd = openat(dfd, CR_ARCHIVE_NAME, O_RDONLY);
+	if (fd < 0) {
+		/* Remember there's none, not to look for it again */
+		if (errno == ENOENT)
+			goto out;
+
+		pr_perror("Can't open archive");
+		goto err;
+	}
+
+	if (archive_read_index(a, fd))
+		goto err_close;
+
+	if (sfd) {
+		if (install_service_fd(IMG_ARCHIVE_FD_OFF, fd) < 0)
+			goto err_close;
+		a->sfd = true;
+	}
+
+	close(fd);
+out:
+	list_add(&a->l, &archives);
+	return a;
+
+err_close:
+	close(fd);
+err:
+	archive_free(a);
+	return NULL;
+}
+
+/* Called on open_image_dir */
+int archive_load(int dfd)
+{
+	struct stat st;
+
+	if (fstat(dfd, &st)) {
+		pr_perror("Can't stat images dir");
+		return -1;
+	}
+
+	return archive_read(dfd, &st, true) ? 0 : -1;
+}
+
+static struct archive *archive_get(int dfd)
+{
+	struct archive *a;
+	struct stat st;
+
+	if (fstat(dfd, &st)) {
+		pr_perror("Can't stat images dir");
+		return NULL;
+	}
+
+	list_for_each_entry(a, &archives, l)
+		if (a->dev == st.st_dev && a->ino == st.st_ino)
+			return a;
+
+	return archive_read(dfd, &st, false);
+}
+
+static int archive_rst_image(int dfd, const char *path)
+{
+	struct archive_img *img;
+	struct archive *a;
+	int fd, afd;
+
+	if (dump_arch && dfd == get_service_fd(IMG_FD_OFF)) {
+		/* Reading back what is being dumped */
+		a = dump_arch;
+		afd = a->fd;
+	} else {
+		a = archive_get(dfd);
+		if (!a)
+			return -1;
+		afd = -1;
+	}
+
+	img = archive_find(a, path);
+	if (!img)
+		return -ENOENT;
+
+	if (img->fd >= 0) {
+		char p[32];
+
+		snprintf(p, sizeof(p), "/proc/self/fd/%d", img->fd);
+		fd = open(p, O_RDONLY);
+		if (fd < 0)
+			pr_perror("Can't reopen %s", path);
+		return fd;
+	}
+
+	if (afd < 0) {
+		if (a->sfd)
+			afd = get_service_fd(IMG_ARCHIVE_FD_OFF);
+		else {
+			/* Not to leak it into restored tasks */
+			afd = openat(dfd, CR_ARCHIVE_NAME, O_RDONLY);
+			if (afd < 0) {
+				pr_perror("Can't open archive");
+				return -1;
+			}
+		}
+	}
+
+	fd = archive_memfd(ARCHIVE_RST_MEMFD);
+	if (fd >= 0 && (copy_range(fd, afd, img->off, img->len) ||
+			lseek(fd, 0, SEEK_SET))) {
+		close(fd);
+		fd = -1;
+	}
+
+	if (afd != a->fd && !a->sfd)
+		close(afd);
+
+	return fd;
+}
+
+/*
+ * Returns image fd, or -ENOENT if the image is not in (or
+ * shouldn't go to) an archive and is to be opened as a file.
+ */
+int archive_open_image(int dfd, int type, const char *path, unsigned long flags)
+{
+	if (!archived_type(type))
+		return -ENOENT;
+
+	if (flags == O_DUMP) {
+		if (!dump_arch || dfd != get_service_fd(IMG_FD_OFF))
+			return -ENOENT;
+
+		return archive_dump_image(path);
+	}
+
+	/* Dedup opens pagemaps O_RDWR, but only to read them */
+	if (flags != O_RSTR && flags != O_RDWR)
+		return -ENOENT;
+
+	return archive_rst_image(dfd, path);
+}
@@ -0,0 +1,106 @@
+#include <unistd.h>
+#include <string.h>
+
+#include "config.h"
+#include "compress.h"
+#include "util.h"
+
+#ifdef CONFIG_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+#undef	LOG_PREFIX
+#define LOG_PREFIX "compress: "
+
+#ifdef CONFIG_HAS_ZLIB
+bool compress_supported(void)
+{
+	return true;
+}
+
+unsigned long compress_bound(unsigned long len)
+{
+	return compressBound(len);
+}
+
+/*
+ * Compresses len bytes from src into dst, which should have
+ * compress_bound(len) bytes. Returns the compressed size, or
+ * len if the pages don't compress and should be stored as is
+ * (dst is garbage then).
+ */
+long compress_pages(void *src, unsigned long len, void *dst)
+{
+	uLongf zlen = compressBound(len);
+	int ret;
+
+	ret = compress2(dst, &zlen, src, len, Z_BEST_SPEED);
+	if (ret != Z_OK) {
+		pr_err("Can't compress %lu bytes: %d\n", len, ret);
+		return -1;
+	}
+
+	if (zlen >= len)
+		return len;
+
+	return zlen;
+}
+
+static int decompress_pages(void *src, unsigned long slen, void *dst, unsigned long len)
+{
+	uLongf dlen = len;
+	int ret;
+
+	ret = uncompress(dst, &dlen, src, slen);
+	if (ret != Z_OK || dlen != len) {
+		pr_err("Can't decompress %lu bytes into %lu: %d\n", slen, len, ret);
+		return -1;
+	}
+
+	return 0;
+}
+#else
+bool compress_supported(void)
+{
+	return false;
+}
+
+unsigned long compress_bound(unsigned long len)
+{
+	return len;
+}
+
+long compress_pages(void *src, unsigned long len, void *dst)
+{
+	pr_err("Compression is not supported\n");
+	return -1;
+}
+
+static int decompress_pages(void *src, unsigned long slen, void *dst, unsigned long len)
+{
+	pr_err("Compressed pages images are not supported\n");
+	return -1;
+}
+#endif
+
+/*
+ * Reads a chunk of comp_len bytes from fd and decompresses
+ * it into len bytes at buf. The zbuf is for compressed data
+ * and should have compress_bound(len) bytes.
+ */
+int read_compressed_pages(int fd, void *zbuf, unsigned long comp_len,
+		void *buf, unsigned long len)
+{
+	if (comp_len > compress_bound(len)) {
+		pr_err("Bad compressed chunk size %lu for %lu bytes\n", comp_len, len);
+		return -1;
+	}
+
+	if (comp_len == len)
+		return read_img_buf(fd, buf, len) < 0 ? -1 : 0;
+
+	if (read_img_buf(fd, zbuf, comp_len) < 0)
+		return -1;
+
+	return decompress_pages(zbuf, comp_len, buf, len);
+}
@@ -129,7 +129,11 @@ int dedup_one_iovec(struct page_read *pr, struct iovec *iov)
 		pagemap2iovec(pr->pe, &piov);
 		piov_end = (unsigned long)piov.iov_base + piov.iov_len;
 		off_real = lseek(pr->fd_pg, 0, SEEK_CUR);
-		if (!pr->pe->in_parent) {
+		/*
+		 * A compressed chunk can't be punched page by page,
+		 * and zero pages have nothing to punch
+		 */
+		if (!pr->pe->in_parent && !pr->pe->has_comp_len && !pr->pe->zero) {
 			pr_debug("Punch!/%lu/%lu/\n", off_real, min(piov_end, iov_end) - off);
 			ret = fallocate(pr->fd_pg, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
 					off_real, min(piov_end, iov_end) - off);
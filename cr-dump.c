@@ -1,4 +1,5 @@
 #include <sys/time.h>
+#include <time.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
@@ -71,6 +72,7 @@
 #include "vma.h"
 #include "cr-service.h"
 #include "plugin.h"
+#include "archive.h"
 
 #include "asm/dump.h"
 
@@ -123,15 +125,23 @@ void free_mappings(struct vm_area_list *vma_area_list)
 	vma_area_list->nr = 0;
 }
 
-int collect_mappings(pid_t pid, struct vm_area_list *vma_area_list)
+/*
+ * VmFlags are needed to dump the mm, others only need ranges
+ * and can avoid the smaps cost.
+ */
+int collect_mappings(pid_t pid, struct vm_area_list *vma_area_list, bool vmflags)
 {
+	unsigned int flags = PROC_VMAS_MAP_FILES;
 	int ret = -1;
 
 	pr_info("\n");
 	pr_info("Collecting mappings (pid: %d)\n", pid);
 	pr_info("----------------------------------------\n");
 
-	ret = parse_smaps(pid, vma_area_list, true);
+	if (vmflags)
+		flags |= PROC_VMAS_VMFLAGS;
+
+	ret = parse_maps(pid, vma_area_list, flags);
 	if (ret < 0)
 		goto err;
 
@@ -782,6 +792,7 @@ static int get_children(struct pstree_item *item)
 		}
 
 		c->pid.real = ch[i];
+		pstree_hash_real(c);
 		c->parent = item;
 		c->state = ret;
 		list_add_tail(&c->sibling, &item->children);
@@ -993,6 +1004,7 @@ static int collect_pstree(pid_t pid)
 		return -1;
 
 	root_item->pid.real = pid;
+	pstree_hash_real(root_item);
 	ret = seize_task(pid, -1, &root_item->pgid, &root_item->sid);
 	if (ret < 0)
 		goto err;
@@ -1046,8 +1058,7 @@ static int collect_file_locks(void)
 
 }
 
-static int dump_task_thread(struct parasite_ctl *parasite_ctl,
-				const struct pstree_item *item, int id)
+static int dump_task_thread(const struct pstree_item *item, int id)
 {
 	struct pid *tid = &item->threads[id];
 	CoreEntry *core = item->core[id];
@@ -1058,12 +1069,6 @@ static int dump_task_thread(struct parasite_ctl *parasite_ctl,
 	pr_info("Dumping core for thread (pid: %d)\n", pid);
 	pr_info("----------------------------------------\n");
 
-	ret = parasite_dump_thread_seized(parasite_ctl, id, tid, core);
-	if (ret) {
-		pr_err("Can't dump thread for pid %d\n", pid);
-		goto err;
-	}
-
 	fd_core = open_image(CR_FD_CORE, O_DUMP, tid->virt);
 	if (fd_core < 0)
 		goto err;
@@ -1183,17 +1188,23 @@ static int dump_task_signals(pid_t pid, struct pstree_item *item,
 static struct proc_pid_stat pps_buf;
 
 static int dump_task_threads(struct parasite_ctl *parasite_ctl,
-			     const struct pstree_item *item)
+			     struct pstree_item *item)
 {
 	int i;
 
+	if (item->nr_threads > 1 &&
+	    parasite_dump_threads_seized(parasite_ctl, item)) {
+		pr_err("Can't dump threads of %d\n", item->pid.real);
+		return -1;
+	}
+
 	for (i = 0; i < item->nr_threads; i++) {
 		/* Leader is already dumped */
 		if (item->pid.real == item->threads[i].real) {
 			item->threads[i].virt = item->pid.virt;
 			continue;
 		}
-		if (dump_task_thread(parasite_ctl, item, i))
+		if (dump_task_thread(item, i))
 			return -1;
 	}
 
@@ -1298,6 +1309,20 @@ err:
 	return ret;
 }
 
+/* Zombies are not counted, as they are not dumped one by one */
+static void stats_set_pstree(void)
+{
+	struct pstree_item *item;
+	unsigned int nr = 0;
+
+	for_each_pstree_item(item)
+		if (item->state != TASK_DEAD)
+			nr++;
+
+	/* Pre-dump iterations add up */
+	stats_set_tasks(cnt_get(CNT_TASKS_DUMPED) + nr);
+}
+
 static int pre_dump_one_task(struct pstree_item *item, struct list_head *ctls)
 {
 	pid_t pid = item->pid.real;
@@ -1313,22 +1338,26 @@ static int pre_dump_one_task(struct pstree_item *item, struct list_head *ctls)
 	pr_info("Pre-dumping task (pid: %d)\n", pid);
 	pr_info("========================================\n");
 
+	if (item->state == TASK_DEAD)
+		return 0;
+
+	cnt_add(CNT_TASKS_DUMPED, 1);
+
 	if (item->state == TASK_STOPPED) {
 		pr_warn("Stopped tasks are not supported\n");
 		return 0;
 	}
 
-	if (item->state == TASK_DEAD)
-		return 0;
-
-	ret = collect_mappings(pid, &vmas);
+	ret = collect_mappings(pid, &vmas, false);
 	if (ret) {
 		pr_err("Collect mappings (pid: %d) failed with %d\n", pid, ret);
 		goto err;
 	}
 
 	ret = -1;
+	timing_start(TIME_INFECT);
 	parasite_ctl = parasite_infect_seized(pid, item, &vmas, NULL, 0);
+	timing_stop(TIME_INFECT);
 	if (!parasite_ctl) {
 		pr_err("Can't infect (pid: %d) with parasite\n", pid);
 		goto err_free;
@@ -1346,8 +1375,10 @@ static int pre_dump_one_task(struct pstree_item *item, struct list_head *ctls)
 	if (ret)
 		goto err_cure;
 
+	timing_start(TIME_CURE);
 	if (parasite_cure_remote(parasite_ctl))
 		pr_err("Can't cure (pid: %d) from parasite\n", pid);
+	timing_stop(TIME_CURE);
 	list_add_tail(&parasite_ctl->pre_list, ctls);
 err_free:
 	free_mappings(&vmas);
@@ -1385,6 +1416,8 @@ static int dump_one_task(struct pstree_item *item)
 		 */
 		return 0;
 
+	cnt_add(CNT_TASKS_DUMPED, 1);
+
 	dfds = xmalloc(sizeof(*dfds));
 	if (!dfds)
 		goto err_free;
@@ -1404,7 +1437,7 @@ static int dump_one_task(struct pstree_item *item)
 		goto err;
 	}
 
-	ret = collect_mappings(pid, &vmas);
+	ret = collect_mappings(pid, &vmas, true);
 	if (ret) {
 		pr_err("Collect mappings (pid: %d) failed with %d\n", pid, ret);
 		goto err;
@@ -1423,7 +1456,9 @@ static int dump_one_task(struct pstree_item *item)
 	}
 
 	ret = -1;
+	timing_start(TIME_INFECT);
 	parasite_ctl = parasite_infect_seized(pid, item, &vmas, dfds, proc_args.timer_n);
+	timing_stop(TIME_INFECT);
 	if (!parasite_ctl) {
 		pr_err("Can't infect (pid: %d) with parasite\n", pid);
 		goto err;
@@ -1482,7 +1517,9 @@ static int dump_one_task(struct pstree_item *item)
 	}
 
 	if (!shared_fdtable(item)) {
+		timing_start(TIME_FILES);
 		ret = dump_task_files_seized(parasite_ctl, item, dfds);
+		timing_stop(TIME_FILES);
 		if (ret) {
 			pr_err("Dump files (pid: %d) failed with %d\n", pid, ret);
 			goto err_cure;
@@ -1544,7 +1581,9 @@ static int dump_one_task(struct pstree_item *item)
 		goto err;
 	}
 
+	timing_start(TIME_CURE);
 	ret = parasite_cure_seized(parasite_ctl);
+	timing_stop(TIME_CURE);
 	if (ret) {
 		pr_err("Can't cure (pid: %d) from parasite\n", pid);
 		goto err;
@@ -1589,25 +1628,23 @@ err_cure_fdset:
 	goto err;
 }
 
-int cr_pre_dump_tasks(pid_t pid)
+static int pre_dump_tasks_once(pid_t pid)
 {
 	struct pstree_item *item;
 	int ret = -1;
 	LIST_HEAD(ctls);
 	struct parasite_ctl *ctl, *n;
 
-	if (init_stats(DUMP_STATS))
-		goto err;
-
-	if (kerndat_init())
-		goto err;
-
-	if (connect_to_page_server())
-		goto err;
+	if (archive_start())
+		return -1;
 
+	stats_set_phase(PHASE_FREEZING);
 	if (collect_pstree(pid))
 		goto err;
 
+	stats_set_pstree();
+	stats_set_phase(PHASE_DUMPING);
+
 	for_each_pstree_item(item)
 		if (pre_dump_one_task(item, &ctls))
 			goto err;
@@ -1620,28 +1657,207 @@ err:
 
 	timing_stop(TIME_FROZEN);
 
+	stats_set_phase(PHASE_WRITING_PAGES);
 	pr_info("Pre-dumping tasks' memory\n");
 	list_for_each_entry_safe(ctl, n, &ctls, pre_list) {
-		struct page_xfer xfer;
-
 		pr_info("\tPre-dumping %d\n", ctl->pid.virt);
 		timing_start(TIME_MEMWRITE);
-		ret = open_page_xfer(&xfer, CR_FD_PAGEMAP, ctl->pid.virt);
+		ret = dump_page_pipe(ctl->mem_pp, CR_FD_PAGEMAP, ctl->pid.virt, 0);
+		timing_stop(TIME_MEMWRITE);
 		if (ret < 0)
 			break;
 
-		ret = page_xfer_dump_pages(&xfer, ctl->mem_pp, 0);
-
-		xfer.close(&xfer);
-		timing_stop(TIME_MEMWRITE);
+		if (archive_sync()) {
+			ret = -1;
+			break;
+		}
 
 		destroy_page_pipe(ctl->mem_pp);
 		list_del(&ctl->pre_list);
 		parasite_cure_local(ctl);
 	}
 
+	timing_start(TIME_MEMWRITE);
+	if (wait_page_writers())
+		ret = -1;
+	timing_stop(TIME_MEMWRITE);
+
+	if (archive_close(!ret))
+		ret = -1;
+
+	return ret;
+}
+
+/*
+ * Iterative pre-dump. Each iteration goes into its own sub-directory
+ * of images dir, named by the iteration number, with the parent link
+ * pointing to the previous one. Thus every next iteration only writes
+ * the pages dirtied while the previous one was being written.
+ *
+ * Iterations go on while the dirty set shrinks, and the last one is
+ * pointed to by the PRE_DUMP_LAST symlink, for the final dump to use
+ * it as parent.
+ *
+ * Iteration dirs left by a previous run hold images of tasks that may
+ * not exist any more, so rather than mixing them with new ones we
+ * refuse to start.
+ */
+
+#define PRE_DUMP_LAST	"last"
+
+static int pre_dump_iter_dir(int dfd, unsigned int iter)
+{
+	char name[16], parent[PATH_MAX];
+	int fd, pfd, ret = -1;
+
+	snprintf(name, sizeof(name), "%u", iter);
+	if (mkdirat(dfd, name, 0700)) {
+		pr_perror("Can't create pre-dump dir %s", name);
+		return -1;
+	}
+
+	fd = openat(dfd, name, O_RDONLY | O_DIRECTORY);
+	if (fd < 0) {
+		pr_perror("Can't open pre-dump dir %s", name);
+		return -1;
+	}
+
+	if (iter > 1)
+		snprintf(parent, sizeof(parent), "../%u", iter - 1);
+	else if (opts.img_parent)
+		snprintf(parent, sizeof(parent), "%s%s",
+				opts.img_parent[0] == '/' ? "" : "../", opts.img_parent);
+	else
+		parent[0] = '\0';
+
+	if (parent[0]) {
+		if (symlinkat(parent, fd, CR_PARENT_LINK)) {
+			pr_perror("Can't link parent snapshot");
+			goto out;
+		}
+
+		pfd = openat(fd, CR_PARENT_LINK, O_RDONLY);
+		if (pfd < 0) {
+			pr_perror("Can't open parent snapshot");
+			goto out;
+		}
+
+		ret = install_service_fd(PARENT_FD_OFF, pfd);
+		close(pfd);
+		if (ret < 0)
+			goto out;
+	}
+
+	ret = install_service_fd(IMG_FD_OFF, fd);
+out:
+	close(fd);
+	return ret < 0 ? -1 : 0;
+}
+
+static int pre_dump_iterate(pid_t pid)
+{
+	unsigned long written, prev_written = ULONG_MAX;
+	time_t start = time(NULL);
+	unsigned int iter;
+	char name[16];
+	int dfd, ret = -1;
+
+	dfd = dup(get_service_fd(IMG_FD_OFF));
+	if (dfd < 0) {
+		pr_perror("Can't dup images dir");
+		return -1;
+	}
+
+	for (iter = 1; iter <= opts.pre_dump_iters; iter++) {
+		snprintf(name, sizeof(name), "%u", iter);
+		if (!faccessat(dfd, name, F_OK, AT_SYMLINK_NOFOLLOW)) {
+			pr_err("Pre-dump dir %s already exists, images dir should be clean\n", name);
+			goto out;
+		}
+	}
+
+	for (iter = 1; ; iter++) {
+		pr_info("========================================\n");
+		pr_info("Pre-dump iteration %u\n", iter);
+		pr_info("========================================\n");
+
+		if (pre_dump_iter_dir(dfd, iter))
+			goto out;
+
+		written = cnt_get(CNT_PAGES_WRITTEN);
+		if (pre_dump_tasks_once(pid))
+			goto out;
+		written = cnt_get(CNT_PAGES_WRITTEN) - written;
+
+		pr_info("Pre-dump iteration %u wrote %lu pages\n", iter, written);
+
+		if (iter >= opts.pre_dump_iters)
+			break;
+
+		if (written <= opts.pre_dump_converge) {
+			pr_info("Pre-dump converged\n");
+			break;
+		}
+
+		if (written >= prev_written) {
+			pr_info("Dirty set doesn't shrink any more\n");
+			break;
+		}
+
+		if (opts.pre_dump_time && time(NULL) - start >= opts.pre_dump_time) {
+			pr_info("Pre-dump time is out\n");
+			break;
+		}
+
+		prev_written = written;
+	}
+
+	snprintf(name, sizeof(name), "%u", iter);
+	if (unlinkat(dfd, PRE_DUMP_LAST, 0) && errno != ENOENT) {
+		pr_perror("Can't remove old %s link", PRE_DUMP_LAST);
+		goto out;
+	}
+
+	if (symlinkat(name, dfd, PRE_DUMP_LAST)) {
+		pr_perror("Can't link %s pre-dump", PRE_DUMP_LAST);
+		goto out;
+	}
+
+	pr_info("Pre-dumped in %u iterations\n", iter);
+	ret = 0;
+out:
+	/* Stats go into the images dir itself */
+	if (install_service_fd(IMG_FD_OFF, dfd) < 0)
+		ret = -1;
+	close(dfd);
+	return ret;
+}
+
+int cr_pre_dump_tasks(pid_t pid)
+{
+	int ret = -1;
+
+	if (init_stats(DUMP_STATS))
+		goto err;
+
+	if (progress_start())
+		goto err;
+
+	if (kerndat_init())
+		goto err;
+
+	if (connect_to_page_server())
+		goto err;
+
+	if (opts.pre_dump_iters > 1)
+		ret = pre_dump_iterate(pid);
+	else
+		ret = pre_dump_tasks_once(pid);
+
 	if (disconnect_from_page_server())
 		ret = -1;
+err:
+	progress_stop();
 
 	if (ret)
 		pr_err("Pre-dumping FAILED.\n");
@@ -1666,6 +1882,9 @@ int cr_dump_tasks(pid_t pid)
 	if (init_stats(DUMP_STATS))
 		goto err;
 
+	if (progress_start())
+		goto err;
+
 	if (cr_plugin_init())
 		goto err;
 
@@ -1678,6 +1897,9 @@ int cr_dump_tasks(pid_t pid)
 	if (vdso_init())
 		goto err;
 
+	if (archive_start())
+		goto err;
+
 	if (write_img_inventory())
 		goto err;
 
@@ -1690,9 +1912,13 @@ int cr_dump_tasks(pid_t pid)
 	 * afterwards.
 	 */
 
+	stats_set_phase(PHASE_FREEZING);
 	if (collect_pstree(pid))
 		goto err;
 
+	stats_set_pstree();
+	stats_set_phase(PHASE_COLLECTING);
+
 	if (collect_pstree_ids())
 		goto err;
 
@@ -1702,24 +1928,35 @@ int cr_dump_tasks(pid_t pid)
 	if (collect_file_locks())
 		goto err;
 
+	timing_start(TIME_MOUNTS);
 	if (collect_mount_info(pid))
 		goto err;
+	timing_stop(TIME_MOUNTS);
 
 	if (mntns_collect_root(root_item->pid.real))
 		goto err;
 
+	timing_start(TIME_SOCKETS);
 	if (collect_sockets(pid))
 		goto err;
+	timing_stop(TIME_SOCKETS);
 
 	glob_fdset = cr_glob_fdset_open(O_DUMP);
 	if (!glob_fdset)
 		goto err;
 
+	stats_set_phase(PHASE_DUMPING);
+
 	for_each_pstree_item(item) {
 		if (dump_one_task(item))
 			goto err;
+
+		if (archive_sync())
+			goto err;
 	}
 
+	stats_set_phase(PHASE_DUMPING_GLOBAL);
+
 	if (dump_verify_tty_sids())
 		goto err;
 
@@ -1729,11 +1966,16 @@ int cr_dump_tasks(pid_t pid)
 	if (dump_pstree(root_item))
 		goto err;
 
-	if (current_ns_mask)
+	if (current_ns_mask) {
+		timing_start(TIME_NAMESPACES);
 		if (dump_namespaces(root_item, current_ns_mask) < 0)
 			goto err;
+		timing_stop(TIME_NAMESPACES);
+	}
 
+	timing_start(TIME_SHMEM);
 	ret = cr_dump_shmem();
+	timing_stop(TIME_SHMEM);
 	if (ret)
 		goto err;
 
@@ -1747,11 +1989,21 @@ int cr_dump_tasks(pid_t pid)
 
 	fd_id_show_tree();
 err:
+	/* Tasks must stay frozen till all their pages are written */
+	stats_set_phase(PHASE_WRITING_PAGES);
+	timing_start(TIME_MEMWRITE);
+	if (wait_page_writers())
+		ret = -1;
+	timing_stop(TIME_MEMWRITE);
+
 	if (disconnect_from_page_server())
 		ret = -1;
 
 	close_cr_fdset(&glob_fdset);
 
+	if (archive_close(!ret))
+		ret = -1;
+
 	cr_plugin_fini();
 
 	if (!ret) {
@@ -1807,6 +2059,8 @@ err:
 
 	close_service_fd(CR_PROC_FD_OFF);
 
+	progress_stop();
+
 	if (ret) {
 		kill_inventory();
 		pr_err("Dumping FAILED.\n");
@@ -135,7 +135,7 @@ int cr_exec(int pid, char **opt)
 		goto out;
 	}
 
-	ret = collect_mappings(pid, &vmas);
+	ret = collect_mappings(pid, &vmas, false);
 	if (ret) {
 		pr_err("Can't collect vmas for %d\n", pid);
 		goto out_unseize;
@@ -66,8 +66,10 @@
 #include "tun.h"
 #include "vma.h"
 #include "kerndat.h"
+#include "uffd.h"
 #include "rst-malloc.h"
 #include "plugin.h"
+#include "archive.h"
 
 #include "parasite-syscall.h"
 
@@ -91,6 +93,7 @@ static int prepare_posix_timers(int pid);
 static int prepare_signals(int pid);
 
 static VM_AREA_LIST(rst_vmas); /* XXX .longest is NOT tracked for this guy */
+static unsigned int nr_lazy_vmas; /* VMA_AREA_LAZY-s in rst_vmas */
 
 static int shmem_remap(void *old_addr, void *new_addr, unsigned long size)
 {
@@ -317,6 +320,12 @@ static int map_private_vma(pid_t pid, struct vma_area *vma, void *tgt_addr,
 	return size;
 }
 
+/*
+ * Pages of inherited VMAs are read into a bounce buffer in batches
+ * of this size and compared against what we've got from the parent.
+ */
+#define COW_BATCH_PAGES	64
+
 static int restore_priv_vma_content(pid_t pid)
 {
 	struct vma_area *vma;
@@ -327,17 +336,30 @@ static int restore_priv_vma_content(pid_t pid)
 	unsigned int nr_droped = 0;
 	unsigned long va;
 	struct page_read pr;
+	void *cbuf = NULL;
 
 	vma = list_first_entry(&rst_vmas.h, struct vma_area, list);
 	ret = open_page_read(pid, &pr);
 	if (ret)
 		return -1;
 
+	if (opts.mmap_pages && map_page_read(&pr)) {
+		pr.close(&pr);
+		return -1;
+	}
+
+	if (nr_lazy_vmas && !pr.skip_pages) {
+		pr_warn("Old pages image format, restoring all pages eagerly\n");
+		list_for_each_entry(vma, &rst_vmas.h, list)
+			vma->vma.status &= ~VMA_AREA_LAZY;
+		nr_lazy_vmas = 0;
+	}
+
 	/*
 	 * Read page contents.
 	 */
 	while (1) {
-		unsigned long off, i, nr_pages;;
+		unsigned long off, i, j, nr, nr_pages;
 		struct iovec iov;
 
 		ret = pr.get_pagemap(&pr, &iov);
@@ -347,8 +369,7 @@ static int restore_priv_vma_content(pid_t pid)
 		va = (unsigned long)iov.iov_base;
 		nr_pages = iov.iov_len / PAGE_SIZE;
 
-		for (i = 0; i < nr_pages; i++) {
-			unsigned char buf[PAGE_SIZE];
+		for (i = 0; i < nr_pages; i += nr) {
 			void *p;
 
 			/*
@@ -374,33 +395,101 @@ static int restore_priv_vma_content(pid_t pid)
 				goto err_addr;
 			}
 
+			/*
+			 * Take as many pages from the pagemap entry as
+			 * fit into this VMA and read them in one go.
+			 */
+			nr = min(nr_pages - i, (unsigned long)(vma->vma.end - va) / PAGE_SIZE);
 			off = (va - vma->vma.start) / PAGE_SIZE;
 			p = decode_pointer((off) * PAGE_SIZE +
 					vma->premmaped_addr);
 
-			set_bit(off, vma->page_bitmap);
-			if (vma->ppage_bitmap) { /* inherited vma */
-				clear_bit(off, vma->ppage_bitmap);
-
-				ret = pr.read_page(&pr, va, buf);
-				if (ret < 0)
-					goto err_read;
-				va += PAGE_SIZE;
+			if (vma_area_is(vma, VMA_AREA_LAZY)) {
+				/* The lazy-pages daemon will bring these in */
+				pr.skip_pages(&pr, nr * PAGE_SIZE);
+				va += nr * PAGE_SIZE;
+				continue;
+			}
 
-				if (memcmp(p, buf, PAGE_SIZE) == 0) {
-					nr_shared++; /* the page is cowed */
-					continue;
+			for (j = 0; j < nr; j++)
+				set_bit(off + j, vma->page_bitmap);
+
+			if (vma->ppage_bitmap && pr.peek_pages) { /* inherited vma */
+				/*
+				 * Compare right against the mapped images, the
+				 * page is only copied if it was really changed.
+				 */
+				for (j = 0; j < nr; ) {
+					void *src;
+					int k, got;
+
+					got = pr.peek_pages(&pr, va, nr - j, &src);
+					if (got < 0) {
+						ret = got;
+						goto err_read;
+					}
+
+					for (k = 0; k < got; k++, j++) {
+						void *pp = p + j * PAGE_SIZE;
+						void *sp = src + k * PAGE_SIZE;
+
+						clear_bit(off + j, vma->ppage_bitmap);
+						if (memcmp(pp, sp, PAGE_SIZE) == 0) {
+							nr_shared++; /* the page is cowed */
+							continue;
+						}
+
+						memcpy(pp, sp, PAGE_SIZE);
+						nr_restored++;
+					}
+
+					va += (unsigned long)got * PAGE_SIZE;
+				}
+			} else if (vma->ppage_bitmap) { /* inherited vma */
+				if (!cbuf) {
+					cbuf = xmalloc(COW_BATCH_PAGES * PAGE_SIZE);
+					if (!cbuf) {
+						ret = -1;
+						goto err_read;
+					}
 				}
 
-				memcpy(p, buf, PAGE_SIZE);
+				for (j = 0; j < nr; ) {
+					unsigned long k, batch;
+
+					batch = min(nr - j, (unsigned long)COW_BATCH_PAGES);
+					ret = pr.read_pages(&pr, va, batch, cbuf);
+					if (ret < 0)
+						goto err_read;
+
+					for (k = 0; k < batch; k++, j++) {
+						void *pp = p + j * PAGE_SIZE;
+						void *bp = cbuf + k * PAGE_SIZE;
+
+						clear_bit(off + j, vma->ppage_bitmap);
+						if (memcmp(pp, bp, PAGE_SIZE) == 0) {
+							nr_shared++; /* the page is cowed */
+							continue;
+						}
+
+						memcpy(pp, bp, PAGE_SIZE);
+						nr_restored++;
+					}
+
+					va += batch * PAGE_SIZE;
+				}
+			} else if (pr.pe && pr.pe->zero &&
+					vma_area_is(vma, VMA_ANON_PRIVATE)) {
+				/* Fresh anonymous memory is zeroed already */
+				pr.skip_pages(&pr, nr * PAGE_SIZE);
+				va += nr * PAGE_SIZE;
 			} else {
-				ret = pr.read_page(&pr, va, p);
+				ret = pr.read_pages(&pr, va, nr, p);
 				if (ret < 0)
 					goto err_read;
-				va += PAGE_SIZE;
+				va += nr * PAGE_SIZE;
+				nr_restored += nr;
 			}
-
-			nr_restored++;
 		}
 
 		if (pr.put_pagemap)
@@ -408,6 +497,7 @@ static int restore_priv_vma_content(pid_t pid)
 	}
 
 err_read:
+	xfree(cbuf);
 	pr.close(&pr);
 	if (ret < 0)
 		return ret;
@@ -451,9 +541,27 @@ err_read:
 err_addr:
 	pr_err("Page entry address %lx outside of VMA %lx-%lx\n",
 	       va, (long)vma->vma.start, (long)vma->vma.end);
+	xfree(cbuf);
 	return -1;
 }
 
+/*
+ * Only anonymous private memory, that is not inherited from
+ * the parent, is left for the lazy-pages daemon. Everything
+ * else is restored as usual.
+ */
+static bool vma_may_be_lazy(struct vma_area *vma)
+{
+	if (!vma_area_is(vma, VMA_ANON_PRIVATE))
+		return false;
+	if (vma_area_is(vma, VMA_AREA_VDSO) || vma_area_is(vma, VMA_AREA_VSYSCALL))
+		return false;
+	if (vma->vma.flags & MAP_GROWSDOWN)
+		return false;
+
+	return vma->ppage_bitmap == NULL;
+}
+
 static int prepare_mappings(int pid)
 {
 	int fd, ret = 0;
@@ -464,8 +572,11 @@ static int prepare_mappings(int pid)
 	void *old_premmapped_addr = NULL;
 	unsigned long old_premmapped_len, pstart = 0;
 
+	timing_start(TIME_PREMAP);
+
 	rst_vmas.nr = 0;
 	rst_vmas.priv_size = 0;
+	nr_lazy_vmas = 0;
 	/*
 	 * Keep parent vmas at hands to check whether we can "inherit" them.
 	 * See comments in map_private_vma.
@@ -549,10 +660,20 @@ static int prepare_mappings(int pid)
 			break;
 
 		addr += ret;
+
+		if (opts.lazy_pages && vma_may_be_lazy(vma)) {
+			vma->vma.status |= VMA_AREA_LAZY;
+			nr_lazy_vmas++;
+		}
 	}
 
-	if (ret >= 0)
+	timing_stop(TIME_PREMAP);
+
+	if (ret >= 0) {
+		timing_start(TIME_PAGES_READ);
 		ret = restore_priv_vma_content(pid);
+		timing_stop(TIME_PAGES_READ);
+	}
 
 out:
 	while (!list_empty(&parent_vmas)) {
@@ -729,8 +850,12 @@ static int restore_one_alive_task(int pid, CoreEntry *core)
 	if (pstree_wait_helpers())
 		return -1;
 
+	cnt_add(CNT_TASKS_RESTORED, 1);
+
+	timing_start(TIME_FDS);
 	if (prepare_fds(current))
 		return -1;
+	timing_stop(TIME_FDS);
 
 	if (prepare_file_locks(pid))
 		return -1;
@@ -750,6 +875,7 @@ static int restore_one_alive_task(int pid, CoreEntry *core)
 	if (prepare_rlimits(pid) < 0)
 		return -1;
 
+	timing_start(TIME_SIGRETURN);
 	return sigreturn_restore(pid, core);
 }
 
@@ -900,6 +1026,70 @@ static int restore_one_task(int pid, CoreEntry *core)
 	return ret;
 }
 
+/*
+ * Every task reads its images right after fork and parents read
+ * their children's cores before it, so on a cold cache restoring
+ * a big tree waits for the disk task by task. Thus a helper asks
+ * the kernel to read per-task images ahead, while we go on with
+ * preparing the shared resources.
+ */
+static pid_t prefetch_pid = -1;
+
+static void prefetch_task_images(int dfd, struct pstree_item *item)
+{
+	int i;
+
+	for (i = 0; i < item->nr_threads; i++)
+		prefetch_image_at(dfd, CR_FD_CORE, item->threads[i].virt);
+
+	prefetch_image_at(dfd, CR_FD_IDS, item->pid.virt);
+	prefetch_image_at(dfd, CR_FD_MM, item->pid.virt);
+	prefetch_image_at(dfd, CR_FD_VMAS, item->pid.virt);
+	prefetch_image_at(dfd, CR_FD_PAGEMAP, (long)item->pid.virt);
+
+	if (!fdinfo_per_id)
+		prefetch_image_at(dfd, CR_FD_FDINFO, item->pid.virt);
+	else if (item->ids)
+		prefetch_image_at(dfd, CR_FD_FDINFO, item->ids->files_id);
+}
+
+static void start_images_prefetch(void)
+{
+	struct pstree_item *item;
+	int dfd;
+
+	prefetch_pid = fork();
+	if (prefetch_pid < 0) {
+		/* Restore works without it, just slower */
+		pr_perror("Can't start images prefetch");
+		return;
+	}
+
+	if (prefetch_pid)
+		return;
+
+	dfd = get_service_fd(IMG_FD_OFF);
+
+	/* Small images are all in it, when it's there */
+	prefetch_file(dfd, CR_ARCHIVE_NAME);
+
+	for_each_pstree_item(item)
+		if (item->state != TASK_HELPER)
+			prefetch_task_images(dfd, item);
+
+	_exit(0);
+}
+
+/* Must be reaped before tasks are forked, see sigchld_handler */
+static void wait_images_prefetch(void)
+{
+	if (prefetch_pid <= 0)
+		return;
+
+	waitpid(prefetch_pid, NULL, 0);
+	prefetch_pid = -1;
+}
+
 /* All arguments should be above stack, because it grows down */
 struct cr_clone_arg {
 	char stack[PAGE_SIZE] __attribute__((aligned (8)));
@@ -911,6 +1101,36 @@ struct cr_clone_arg {
 	CoreEntry *core;
 };
 
+/*
+ * With set_tid the kernel gives the new task the pid we ask for, so
+ * tasks don't serialize on ns_last_pid and fork their children all at
+ * once. Without CLONE_VM the child can go on with a copy of our stack,
+ * just like after fork.
+ */
+static int clone3_with_pid(struct cr_clone_arg *ca, pid_t pid)
+{
+	struct clone3_args args = { };
+	pid_t tid = pid;
+	long ret;
+
+	args.flags = ca->clone_flags;
+	args.exit_signal = SIGCHLD;
+	if (!(ca->clone_flags & CLONE_NEWPID)) {
+		args.set_tid = (unsigned long)&tid;
+		args.set_tid_size = 1;
+	}
+
+	ret = sys_clone3(&args, sizeof(args));
+	if (ret == 0)
+		_exit(restore_task_with_children(ca));
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return ret;
+}
+
 static inline int fork_with_pid(struct pstree_item *item)
 {
 	int ret = -1, fd;
@@ -952,7 +1172,26 @@ static inline int fork_with_pid(struct pstree_item *item)
 
 	pr_info("Forking task with %d pid (flags 0x%lx)\n", pid, ca.clone_flags);
 
-	if (!(ca.clone_flags & CLONE_NEWPID)) {
+	ret = -1;
+	if (ca.clone_flags & CLONE_NEWNET)
+		/*
+		 * When restoring a net namespace we need to communicate
+		 * with the original (i.e. -- init) one. Thus, prepare for
+		 * that before we leave the existing namespaces.
+		 */
+		if (netns_pre_create())
+			goto err;
+
+	/* The child would write our buffered messages again */
+	log_flush();
+
+	/*
+	 * Everything not needing the last_pid lock is done above,
+	 * as other tasks wait for it to fork their children.
+	 */
+	if (kerndat_has_clone3_set_tid)
+		ca.fd = -1;
+	else if (!(ca.clone_flags & CLONE_NEWPID)) {
 		char buf[32];
 
 		ca.fd = open(LAST_PID_PATH, O_RDWR);
@@ -975,20 +1214,24 @@ static inline int fork_with_pid(struct pstree_item *item)
 		BUG_ON(pid != INIT_PID);
 	}
 
-	if (ca.clone_flags & CLONE_NEWNET)
-		/*
-		 * When restoring a net namespace we need to communicate
-		 * with the original (i.e. -- init) one. Thus, prepare for
-		 * that before we leave the existing namespaces.
-		 */
-		if (netns_pre_create())
-			goto err_unlock;
+	if (kerndat_has_clone3_set_tid)
+		ret = clone3_with_pid(&ca, pid);
+	else
+		ret = clone(restore_task_with_children, ca.stack_ptr,
+				ca.clone_flags | SIGCHLD, &ca);
+	if (ret < 0)
+		pr_perror("Can't fork for %d", pid);
 
-	ret = clone(restore_task_with_children, ca.stack_ptr,
-			ca.clone_flags | SIGCHLD, &ca);
+err_unlock:
+	if (ca.fd >= 0) {
+		if (flock(ca.fd, LOCK_UN))
+			pr_perror("%d: Can't unlock %s", pid, LAST_PID_PATH);
+
+		close(ca.fd);
+	}
 
 	if (ret < 0)
-		pr_perror("Can't fork for %d", pid);
+		goto err;
 
 	if (item == root_item)
 		item->pid.real = ret;
@@ -1004,14 +1247,6 @@ static inline int fork_with_pid(struct pstree_item *item)
 			kill(pid, SIGKILL);
 		}
 	}
-
-err_unlock:
-	if (ca.fd >= 0) {
-		if (flock(ca.fd, LOCK_UN))
-			pr_perror("%d: Can't unlock %s", pid, LAST_PID_PATH);
-
-		close(ca.fd);
-	}
 err:
 	if (ca.core)
 		core_entry__free_unpacked(ca.core, NULL);
@@ -1528,6 +1763,7 @@ static int restore_root_task(struct pstree_item *init)
 		goto out;
 
 	timing_stop(TIME_FORK);
+	stats_set_phase(PHASE_RESTORING);
 
 	ret = restore_switch_stage(CR_STATE_RESTORE);
 	if (ret < 0)
@@ -1571,8 +1807,14 @@ static int restore_root_task(struct pstree_item *init)
 	 */
 	finalize_restore(ret);
 
+	if (opts.lazy_pages)
+		lazy_pages_restore_done();
+
 	write_stats(RESTORE_STATS);
 
+	/* Not to be waited for below */
+	progress_stop();
+
 	if (!opts.restore_detach)
 		wait(NULL);
 
@@ -1597,6 +1839,8 @@ out_kill:
 
 out:
 	__restore_switch_stage(CR_STATE_FAIL);
+	if (opts.lazy_pages)
+		lazy_pages_restore_done();
 	pr_err("Restoring FAILED.\n");
 	return 1;
 }
@@ -1617,6 +1861,54 @@ static int prepare_task_entries()
 	return 0;
 }
 
+static bool pid_to_restore(pid_t pid)
+{
+	struct pstree_item *pi;
+	int i;
+
+	for_each_pstree_item(pi) {
+		if (pi->pid.virt == pid)
+			return true;
+		for (i = 0; i < pi->nr_threads; i++)
+			if (pi->threads[i].virt == pid)
+				return true;
+	}
+
+	return false;
+}
+
+/*
+ * The progress server is our child started before the tree is read,
+ * so unless tasks get a new pid ns it may occupy a pid some of them
+ * need. Restart it then, every fork takes the next pid, and give up
+ * reporting progress if it doesn't help.
+ */
+#define PROGRESS_RESTARTS	64
+
+static int move_progress_server(void)
+{
+	pid_t pid;
+	int i;
+
+	if (current_ns_mask & CLONE_NEWPID)
+		return 0;
+
+	for (i = 0; i < PROGRESS_RESTARTS; i++) {
+		pid = progress_server_pid();
+		if (pid <= 0 || !pid_to_restore(pid))
+			return 0;
+
+		pr_info("Progress server has pid %d of a task, restarting it\n", pid);
+		progress_stop();
+		if (progress_start())
+			return -1;
+	}
+
+	pr_warn("Progress server can't get a free pid, not reporting progress\n");
+	progress_stop();
+	return 0;
+}
+
 int cr_restore_tasks(void)
 {
 	int ret = -1;
@@ -1630,9 +1922,17 @@ int cr_restore_tasks(void)
 	if (init_stats(RESTORE_STATS))
 		goto err;
 
+	if (progress_start())
+		goto err;
+
 	if (kerndat_init_rst())
 		goto err;
 
+	if (opts.lazy_pages && !kerndat_has_uffd) {
+		pr_err("Lazy pages restore needs userfaultfd with fork, remap and unmap events\n");
+		goto err;
+	}
+
 	timing_start(TIME_RESTORE);
 
 	if (cpu_init() < 0)
@@ -1647,11 +1947,24 @@ int cr_restore_tasks(void)
 	if (prepare_pstree() < 0)
 		goto err;
 
-	if (crtools_prepare_shared() < 0)
+	if (move_progress_server())
+		goto err;
+
+	stats_set_tasks(task_entries->nr_tasks);
+
+	start_images_prefetch();
+
+	ret = crtools_prepare_shared();
+	wait_images_prefetch();
+	if (ret < 0) {
+		ret = -1;
 		goto err;
+	}
 
+	stats_set_phase(PHASE_FORKING);
 	ret = restore_root_task(root_item);
 err:
+	progress_stop();
 	cr_plugin_fini();
 	return ret;
 }
@@ -2262,7 +2575,7 @@ static int sigreturn_restore(pid_t pid, CoreEntry *core)
 	 * this unwanted mapping might get overlapped by the restorer.
 	 */
 
-	ret = parse_smaps(pid, &self_vmas, false);
+	ret = parse_maps(pid, &self_vmas, 0);
 	close_proc();
 	if (ret < 0)
 		goto err;
@@ -2504,6 +2817,17 @@ static int sigreturn_restore(pid_t pid, CoreEntry *core)
 		goto err;
 	}
 
+	/*
+	 * The lazy-pages daemon listens in the work dir,
+	 * so connect to it before we leave one.
+	 */
+	task_args->lazy_pages_sk = -1;
+	if (nr_lazy_vmas) {
+		task_args->lazy_pages_sk = lazy_pages_connect(pid, &rst_vmas.h);
+		if (task_args->lazy_pages_sk < 0)
+			goto err;
+	}
+
 	/*
 	 * Now prepare run-time data for threads restore.
 	 */
@@ -2539,6 +2863,8 @@ static int sigreturn_restore(pid_t pid, CoreEntry *core)
 	 * and restoring core is extremely destructive.
 	 */
 
+	timing_stop(TIME_SIGRETURN);
+	log_flush();
 	JUMP_TO_RESTORER_BLOB(new_sp, restore_task_exec_start, task_args);
 
 err:
@@ -12,12 +12,16 @@
 #include <sys/un.h>
 #include <sys/wait.h>
 #include <sys/stat.h>
+#include <sys/prctl.h>
 
 #include "crtools.h"
 #include "cr_options.h"
 #include "util.h"
 #include "log.h"
 #include "pstree.h"
+#include "kerndat.h"
+#include "cpu.h"
+#include "vdso.h"
 #include "cr-service.h"
 #include "cr-service-const.h"
 #include "sd-daemon.h"
@@ -162,6 +166,9 @@ static int setup_opts_from_req(int sk, CriuOpts *req)
 	if (req->has_file_locks)
 		opts.handle_file_locks = req->file_locks;
 
+	if (req->progress_socket)
+		opts.progress_socket = req->progress_socket;
+
 	return 0;
 }
 
@@ -276,6 +283,16 @@ err:
 	return -1;
 }
 
+static void report_worker(pid_t pid, int status)
+{
+	if (WIFEXITED(status))
+		pr_info("Worker(pid %d) exited with %d\n",
+			pid, WEXITSTATUS(status));
+	else if (WIFSIGNALED(status))
+		pr_info("Worker(pid %d) was killed by %d\n",
+			pid, WTERMSIG(status));
+}
+
 static void reap_worker(int signo)
 {
 	int saved_errno;
@@ -296,12 +313,7 @@ static void reap_worker(int signo)
 			return;
 		}
 
-		if (WIFEXITED(status))
-			pr_info("Worker(pid %d) exited with %d\n",
-				pid, WEXITSTATUS(status));
-		else if (WIFSIGNALED(status))
-			pr_info("Worker(pid %d) was killed by %d\n",
-				pid, WTERMSIG(status));
+		report_worker(pid, status);
 	}
 }
 
@@ -339,6 +351,98 @@ static int restore_sigchld_handler()
 	return 0;
 }
 
+/*
+ * Probe the kernel and the cpu once, workers are forked from
+ * the service and get the results for free. If something fails
+ * here, workers will just probe it again themselves.
+ */
+static void cr_service_prepare(void)
+{
+	if (kerndat_init() || kerndat_init_rst() ||
+	    cpu_init() || vdso_init())
+		pr_warn("Can't cache kernel data in service\n");
+}
+
+static void cr_service_worker(int server_fd, pid_t service_pid)
+{
+	struct sockaddr_un client_addr;
+	socklen_t client_addr_len = sizeof(client_addr);
+	int sk, ret;
+
+	/*
+	 * Nobody would replace us if the service dies, so don't
+	 * keep taking requests from its socket then.
+	 */
+	if (prctl(PR_SET_PDEATHSIG, SIGKILL)) {
+		pr_perror("Can't set parent death signal");
+		exit(1);
+	}
+
+	if (getppid() != service_pid) {
+		pr_err("Service has died already\n");
+		exit(1);
+	}
+
+	sk = accept(server_fd, &client_addr, &client_addr_len);
+	if (sk == -1) {
+		pr_perror("Can't accept connection");
+		exit(1);
+	}
+
+	/* The request is ours now, finish it whatever happens */
+	if (prctl(PR_SET_PDEATHSIG, 0)) {
+		pr_perror("Can't reset parent death signal");
+		exit(1);
+	}
+
+	pr_info("Connected.\n");
+	close(server_fd);
+	ret = cr_service_work(sk);
+	close(sk);
+	exit(ret != 0);
+}
+
+/*
+ * Keep opts.service_workers workers waiting in accept. Each one
+ * serves a single request (criu state is not reusable) and is
+ * replaced by a fresh one once it exits.
+ */
+static int cr_service_pool(int server_fd)
+{
+	pid_t service_pid = getpid();
+	int nr_workers = 0;
+
+	while (1) {
+		int status;
+		pid_t pid;
+
+		while (nr_workers < opts.service_workers) {
+			pid = fork();
+			if (pid == 0)
+				cr_service_worker(server_fd, service_pid);
+			if (pid < 0) {
+				pr_perror("Can't fork a worker");
+				break;
+			}
+			nr_workers++;
+		}
+
+		if (nr_workers == 0)
+			return -1;
+
+		pid = waitpid(-1, &status, 0);
+		if (pid == -1) {
+			if (errno == EINTR)
+				continue;
+			pr_perror("Can't wait for workers");
+			return -1;
+		}
+
+		report_worker(pid, status);
+		nr_workers--;
+	}
+}
+
 int cr_service(bool daemon_mode)
 {
 	int server_fd = -1, n;
@@ -412,6 +516,13 @@ int cr_service(bool daemon_mode)
 		}
 	}
 
+	cr_service_prepare();
+
+	if (opts.service_workers) {
+		cr_service_pool(server_fd);
+		goto err;
+	}
+
 	if (setup_sigchld_handler())
 		goto err;
 
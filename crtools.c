@@ -34,6 +34,8 @@
 #include "file-lock.h"
 #include "cr-service.h"
 #include "plugin.h"
+#include "uffd.h"
+#include "compress.h"
 
 struct cr_options opts;
 
@@ -134,6 +136,17 @@ int main(int argc, char *argv[])
 			{ "ms", no_argument, 0, 54},
 			{ "track-mem", no_argument, 0, 55},
 			{ "auto-dedup", no_argument, 0, 56},
+			{ "mmap-pages", no_argument, 0, 57},
+			{ "lazy-pages", no_argument, 0, 58},
+			{ "dump-jobs", required_argument, 0, 59},
+			{ "compress", no_argument, 0, 60},
+			{ "pre-dump-iters", required_argument, 0, 61},
+			{ "pre-dump-converge", required_argument, 0, 62},
+			{ "pre-dump-time", required_argument, 0, 63},
+			{ "archive", no_argument, 0, 64},
+			{ "log-buffered", no_argument, 0, 65},
+			{ "progress-socket", required_argument, 0, 66},
+			{ "workers", required_argument, 0, 67},
 			{ "libdir", required_argument, 0, 'L'},
 			{ },
 		};
@@ -280,6 +293,93 @@ int main(int argc, char *argv[])
 		case 56:
 			opts.auto_dedup = true;
 			break;
+		case 57:
+			opts.mmap_pages = true;
+			break;
+		case 58:
+			opts.lazy_pages = true;
+			break;
+		case 59: {
+			char *end;
+			long nr;
+
+			nr = strtol(optarg, &end, 10);
+			if (*end || nr <= 0 || nr > DUMP_MAX_JOBS) {
+				pr_err("Bad number of dump jobs %s, should be 1..%d\n",
+						optarg, DUMP_MAX_JOBS);
+				return 1;
+			}
+			opts.dump_jobs = nr;
+			break;
+		}
+		case 60:
+			if (!compress_supported()) {
+				pr_err("Compression is not supported\n");
+				return 1;
+			}
+			opts.compress = true;
+			break;
+		case 61: {
+			char *end;
+			long nr;
+
+			nr = strtol(optarg, &end, 10);
+			if (*end || nr <= 0 || nr > PRE_DUMP_MAX_ITERS) {
+				pr_err("Bad number of pre-dump iterations %s, should be 1..%d\n",
+						optarg, PRE_DUMP_MAX_ITERS);
+				return 1;
+			}
+			opts.pre_dump_iters = nr;
+			break;
+		}
+		case 62: {
+			char *end;
+			long nr;
+
+			errno = 0;
+			nr = strtol(optarg, &end, 0);
+			if (end == optarg || *end || errno || nr < 0) {
+				pr_err("Bad number of pre-dump converge pages %s\n", optarg);
+				return 1;
+			}
+			opts.pre_dump_converge = nr;
+			break;
+		}
+		case 63: {
+			char *end;
+			long nr;
+
+			errno = 0;
+			nr = strtol(optarg, &end, 10);
+			if (end == optarg || *end || errno || nr < 0 || nr > INT_MAX) {
+				pr_err("Bad pre-dump time %s\n", optarg);
+				return 1;
+			}
+			opts.pre_dump_time = nr;
+			break;
+		}
+		case 64:
+			opts.archive = true;
+			break;
+		case 65:
+			opts.log_buffered = true;
+			break;
+		case 66:
+			opts.progress_socket = optarg;
+			break;
+		case 67: {
+			char *end;
+			long nr;
+
+			nr = strtol(optarg, &end, 10);
+			if (*end || nr <= 0 || nr > SERVICE_MAX_WORKERS) {
+				pr_err("Bad number of workers %s, should be 1..%d\n",
+						optarg, SERVICE_MAX_WORKERS);
+				return 1;
+			}
+			opts.service_workers = nr;
+			break;
+		}
 		case 54:
 			opts.check_ms_kernel = true;
 			break;
@@ -345,6 +445,11 @@ int main(int argc, char *argv[])
 			opts.final_state = TASK_ALIVE;
 		}
 
+		if (opts.pre_dump_iters > 1 && opts.use_page_server) {
+			pr_err("Iterative pre-dump doesn't work with page server\n");
+			return 1;
+		}
+
 		return cr_pre_dump_tasks(tree_id) != 0;
 	}
 
@@ -374,6 +479,9 @@ int main(int argc, char *argv[])
 	if (!strcmp(argv[optind], "service"))
 		return cr_service(opts.restore_detach);
 
+	if (!strcmp(argv[optind], "lazy-pages"))
+		return cr_lazy_pages(opts.restore_detach) != 0;
+
 	if (!strcmp(argv[optind], "dedup"))
 		return cr_dedup() != 0;
 
@@ -388,6 +496,7 @@ usage:
 "  criu exec -p PID <syscall-string>\n"
 "  criu page-server\n"
 "  criu service [<options>]\n"
+"  criu lazy-pages [<options>]\n"
 "  criu dedup\n"
 "\n"
 "Commands:\n"
@@ -399,6 +508,7 @@ usage:
 "  exec           execute a system call by other task\n"
 "  page-server    launch page server\n"
 "  service        launch service\n"
+"  lazy-pages     launch lazy pages daemon for restore\n"
 "  dedup          remove duplicates in memory dump\n"
 	);
 
@@ -416,9 +526,13 @@ usage:
 "  -s|--leave-stopped    leave tasks in stopped state after checkpoint\n"
 "  -R|--leave-running    leave tasks in running state after checkpoint\n"
 "  -D|--images-dir DIR   directory for image files\n"
-"     --pidfile FILE     write root task, service or page-server pid to FILE\n"
+"     --archive          put images into single archive.img file on dump\n"
+"     --pidfile FILE     write root task, service, page-server or lazy-pages\n"
+"                        pid to FILE\n"
 "  -W|--work-dir DIR     directory to cd and write logs/pidfiles/stats to\n"
 "                        (if not specified, value of --images-dir is used)\n"
+"     --progress-socket PATH\n"
+"                        report dump/restore progress on unix socket PATH\n"
 "\n"
 "* Special resources support:\n"
 "  -x|--" USK_EXT_PARAM "      allow external unix connections\n"
@@ -436,6 +550,7 @@ usage:
 "* Logging:\n"
 "  -o|--log-file FILE    log file name\n"
 "     --log-pid          enable per-process logging to separate FILE.pid files\n"
+"     --log-buffered     buffer log messages, write them out on errors and exit\n"
 "  -v[NUM]               set logging level:\n"
 "                          -v0        - messages regardless of log level\n"
 "                          -v1, -v    - errors, when we are in trouble\n"
@@ -447,11 +562,24 @@ usage:
 "  --track-mem           turn on memory changes tracker in kernel\n"
 "  --prev-images-dir DIR path to images from previous dump (relative to -D)\n"
 "  --page-server         send pages to page server (see options below as well)\n"
+"  --dump-jobs NUM       write pages of up to NUM tasks into images in parallel\n"
+"  --compress            compress pages images\n"
+"  --pre-dump-iters NUM  do up to NUM pre-dump iterations, each one into\n"
+"                        its own sub-directory of images dir\n"
+"  --pre-dump-converge PAGES\n"
+"                        stop iterating when no more than PAGES pages\n"
+"                        were dirtied since previous iteration\n"
+"  --pre-dump-time SEC   stop iterating after SEC seconds\n"
+"  --mmap-pages          map pages images on restore instead of reading\n"
+"                        inherited pages into a buffer\n"
+"  --lazy-pages          restore anonymous memory on demand from the\n"
+"                        lazy-pages daemon running in the work dir\n"
 "\n"
 "Page/Service server options:\n"
 "  --address ADDR        address of server or service\n"
 "  --port PORT           port of page server\n"
 "  -d|--daemon           run in the background after creating socket\n"
+"  --workers NUM         keep NUM service workers forked in advance\n"
 "\n"
 "Show options:\n"
 "  -f|--file FILE        show contents of a checkpoint file\n"
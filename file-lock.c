@@ -92,8 +92,51 @@ err:
 	return -1;
 }
 
-static int get_fd_by_ino(unsigned long i_no, struct parasite_drain_fd *dfds,
-			pid_t pid)
+/*
+ * Inodes of the task's fds to find which fd a lock is on. They
+ * are noted while the files are dumped, or stat-ed via /proc if
+ * the fd table is dumped with another task.
+ */
+struct fd_ino {
+	unsigned long	ino;
+	int		fd;
+};
+
+static struct fd_ino *fd_inos;
+static int nr_fd_inos, fd_inos_size;
+static bool fd_inos_noted;
+
+int note_file_lock_fd(int fd, const struct stat *st)
+{
+	if (!opts.handle_file_locks)
+		return 0;
+
+	if (nr_fd_inos == fd_inos_size) {
+		fd_inos_size = fd_inos_size ? fd_inos_size * 2 : 64;
+		fd_inos = xrealloc(fd_inos, fd_inos_size * sizeof(*fd_inos));
+		if (!fd_inos) {
+			nr_fd_inos = fd_inos_size = 0;
+			return -1;
+		}
+	}
+
+	fd_inos[nr_fd_inos].ino = st->st_ino;
+	fd_inos[nr_fd_inos].fd = fd;
+	nr_fd_inos++;
+	fd_inos_noted = true;
+
+	return 0;
+}
+
+static void forget_fd_inos(void)
+{
+	xfree(fd_inos);
+	fd_inos = NULL;
+	nr_fd_inos = fd_inos_size = 0;
+	fd_inos_noted = false;
+}
+
+static int stat_fd_inos(struct parasite_drain_fd *dfds, pid_t pid)
 {
 	int  i;
 	char buf[PATH_MAX];
@@ -108,11 +151,46 @@ static int get_fd_by_ino(unsigned long i_no, struct parasite_drain_fd *dfds,
 			continue;
 		}
 
-		if (fd_stat.st_ino == i_no)
-			return dfds->fds[i];
+		if (note_file_lock_fd(dfds->fds[i], &fd_stat))
+			return -1;
 	}
 
-	return -1;
+	return 0;
+}
+
+static int cmp_fd_ino(const void *a, const void *b)
+{
+	const struct fd_ino *x = a, *y = b;
+
+	if (x->ino != y->ino)
+		return x->ino < y->ino ? -1 : 1;
+
+	return x->fd - y->fd;
+}
+
+static int cmp_ino(const void *a, const void *b)
+{
+	const struct fd_ino *x = a, *y = b;
+
+	if (x->ino != y->ino)
+		return x->ino < y->ino ? -1 : 1;
+
+	return 0;
+}
+
+/* The lowest fd on the inode, fd_inos are sorted */
+static int get_fd_by_ino(unsigned long i_no)
+{
+	struct fd_ino key = { .ino = i_no }, *fi;
+
+	fi = bsearch(&key, fd_inos, nr_fd_inos, sizeof(*fd_inos), cmp_ino);
+	if (!fi)
+		return -1;
+
+	while (fi > fd_inos && (fi - 1)->ino == i_no)
+		fi--;
+
+	return fi->fd;
 }
 
 int dump_task_file_locks(struct parasite_ctl *ctl,
@@ -124,7 +202,21 @@ int dump_task_file_locks(struct parasite_ctl *ctl,
 	pid_t	pid = ctl->pid.real;
 	int	ret = 0;
 
-	list_for_each_entry(fl, &file_lock_list, list) {
+	list_for_each_entry(fl, &file_lock_list, list)
+		if (fl->fl_owner == pid)
+			break;
+
+	if (&fl->list == &file_lock_list)
+		goto err;
+
+	if (!fd_inos_noted && stat_fd_inos(dfds, pid)) {
+		ret = -1;
+		goto err;
+	}
+
+	qsort(fd_inos, nr_fd_inos, sizeof(*fd_inos), cmp_fd_ino);
+
+	list_for_each_entry_from(fl, &file_lock_list, list) {
 		if (fl->fl_owner != pid)
 			continue;
 		pr_info("lockinfo: %lld:%s %s %s %d %02x:%02x:%ld %lld %s\n",
@@ -140,8 +232,9 @@ int dump_task_file_locks(struct parasite_ctl *ctl,
 		if (ret)
 			goto err;
 
-		fle.fd = get_fd_by_ino(fl->i_no, dfds, pid);
+		fle.fd = get_fd_by_ino(fl->i_no);
 		if (fle.fd < 0) {
+			pr_err("Can't find fd for lock on %ld\n", fl->i_no);
 			ret = -1;
 			goto err;
 		}
@@ -161,6 +254,7 @@ int dump_task_file_locks(struct parasite_ctl *ctl,
 	}
 
 err:
+	forget_fd_inos();
 	return ret;
 }
 
@@ -14,6 +14,7 @@
 #include <stdlib.h>
 
 #include "files.h"
+#include "stats.h"
 #include "file-ids.h"
 #include "files-reg.h"
 #include "image.h"
@@ -33,6 +34,7 @@
 #include "namespaces.h"
 #include "tun.h"
 #include "fdset.h"
+#include "file-lock.h"
 
 #include "parasite.h"
 #include "parasite-syscall.h"
@@ -170,8 +172,11 @@ int do_dump_gen_file(struct fd_parms *p, int lfd,
 	e.flags = p->fd_flags;
 
 	ret = fd_id_generate(p->pid, &e);
-	if (ret == 1) /* new ID generated */
+	if (ret == 1) { /* new ID generated */
+		fd_timing_start();
 		ret = ops->dump(lfd, e.id, p);
+		fd_timing_stop(ops->type);
+	}
 
 	if (ret < 0)
 		return ret;
@@ -306,6 +311,9 @@ static int dump_one_file(struct parasite_ctl *ctl, int fd, int lfd, struct fd_op
 		return -1;
 	}
 
+	if (note_file_lock_fd(fd, &p.stat))
+		return -1;
+
 	if (S_ISSOCK(p.stat.st_mode))
 		return dump_socket(&p, lfd, fdinfo);
 
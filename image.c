@@ -4,6 +4,7 @@
 #include "crtools.h"
 #include "cr_options.h"
 #include "fdset.h"
+#include "archive.h"
 #include "image.h"
 #include "pstree.h"
 #include "stats.h"
@@ -192,6 +193,12 @@ int open_image_at(int dfd, int type, unsigned long flags, ...)
 	vsnprintf(path, PATH_MAX, fdset_template[type].fmt, args);
 	va_end(args);
 
+	ret = archive_open_image(dfd, type, path, flags);
+	if (ret >= 0)
+		goto opened;
+	if (ret != -ENOENT)
+		goto err;
+
 	if (flags & O_EXCL) {
 		ret = unlinkat(dfd, path, 0);
 		if (ret && errno != ENOENT) {
@@ -206,6 +213,7 @@ int open_image_at(int dfd, int type, unsigned long flags, ...)
 		goto err;
 	}
 
+opened:
 	if (fdset_template[type].magic == RAW_IMAGE_MAGIC)
 		goto skip_magic;
 
@@ -229,6 +237,197 @@ err:
 	return -1;
 }
 
+/*
+ * Starts reading a file into page cache and doesn't wait for it.
+ * Missing files are not an error, whoever opens the image later
+ * will complain.
+ */
+void prefetch_file(int dfd, const char *path)
+{
+	int fd;
+
+	fd = openat(dfd, path, O_RDONLY);
+	if (fd < 0)
+		return;
+
+	posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+	close(fd);
+}
+
+void prefetch_image_at(int dfd, int type, ...)
+{
+	char path[PATH_MAX];
+	va_list args;
+
+	va_start(args, type);
+	vsnprintf(path, PATH_MAX, fdset_template[type].fmt, args);
+	va_end(args);
+
+	prefetch_file(dfd, path);
+}
+
+#define IMG_BUF_SIZE	(64 << 10)
+
+struct img_buf {
+	bool		dump;		/* write-behind, otherwise read-ahead */
+	size_t		pos;		/* read position or bytes to write */
+	size_t		len;		/* bytes read ahead */
+	char		data[IMG_BUF_SIZE];
+};
+
+static struct img_buf **img_bufs;
+static int nr_img_bufs;
+
+static struct img_buf *img_buf_get(int fd)
+{
+	if (fd < 0 || fd >= nr_img_bufs)
+		return NULL;
+
+	return img_bufs[fd];
+}
+
+int img_buf_attach(int fd, unsigned long flags)
+{
+	struct img_buf *ib;
+
+	if (fd >= nr_img_bufs) {
+		if (xrealloc_safe(&img_bufs, (fd + 1) * sizeof(*img_bufs)))
+			return -1;
+
+		memzero(img_bufs + nr_img_bufs,
+				(fd + 1 - nr_img_bufs) * sizeof(*img_bufs));
+		nr_img_bufs = fd + 1;
+	}
+
+	/* The fd was closed with plain close() and reused */
+	ib = img_bufs[fd];
+	if (!ib) {
+		ib = xmalloc(sizeof(*ib));
+		if (!ib)
+			return -1;
+		img_bufs[fd] = ib;
+	}
+
+	ib->dump = flags != O_RSTR;
+	ib->pos = 0;
+	ib->len = 0;
+
+	return 0;
+}
+
+ssize_t img_buf_read(int fd, void *buf, size_t len)
+{
+	struct img_buf *ib = img_buf_get(fd);
+	size_t done = 0;
+
+	if (!ib || ib->dump)
+		return read(fd, buf, len);
+
+	while (done < len) {
+		size_t n;
+
+		if (ib->pos == ib->len) {
+			ssize_t ret;
+
+			ib->pos = ib->len = 0;
+
+			/* Big reads go right into the caller's buffer */
+			if (len - done >= IMG_BUF_SIZE) {
+				ret = read(fd, buf + done, len - done);
+				if (ret < 0)
+					return -1;
+				if (ret == 0)
+					break;
+				done += ret;
+				continue;
+			}
+
+			ret = read(fd, ib->data, IMG_BUF_SIZE);
+			if (ret < 0)
+				return -1;
+			if (ret == 0)
+				break;
+			ib->len = ret;
+		}
+
+		n = min(len - done, ib->len - ib->pos);
+		memcpy(buf + done, ib->data + ib->pos, n);
+		ib->pos += n;
+		done += n;
+	}
+
+	return done;
+}
+
+ssize_t img_buf_write(int fd, const void *buf, size_t len)
+{
+	struct img_buf *ib = img_buf_get(fd);
+
+	if (!ib || !ib->dump)
+		return write(fd, buf, len);
+
+	if (ib->pos + len > IMG_BUF_SIZE && img_buf_flush(fd))
+		return -1;
+
+	if (len >= IMG_BUF_SIZE)
+		return write(fd, buf, len);
+
+	memcpy(ib->data + ib->pos, buf, len);
+	ib->pos += len;
+
+	return len;
+}
+
+/*
+ * Writes out the write-behind data, or moves the file position
+ * back to where the reader is for read-ahead.
+ */
+int img_buf_flush(int fd)
+{
+	struct img_buf *ib = img_buf_get(fd);
+
+	if (!ib)
+		return 0;
+
+	if (ib->dump) {
+		size_t off = 0;
+
+		while (off < ib->pos) {
+			ssize_t ret;
+
+			ret = write(fd, ib->data + off, ib->pos - off);
+			if (ret <= 0) {
+				pr_perror("Can't write image buffer");
+				return -1;
+			}
+			off += ret;
+		}
+	} else if (ib->pos < ib->len) {
+		if (lseek(fd, (off_t)ib->pos - (off_t)ib->len, SEEK_CUR) < 0) {
+			pr_perror("Can't rewind image");
+			return -1;
+		}
+	}
+
+	ib->pos = ib->len = 0;
+	return 0;
+}
+
+int close_image(int fd)
+{
+	struct img_buf *ib = img_buf_get(fd);
+	int ret = 0;
+
+	if (ib) {
+		ret = img_buf_flush(fd);
+		img_bufs[fd] = NULL;
+		xfree(ib);
+	}
+
+	close(fd);
+	return ret;
+}
+
 int open_image_dir(char *dir)
 {
 	int fd, ret;
@@ -261,9 +460,14 @@ int open_image_dir(char *dir)
 		ret = install_service_fd(PARENT_FD_OFF, pfd);
 
 		close(pfd);
+		if (ret < 0)
+			goto err;
 	}
 
-	return ret;
+	if (archive_load(fd))
+		goto err;
+
+	return fd;
 
 err:
 	close_image_dir();
@@ -272,23 +476,42 @@ err:
 
 void close_image_dir(void)
 {
+	close_service_fd(IMG_ARCHIVE_FD_OFF);
 	close_service_fd(IMG_FD_OFF);
 }
 
-static unsigned long page_ids = 1;
+/*
+ * Page image IDs are 32-bit both in images and in file names,
+ * they must not wrap and overwrite existing pages images.
+ */
+static u64 page_ids = 1;
+static u64 page_ids_end = 1ULL << 32;
+
+#define PAGE_IDS_STEP	0x10000
 
-void up_page_ids_base(void)
+int up_page_ids_base(void)
 {
+	u64 base = (page_ids & ~(PAGE_IDS_STEP - 1)) + PAGE_IDS_STEP;
+
 	/*
 	 * When page server and criu dump work on
 	 * the same dir, the shmem pagemaps and regular
 	 * pagemaps may have IDs conflicts. Fix this by
 	 * making page server produce page images with
 	 * higher IDs.
+	 *
+	 * Page server calls this for every connection
+	 * it serves, so that each one gets its own range.
 	 */
 
-	BUG_ON(page_ids != 1);
-	page_ids += 0x10000;
+	if (base + PAGE_IDS_STEP > (1ULL << 32)) {
+		pr_err("Out of page image IDs\n");
+		return -1;
+	}
+
+	page_ids = base + 1;
+	page_ids_end = base + PAGE_IDS_STEP;
+	return 0;
 }
 
 int open_pages_image_at(int dfd, unsigned long flags, int pm_fd)
@@ -303,6 +526,12 @@ int open_pages_image_at(int dfd, unsigned long flags, int pm_fd)
 		pagemap_head__free_unpacked(h, NULL);
 	} else {
 		PagemapHead h = PAGEMAP_HEAD__INIT;
+
+		if (page_ids >= page_ids_end) {
+			pr_err("Out of page image IDs\n");
+			return -1;
+		}
+
 		id = h.pages_id = page_ids++;
 		if (pb_write_one(pm_fd, &h, PB_PAGEMAP_HEAD) < 0)
 			return -1;
@@ -0,0 +1,50 @@
+#ifndef __CR_ARCHIVE_H__
+#define __CR_ARCHIVE_H__
+
+#include <stdbool.h>
+
+#include "asm/types.h"
+
+/*
+ * Archive images.
+ *
+ * With --archive the dump puts most of the images into one file
+ * instead of tens of small files per task. The archive is
+ *
+ *   u32 magic
+ *   images contents, one after another
+ *   archive_entry + name for every image (the index)
+ *   archive_tail
+ *
+ * Images are written into memfds and are appended to the archive
+ * once nobody has them open (see archive_sync), the index goes at
+ * the end on archive_close. On restore (and show) the index is
+ * read on open_image_dir and open_image_at copies an image into
+ * a memfd, so the rest of criu sees the usual image fd.
+ *
+ * Big and raw images (pages, ghost files, tarballs, ip tools
+ * output) and stats are never archived.
+ */
+
+#define CR_ARCHIVE_NAME		"archive.img"
+
+struct archive_entry {
+	u64	off;
+	u64	len;
+	u32	name_len;
+} __attribute__((packed));
+
+struct archive_tail {
+	u64	index_off;
+	u32	nr_entries;
+	u32	magic;
+} __attribute__((packed));
+
+extern int archive_open_image(int dfd, int type, const char *path,
+		unsigned long flags);
+extern int archive_load(int dfd);
+extern int archive_start(void);
+extern int archive_sync(void);
+extern int archive_close(bool ok);
+
+#endif /* __CR_ARCHIVE_H__ */
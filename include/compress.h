@@ -0,0 +1,30 @@
+#ifndef __CR_COMPRESS_H__
+#define __CR_COMPRESS_H__
+
+#include <stdbool.h>
+
+#include "asm/types.h"
+
+/*
+ * Compressed pages images.
+ *
+ * With --compress every pagemap entry covers at most
+ * COMPRESS_CHUNK_PAGES pages, which are compressed as one
+ * chunk, and the entry's comp_len tells the chunk size in
+ * pages image. Thus the pagemap is the index of chunks and
+ * any page can be got by decompressing one chunk only.
+ *
+ * A chunk with comp_len equal to the pages size is stored
+ * as is, since it didn't compress.
+ */
+
+#define COMPRESS_CHUNK_PAGES	16
+#define COMPRESS_CHUNK_SIZE	(COMPRESS_CHUNK_PAGES * PAGE_SIZE)
+
+extern bool compress_supported(void);
+extern unsigned long compress_bound(unsigned long len);
+extern long compress_pages(void *src, unsigned long len, void *dst);
+extern int read_compressed_pages(int fd, void *zbuf, unsigned long comp_len,
+		void *buf, unsigned long len);
+
+#endif /* __CR_COMPRESS_H__ */
@@ -0,0 +1,7 @@
+#ifndef __CR_CONFIG_H__
+#define __CR_CONFIG_H__
+#define CONFIG_HAS_TCP_REPAIR
+#define CONFIG_HAS_PRLIMIT
+#define CONFIG_HAS_UFFD
+#define CONFIG_HAS_ZLIB
+#endif /* __CR_CONFIG_H__ */
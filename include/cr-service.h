@@ -3,6 +3,8 @@
 
 #include "protobuf/rpc.pb-c.h"
 
+#define SERVICE_MAX_WORKERS	256
+
 extern int cr_service(bool deamon_mode);
 
 extern int send_criu_dump_resp(int socket_fd, bool success, bool restored);
@@ -25,6 +25,7 @@ struct cr_options {
 	bool			link_remap_ok;
 	unsigned int		rst_namespaces_flags;
 	bool			log_file_per_pid;
+	bool			log_buffered;
 	char			*output;
 	char			*root;
 	char			*pidfile;
@@ -37,6 +38,16 @@ struct cr_options {
 	bool			track_mem;
 	char			*img_parent;
 	bool			auto_dedup;
+	bool			mmap_pages;
+	bool			lazy_pages;
+	unsigned int		dump_jobs;
+	bool			compress;
+	unsigned int		pre_dump_iters;
+	unsigned long		pre_dump_converge;
+	unsigned int		pre_dump_time;
+	bool			archive;
+	char			*progress_socket;
+	unsigned int		service_workers;
 };
 
 extern struct cr_options opts;
@@ -17,6 +17,9 @@ extern void kill_inventory(void);
 
 extern int cr_dump_tasks(pid_t pid);
 extern int cr_pre_dump_tasks(pid_t pid);
+
+/* Each pre-dump iteration leaves a full set of images behind */
+#define PRE_DUMP_MAX_ITERS	64
 extern int cr_restore_tasks(void);
 extern int cr_show(int pid);
 extern int convert_to_elf(char *elf_path, int fd_core);
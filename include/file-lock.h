@@ -49,6 +49,8 @@ extern struct file_lock *alloc_file_lock(void);
 extern void free_file_locks(void);
 struct parasite_ctl;
 struct parasite_drain_fd;
+struct stat;
+extern int note_file_lock_fd(int fd, const struct stat *st);
 extern int dump_task_file_locks(struct parasite_ctl *ctl,
 			struct cr_fdset *fdset,	struct parasite_drain_fd *dfds);
 
@@ -50,6 +50,7 @@
 
 #define VMA_AREA_SYSVIPC	(1 <<  10)
 #define VMA_AREA_SOCKET		(1 <<  11)
+#define VMA_AREA_LAZY		(1 <<  12)	/* Pages come from lazy-pages daemon */
 
 #define CR_CAP_SIZE	2
 
@@ -74,8 +75,25 @@ extern void close_image_dir(void);
 
 extern int open_image_at(int dfd, int type, unsigned long flags, ...);
 #define open_image(typ, flags, ...) open_image_at(get_service_fd(IMG_FD_OFF), typ, flags, ##__VA_ARGS__)
+
+extern void prefetch_file(int dfd, const char *path);
+extern void prefetch_image_at(int dfd, int type, ...);
+
+/*
+ * Buffered image streams. Images with lots of small entries can
+ * have a buffer attached, then pb_read_one-s read ahead and
+ * pb_write_one-s are written out by big pieces. Any other I/O on
+ * such an image (read_img, splice, lseek, etc.) must be preceded
+ * by img_buf_flush, and the image must be closed with close_image.
+ */
+extern int img_buf_attach(int fd, unsigned long flags);
+extern ssize_t img_buf_read(int fd, void *buf, size_t len);
+extern ssize_t img_buf_write(int fd, const void *buf, size_t len);
+extern int img_buf_flush(int fd);
+extern int close_image(int fd);
+
 extern int open_pages_image(unsigned long flags, int pm_fd);
 extern int open_pages_image_at(int dfd, unsigned long flags, int pm_fd);
-extern void up_page_ids_base(void);
+extern int up_page_ids_base(void);
 
 #endif /* __CR_IMAGE_H__ */
@@ -14,6 +14,9 @@ extern int kerndat_get_dirty_track(void);
 
 extern dev_t kerndat_shmem_dev;
 extern bool kerndat_has_dirty_track;
+extern bool kerndat_has_uffd;
+extern bool kerndat_has_clone3_set_tid;
+extern u64 kerndat_zero_page_pfn;
 
 extern int tcp_max_wshare;
 extern int tcp_max_rshare;
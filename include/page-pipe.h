@@ -15,7 +15,10 @@
  *
  * A hole is a pagemap entry that doesn't have pages
  * in it, since they are present in previous (parent)
- * snapshot.
+ * snapshot (PP_HOLE_PARENT), or are all zeroes
+ * (PP_HOLE_ZERO). The latter ones are written into
+ * pagemap with the zero flag set and are just left
+ * untouched (or zeroed) on restore.
  *
  *
  * This page-pipe vs holes vs task vmem vs image layout
@@ -74,27 +77,43 @@ struct page_pipe_buf {
 	unsigned int pipe_size;	/* how many pages can be fit into pipe */
 	unsigned int pages_in;	/* how many pages are there */
 	unsigned int nr_segs;	/* how many iov-s are busy */
-	struct iovec *iov;	/* vaddr:len map */
+	unsigned int nr_iovs;	/* how many iov-s are allocated */
+	struct iovec *iov;	/* vaddr:len map, up to UIO_MAXIOV */
 	struct list_head l;	/* links into page_pipe->bufs */
 };
 
+/*
+ * In chunk mode a page-pipe has at most NR_PIPES_PER_CHUNK pipes. When
+ * they are full, adding a page fails with -EAGAIN, the caller should
+ * then drain the pipes into an image and call page_pipe_reinit() to
+ * go on with the next chunk of memory.
+ */
+#define PP_CHUNK_MODE		0x1
+#define NR_PIPES_PER_CHUNK	8
+#define PPB_CHUNK_PAGES		256	/* pipes don't grow beyond this */
+
 struct page_pipe {
+	unsigned int flags;	/* PP_* flags */
 	unsigned int nr_pipes;	/* how many page_pipe_bufs in there */
 	struct list_head bufs;	/* list of bufs */
-	unsigned int nr_iovs;	/* number of iovs */
-	unsigned int free_iov;	/* first free iov */
-	struct iovec *iovs;	/* iovs. They are provided into create_page_pipe
-				   and all bufs have their iov-s in there */
+	struct list_head free_bufs; /* drained bufs to be reused */
 
 	unsigned int nr_holes;	/* number of holes allocated */
 	unsigned int free_hole;	/* number of holes in use */
 	struct iovec *holes;	/* holes */
+	unsigned int *hole_flags; /* PP_HOLE_* flags of holes */
 };
 
-extern struct page_pipe *create_page_pipe(unsigned int nr, struct iovec *);
+#define PP_HOLE_PARENT		0x1
+#define PP_HOLE_ZERO		0x2
+
+
+extern struct page_pipe *create_page_pipe(unsigned int flags);
 extern void destroy_page_pipe(struct page_pipe *p);
+extern void page_pipe_reinit(struct page_pipe *pp);
 extern int page_pipe_add_page(struct page_pipe *p, unsigned long addr);
-extern int page_pipe_add_hole(struct page_pipe *p, unsigned long addr);
+extern int page_pipe_add_hole(struct page_pipe *p, unsigned long addr,
+		unsigned int flags);
 
 extern void debug_show_page_pipe(struct page_pipe *pp);
 
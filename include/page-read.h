@@ -38,6 +38,18 @@
  * skip pages from pages.img where appropriate.
  *
  * All this is implemented in read_pagemap_page.
+ *
+ * Zero pagemap entries have no pages in the image, the pages
+ * are just zeroed on read.
+ *
+ * Compressed pagemap entries (see compress.h) are read and
+ * decompressed as a whole the first time any of their pages
+ * is needed, skipping them doesn't touch the pages image.
+ *
+ * Pages are read in runs -- the caller asks for nr pages starting
+ * at vaddr and the engine issues one read() for the part that sits
+ * in its own pages.img, and splits the rest into the longest pieces
+ * the parent page_read-s can serve.
  */
 
 struct page_read {
@@ -46,8 +58,19 @@ struct page_read {
 	 * Pagemap entries should be returned in sorted order.
 	 */
 	int (*get_pagemap)(struct page_read *, struct iovec *iov);
-	/* reads page from current pagemap */
-	int (*read_page)(struct page_read *, unsigned long vaddr, void *);
+	/*
+	 * reads nr pages starting from vaddr from current pagemap,
+	 * the vaddr:nr range must not cross its end
+	 */
+	int (*read_pages)(struct page_read *, unsigned long vaddr, int nr, void *);
+	/*
+	 * points *ptr to the mapped page image for up to nr pages
+	 * starting from vaddr and returns how many of them are there,
+	 * set only after map_page_read()
+	 */
+	int (*peek_pages)(struct page_read *, unsigned long vaddr, int nr, void **ptr);
+	/* skips len bytes of the current pagemap without reading them */
+	void (*skip_pages)(struct page_read *, unsigned long len);
 	/* stop working on current pagemap */
 	void (*put_pagemap)(struct page_read *);
 	void (*close)(struct page_read *);
@@ -63,12 +86,20 @@ struct page_read {
 					   read_pagemap_page */
 	unsigned long cvaddr;		/* vaddr we are on */
 
+	void *pg_map;			/* pages image mapping (if any) */
+	size_t pg_map_len;
+
+	void *chunk;			/* decompressed pages of current */
+	bool chunk_loaded;		/* pagemap, if it has comp_len */
+	void *zchunk;			/* and a buffer to read them in */
+
 	unsigned id; /* for logging */
 };
 
 extern int open_page_read(int pid, struct page_read *);
 extern int open_page_read_at(int dfd, int pid, struct page_read *pr, int flags);
 extern int open_page_rw(int pid, struct page_read *);
+extern int map_page_read(struct page_read *pr);
 extern void pagemap2iovec(PagemapEntry *pe, struct iovec *iov);
 extern int seek_pagemap_page(struct page_read *pr, unsigned long vaddr, bool warn);
 
@@ -15,8 +15,8 @@ struct page_xfer {
 	int (*write_pagemap)(struct page_xfer *self, struct iovec *iov);
 	/* transfers pages related to previous pagemap */
 	int (*write_pages)(struct page_xfer *self, int pipe, unsigned long len);
-	/* transfers one hole -- vaddr:len entry w/o pages */
-	int (*write_hole)(struct page_xfer *self, struct iovec *iov);
+	/* transfers one hole -- vaddr:len entry w/o pages (PP_HOLE_* flags) */
+	int (*write_hole)(struct page_xfer *self, struct iovec *iov, unsigned int flags);
 	void (*close)(struct page_xfer *self);
 
 	/* private data for every page-xfer engine */
@@ -26,12 +26,19 @@ struct page_xfer {
 		u64 dst_id;
 	};
 	struct page_read *parent;
+	struct page_xfer_comp *comp;
 };
 
 extern int open_page_xfer(struct page_xfer *xfer, int fd_type, long id);
 struct page_pipe;
 extern int page_xfer_dump_pages(struct page_xfer *, struct page_pipe *,
 				unsigned long off);
+/* Each job is a process holding a page pipe full of task's pages */
+#define DUMP_MAX_JOBS	256
+
+extern int dump_page_pipe(struct page_pipe *pp, int fd_type, long id,
+				unsigned long off);
+extern int wait_page_writers(void);
 extern int connect_to_page_server(void);
 extern int disconnect_from_page_server(void);
 
@@ -94,7 +94,6 @@ struct parasite_vdso_vma_entry {
 struct parasite_dump_pages_args {
 	unsigned int	nr_vmas;
 	unsigned int	add_prot;
-	unsigned int	off;
 	unsigned int	nr_segs;
 	unsigned int	nr_pages;
 };
@@ -142,6 +141,19 @@ struct parasite_dump_thread {
 	stack_t			sas;
 };
 
+/*
+ * Threads are dumped by batches, all threads of a batch run the
+ * parasite at once, each on its own stack. The stack is how the
+ * parasite finds out which ti[] is for the thread.
+ */
+#define PARASITE_THREADS_BATCH	32
+
+struct parasite_dump_threads_args {
+	unsigned long			stacks;	/* remote address of the 1st stack */
+	unsigned int			nr;
+	struct parasite_dump_thread	ti[PARASITE_THREADS_BATCH];
+};
+
 /*
  * Misc sfuff, that is too small for separate file, but cannot
  * be read w/o using parasite
@@ -141,7 +141,10 @@ struct vm_area_list;
 extern struct mount_info *parse_mountinfo(pid_t pid);
 extern int parse_pid_stat(pid_t pid, struct proc_pid_stat *s);
 extern int parse_pid_stat_small(pid_t pid, struct proc_pid_stat_small *s);
-extern int parse_smaps(pid_t pid, struct vm_area_list *vma_area_list, bool use_map_files);
+#define PROC_VMAS_MAP_FILES	0x1	/* open map_files for file mappings */
+#define PROC_VMAS_VMFLAGS	0x2	/* read smaps for VmFlags and Rss */
+
+extern int parse_maps(pid_t pid, struct vm_area_list *vma_area_list, unsigned int flags);
 extern int parse_pid_status(pid_t pid, struct proc_status_creds *);
 
 union fdinfo_entries {
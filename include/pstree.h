@@ -18,6 +18,8 @@ struct pstree_item {
 	struct list_head	sibling;	/* linkage in my parent's children list */
 
 	struct pid		pid;
+	struct hlist_node	real_hash;	/* pstree_item_by_real() lookup */
+	struct hlist_node	virt_hash;	/* pstree_item_by_virt() lookup */
 	pid_t			pgid;
 	pid_t			sid;
 	pid_t			born_sid;
@@ -56,6 +58,15 @@ extern int prepare_pstree(void);
 extern int dump_pstree(struct pstree_item *root_item);
 extern bool pid_in_pstree(pid_t pid);
 
+/*
+ * Items are hashed by real pids on dump and by virtual ones on
+ * restore. Call these after (re)setting the respective pid.
+ */
+extern void pstree_hash_real(struct pstree_item *item);
+extern void pstree_hash_virt(struct pstree_item *item);
+extern struct pstree_item *pstree_item_by_real(pid_t pid);
+extern struct pstree_item *pstree_item_by_virt(pid_t pid);
+
 struct task_entries;
 extern struct task_entries *task_entries;
 
@@ -144,6 +144,7 @@ struct task_restore_args {
 	int				tcp_socks_nr;
 
 	int				fd_last_pid; /* sys.ns_last_pid for threads rst */
+	int				lazy_pages_sk; /* connection to lazy-pages daemon */
 
 	struct vdso_symtable		vdso_sym_rt;		/* runtime vdso symbols */
 	unsigned long			vdso_rt_parked_at;	/* safe place to keep vdso */
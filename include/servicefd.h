@@ -9,6 +9,7 @@ enum sfd_type {
 	LOG_FD_OFF,
 	IMG_FD_OFF,
 	PROC_FD_OFF,	/* fd with /proc for all proc_ calls */
+	IMG_ARCHIVE_FD_OFF,	/* archive.img in images dir */
 	CTL_TTY_OFF,
 	SELF_STDIN_OFF,
 	PARENT_FD_OFF,
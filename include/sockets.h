@@ -32,6 +32,7 @@ extern bool socket_test_collect_bit(unsigned int family, unsigned int proto);
 
 extern int sk_collect_one(int ino, int family, struct socket_desc *d);
 extern int collect_sockets(int pid);
+extern bool sk_ino_wanted(unsigned int ino);
 extern int collect_inet_sockets(void);
 extern struct collect_image_info unix_sk_cinfo;
 extern int collect_unix_sockets(void);
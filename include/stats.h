@@ -6,6 +6,13 @@ enum {
 	TIME_FROZEN,
 	TIME_MEMDUMP,
 	TIME_MEMWRITE,
+	TIME_INFECT,
+	TIME_CURE,
+	TIME_FILES,
+	TIME_SOCKETS,
+	TIME_MOUNTS,
+	TIME_NAMESPACES,
+	TIME_SHMEM,
 
 	DUMP_TIME_NR_STATS,
 };
@@ -13,6 +20,10 @@ enum {
 enum {
 	TIME_FORK,
 	TIME_RESTORE,
+	TIME_FDS,
+	TIME_PREMAP,
+	TIME_PAGES_READ,
+	TIME_SIGRETURN,
 
 	RESTORE_TIME_NS_STATS,
 };
@@ -20,10 +31,17 @@ enum {
 extern void timing_start(int t);
 extern void timing_stop(int t);
 
+/* Time and number of files dumped, per fd_types */
+extern void fd_timing_start(void);
+extern void fd_timing_stop(int type);
+
 enum {
 	CNT_PAGES_SCANNED,
 	CNT_PAGES_SKIPPED_PARENT,
 	CNT_PAGES_WRITTEN,
+	CNT_PAGES_ZERO,
+	CNT_TASKS_DUMPED,
+	CNT_PAGES_XFERED,
 
 	DUMP_CNT_NR_STATS,
 };
@@ -31,11 +49,13 @@ enum {
 enum {
 	CNT_PAGES_COMPARED,
 	CNT_PAGES_SKIPPED_COW,
+	CNT_TASKS_RESTORED,
 
 	RESTORE_CNT_NR_STATS,
 };
 
 extern void cnt_add(int c, unsigned long val);
+extern unsigned long cnt_get(int c);
 
 #define DUMP_STATS	1
 #define RESTORE_STATS	2
@@ -43,4 +63,22 @@ extern void cnt_add(int c, unsigned long val);
 extern int init_stats(int what);
 extern void write_stats(int what);
 
+enum {
+	PHASE_STARTING,
+	PHASE_FREEZING,
+	PHASE_COLLECTING,
+	PHASE_DUMPING,
+	PHASE_DUMPING_GLOBAL,
+	PHASE_WRITING_PAGES,
+	PHASE_FORKING,
+	PHASE_RESTORING,
+};
+
+extern void stats_set_phase(int phase);
+extern void stats_set_tasks(unsigned int nr);
+
+extern int progress_start(void);
+extern void progress_stop(void);
+extern pid_t progress_server_pid(void);
+
 #endif /* __CR_STATS_H__ */
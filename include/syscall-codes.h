@@ -0,0 +1,92 @@
+/* Autogenerated, don't edit */
+#ifndef syscall_codes_h_
+#define syscall_codes_h_
+#define __NR_read 0
+#define __NR_write 1
+#define __NR_open 2
+#define __NR_close 3
+#define __NR_lseek 8
+#define __NR_mmap 9
+#define __NR_mprotect 10
+#define __NR_munmap 11
+#define __NR_brk 12
+#define __NR_rt_sigaction 13
+#define __NR_rt_sigprocmask 14
+#define __NR_rt_sigreturn 15
+#define __NR_ioctl 16
+#define __NR_pread64 17
+#define __NR_mremap 25
+#define __NR_mincore 27
+#define __NR_madvise 28
+#define __NR_shmat 30
+#define __NR_pause 34
+#define __NR_nanosleep 35
+#define __NR_getitimer 36
+#define __NR_setitimer 38
+#define __NR_getpid 39
+#define __NR_socket 41
+#define __NR_connect 42
+#define __NR_sendto 44
+#define __NR_recvfrom 45
+#define __NR_sendmsg 46
+#define __NR_recvmsg 47
+#define __NR_shutdown 48
+#define __NR_bind 49
+#define __NR_setsockopt 54
+#define __NR_getsockopt 55
+#define __NR_clone 56
+#define __NR_exit 60
+#define __NR_wait4 61
+#define __NR_kill 62
+#define __NR_fcntl 72
+#define __NR_flock 73
+#define __NR_mkdir 83
+#define __NR_rmdir 84
+#define __NR_unlink 87
+#define __NR_readlink 89
+#define __NR_umask 95
+#define __NR_getgroups 115
+#define __NR_setresuid 117
+#define __NR_setresgid 119
+#define __NR_getpgid 121
+#define __NR_setfsuid 122
+#define __NR_setfsgid 123
+#define __NR_getsid 124
+#define __NR_capset 126
+#define __NR_rt_sigqueueinfo 129
+#define __NR_sigaltstack 131
+#define __NR_personality 135
+#define __NR_setpriority 141
+#define __NR_sched_setscheduler 144
+#define __NR_prctl 157
+#define __NR_arch_prctl 158
+#define __NR_setrlimit 160
+#define __NR_mount 165
+#define __NR_umount2 166
+#define __NR_gettid 186
+#define __NR_futex 202
+#define __NR_set_thread_area 205
+#define __NR_get_thread_area 211
+#define __NR_set_tid_address 218
+#define __NR_restart_syscall 219
+#define __NR_sys_timer_create 222
+#define __NR_sys_timer_settime 223
+#define __NR_sys_timer_gettime 224
+#define __NR_sys_timer_getoverrun 225
+#define __NR_sys_timer_delete 226
+#define __NR_exit_group 231
+#define __NR_set_robust_list 273
+#define __NR_get_robust_list 274
+#define __NR_vmsplice 278
+#define __NR_signalfd4 289
+#define __NR_rt_tgsigqueueinfo 297
+#define __NR_fanotify_init 300
+#define __NR_fanotify_mark 301
+#define __NR_prlimit64 302
+#define __NR_open_by_handle_at 304
+#define __NR_setns 308
+#define __NR_kcmp 312
+#define __NR_memfd_create 319
+#define __NR_userfaultfd 323
+#define __NR_clone3 435
+#endif /* syscall_codes_h_ */
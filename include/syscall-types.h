@@ -33,6 +33,20 @@ struct robust_list_head;
 
 struct itimerspec;
 
+/* Arguments of clone3, up to set_tid */
+struct clone3_args {
+	u64 flags;
+	u64 pidfd;
+	u64 child_tid;
+	u64 parent_tid;
+	u64 exit_signal;
+	u64 stack;
+	u64 stack_size;
+	u64 tls;
+	u64 set_tid;
+	u64 set_tid_size;
+};
+
 #ifndef F_GETFD
 #define F_GETFD 1
 #endif
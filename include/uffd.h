@@ -0,0 +1,150 @@
+#ifndef __CR_UFFD_H__
+#define __CR_UFFD_H__
+
+#include <linux/ioctl.h>
+
+#include "config.h"
+#include "asm/types.h"
+#include "list.h"
+
+#ifdef CONFIG_HAS_UFFD
+#include <linux/userfaultfd.h>
+#else
+/*
+ * The userfaultfd API from linux/userfaultfd.h, not
+ * all the distros ship this header yet.
+ */
+#define UFFD_API			((u64)0xAA)
+
+#define UFFDIO				0xAA
+#define _UFFDIO_REGISTER		(0x00)
+#define _UFFDIO_COPY			(0x03)
+#define _UFFDIO_ZEROPAGE		(0x04)
+#define _UFFDIO_API			(0x3F)
+
+struct uffd_msg {
+	u8	event;
+	u8	reserved1;
+	u16	reserved2;
+	u32	reserved3;
+
+	union {
+		struct {
+			u64	flags;
+			u64	address;
+			union {
+				u32 ptid;
+			} feat;
+		} pagefault;
+
+		struct {
+			u32	ufd;
+		} fork;
+
+		struct {
+			u64	from;
+			u64	to;
+			u64	len;
+		} remap;
+
+		struct {
+			u64	start;
+			u64	end;
+		} remove;
+
+		struct {
+			u64	reserved1;
+			u64	reserved2;
+			u64	reserved3;
+		} reserved;
+	} arg;
+} __attribute__((packed));
+
+#define UFFD_EVENT_PAGEFAULT		0x12
+#define UFFD_EVENT_FORK			0x13
+#define UFFD_EVENT_REMAP		0x14
+#define UFFD_EVENT_REMOVE		0x15
+#define UFFD_EVENT_UNMAP		0x16
+
+#define UFFD_FEATURE_EVENT_FORK		(1 << 1)
+#define UFFD_FEATURE_EVENT_REMAP	(1 << 2)
+#define UFFD_FEATURE_EVENT_REMOVE	(1 << 3)
+#define UFFD_FEATURE_EVENT_UNMAP	(1 << 6)
+
+struct uffdio_api {
+	u64 api;
+	u64 features;
+	u64 ioctls;
+};
+
+struct uffdio_range {
+	u64 start;
+	u64 len;
+};
+
+struct uffdio_register {
+	struct uffdio_range range;
+#define UFFDIO_REGISTER_MODE_MISSING	((u64)1 << 0)
+	u64 mode;
+	u64 ioctls;
+};
+
+struct uffdio_copy {
+	u64 dst;
+	u64 src;
+	u64 len;
+	u64 mode;
+	s64 copy;
+};
+
+struct uffdio_zeropage {
+	struct uffdio_range range;
+	u64 mode;
+	s64 zeropage;
+};
+
+#define UFFDIO_API		_IOWR(UFFDIO, _UFFDIO_API, struct uffdio_api)
+#define UFFDIO_REGISTER		_IOWR(UFFDIO, _UFFDIO_REGISTER, struct uffdio_register)
+#define UFFDIO_COPY		_IOWR(UFFDIO, _UFFDIO_COPY, struct uffdio_copy)
+#define UFFDIO_ZEROPAGE		_IOWR(UFFDIO, _UFFDIO_ZEROPAGE, struct uffdio_zeropage)
+#endif /* CONFIG_HAS_UFFD */
+
+/*
+ * The restored task forks, mremaps and unmaps its memory while
+ * the daemon serves it, so the latter must see all of this.
+ */
+#define LAZY_PAGES_UFFD_FEATURES	(UFFD_FEATURE_EVENT_FORK |	\
+					 UFFD_FEATURE_EVENT_REMAP |	\
+					 UFFD_FEATURE_EVENT_REMOVE |	\
+					 UFFD_FEATURE_EVENT_UNMAP)
+
+/*
+ * Lazy pages restore protocol.
+ *
+ * Every restored task with lazy VMAs connects to the lazy-pages
+ * daemon and sends the lazy_pages_hdr followed by hdr.nr_ranges
+ * lazy_pages_range-s. Later the restorer registers these ranges
+ * in a userfaultfd and sends the descriptor over the same socket.
+ *
+ * When restore is over the criu itself connects to the daemon
+ * and sends the header with zero pid, meaning that no more tasks
+ * will show up.
+ */
+
+#define LAZY_PAGES_SOCK_NAME	"lazy-pages.socket"
+
+struct lazy_pages_hdr {
+	u32	pid;
+	u32	nr_ranges;
+};
+
+struct lazy_pages_range {
+	u64	start;
+	u64	end;
+};
+
+extern int cr_lazy_pages(bool daemon_mode);
+extern int lazy_pages_connect(int pid, struct list_head *vmas);
+extern int lazy_pages_restore_done(void);
+
+#endif /* __CR_UFFD_H__ */
@@ -0,0 +1,8 @@
+/* Autogenerated, do not edit */
+#ifndef __CR_VERSION_H__
+#define __CR_VERSION_H__
+#define CRIU_VERSION "1.0"
+#define CRIU_VERSION_MAJOR  1
+#define CRIU_VERSION_MINOR  0
+#define CRIU_GITID "9982b52"
+#endif /* __CR_VERSION_H__ */
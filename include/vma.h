@@ -25,9 +25,11 @@ struct vma_area {
 	unsigned long		*ppage_bitmap; /* parent's existent pages */
 
 	unsigned long		premmaped_addr;
+
+	bool			no_pages;	/* smaps shows nothing in memory or swap */
 };
 
-extern int collect_mappings(pid_t pid, struct vm_area_list *vma_area_list);
+extern int collect_mappings(pid_t pid, struct vm_area_list *vma_area_list, bool vmflags);
 extern void free_mappings(struct vm_area_list *vma_area_list);
 extern bool privately_dump_vma(struct vma_area *vma);
 
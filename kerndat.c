@@ -4,6 +4,7 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/mman.h>
+#include <sys/ioctl.h>
 #include <errno.h>
 
 #include "log.h"
@@ -11,7 +12,9 @@
 #include "mem.h"
 #include "compiler.h"
 #include "sysctl.h"
+#include "syscall.h"
 #include "asm/types.h"
+#include "uffd.h"
 
 dev_t kerndat_shmem_dev;
 
@@ -102,6 +105,57 @@ int kerndat_get_dirty_track(void)
 	return 0;
 }
 
+/*
+ * Anonymous pages that were only read are all mapped to the
+ * kernel zero page. Find out its PFN to tell such pages in
+ * pagemap. Zero PFN means pagemap hides PFNs from us.
+ */
+
+u64 kerndat_zero_page_pfn;
+
+static int kerndat_get_zero_page_pfn(void)
+{
+	void *map;
+	char *page;
+	int pm;
+	u64 pme = 0;
+
+	map = mmap(NULL, PAGE_SIZE, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0);
+	if (map == MAP_FAILED) {
+		pr_perror("Can't mmap memory for zero page test");
+		return -1;
+	}
+
+	page = map;
+	if (*(volatile char *)page != 0) {
+		pr_err("Fresh anonymous page is not zero\n");
+		munmap(map, PAGE_SIZE);
+		return -1;
+	}
+
+	pm = open("/proc/self/pagemap", O_RDONLY);
+	if (pm < 0) {
+		pr_perror("Can't open pagemap file");
+		munmap(map, PAGE_SIZE);
+		return -1;
+	}
+
+	if (pread(pm, &pme, sizeof(pme),
+			(unsigned long)map / PAGE_SIZE * sizeof(pme)) != sizeof(pme)) {
+		pr_perror("Can't read zero page pagemap");
+		pme = 0;
+	}
+
+	close(pm);
+	munmap(map, PAGE_SIZE);
+
+	if (pme & PME_PRESENT)
+		kerndat_zero_page_pfn = PME_PFRAME(pme);
+
+	pr_info("Zero page PFN is %"PRIx64"\n", kerndat_zero_page_pfn);
+	return 0;
+}
+
 /*
  * Strictly speaking, if there is a machine with huge amount
  * of memory, we're allowed to send up to 4M and read up to
@@ -145,14 +199,26 @@ out:
 	return 0;
 }
 
+/*
+ * The service calls the kerndat_init-s before forking workers,
+ * so that each request doesn't probe the kernel again.
+ */
+
 int kerndat_init(void)
 {
+	static bool done;
 	int ret;
 
+	if (done)
+		return 0;
+
 	ret = kerndat_get_shmemdev();
 	if (!ret)
 		ret = kerndat_get_dirty_track();
+	if (!ret)
+		ret = kerndat_get_zero_page_pfn();
 
+	done = (ret == 0);
 	return ret;
 }
 
@@ -168,10 +234,85 @@ int get_last_cap(void)
 	return sysctl_op(req, CTL_READ);
 }
 
+/*
+ * Check whether the kernel has userfaultfd reporting the events
+ * lazy pages daemon relies on, lazy restore is impossible without.
+ */
+
+bool kerndat_has_uffd = false;
+
+static int kerndat_uffd(void)
+{
+	struct uffdio_api api = { .api = UFFD_API, .features = 0, };
+	int uffd;
+
+	uffd = sys_userfaultfd(0);
+	if (uffd < 0) {
+		pr_info("Userfaultfd is not supported (%d)\n", uffd);
+		return 0;
+	}
+
+	if (ioctl(uffd, UFFDIO_API, &api)) {
+		pr_perror("Can't query userfaultfd features");
+		close(uffd);
+		return 0;
+	}
+
+	close(uffd);
+
+	if ((api.features & LAZY_PAGES_UFFD_FEATURES) != LAZY_PAGES_UFFD_FEATURES) {
+		pr_info("Userfaultfd lacks events (features %llx)\n",
+				(unsigned long long)api.features);
+		return 0;
+	}
+
+	kerndat_has_uffd = true;
+	return 0;
+}
+
+/*
+ * Check whether clone3 can create tasks with given pids, then
+ * restore doesn't need to serialize forks on ns_last_pid.
+ */
+
+bool kerndat_has_clone3_set_tid = false;
+
+static int kerndat_clone3_set_tid(void)
+{
+	struct clone3_args args = { };
+	long ret;
+
+	/*
+	 * Non-NULL set_tid with zero set_tid_size is invalid, so
+	 * kernels with set_tid say EINVAL, kernels with clone3 but
+	 * w/o set_tid say E2BIG and older ones ENOSYS.
+	 */
+	args.set_tid = -1;
+	ret = sys_clone3(&args, sizeof(args));
+	if (ret >= 0) {
+		pr_err("Unexpected task %ld created by clone3\n", ret);
+		if (ret == 0)
+			_exit(1);
+		return -1;
+	}
+
+	if (ret != -EINVAL) {
+		pr_info("clone3 with set_tid is not supported (%ld)\n", ret);
+		return 0;
+	}
+
+	kerndat_has_clone3_set_tid = true;
+	return 0;
+}
+
 int kerndat_init_rst(void)
 {
+	static bool done;
 	int ret;
 
+	if (done)
+		return 0;
+
 	/*
 	 * Read TCP sysctls before anything else,
 	 * since the limits we're interested in are
@@ -181,6 +322,11 @@ int kerndat_init_rst(void)
 	ret = tcp_read_sysctl_limits();
 	if (!ret)
 		ret = get_last_cap();
+	if (!ret)
+		ret = kerndat_uffd();
+	if (!ret)
+		ret = kerndat_clone3_set_tid();
 
+	done = (ret == 0);
 	return ret;
 }
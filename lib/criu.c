@@ -98,6 +98,11 @@ void criu_set_log_file(char *log_file)
 	opts->log_file = strdup(log_file);
 }
 
+void criu_set_progress_socket(char *path)
+{
+	opts->progress_socket = strdup(path);
+}
+
 static CriuResp *recv_resp(int socket_fd)
 {
 	unsigned char buf[CR_MAX_MSG_SIZE];
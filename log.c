@@ -5,9 +5,10 @@
 #include <unistd.h>
 #include <stdbool.h>
 #include <limits.h>
+#include <pthread.h>
+#include <time.h>
 
 #include <sys/types.h>
-#include <sys/time.h>
 #include <sys/resource.h>
 
 #include <fcntl.h>
@@ -25,35 +26,87 @@ static unsigned int current_loglevel = DEFAULT_LOGLEVEL;
 static char buffer[PAGE_SIZE];
 static char buf_off = 0;
 
-static struct timeval start;
+/*
+ * With --log-buffered messages are collected in log_buf and
+ * are written out when it fills up, on errors, before fork()
+ * and on exit. Each process has its own copy of the buffer,
+ * the fork-ed ones start with an empty one.
+ */
+#define LOG_BUF_SIZE	(64 << 10)
+
+static bool log_buffered;
+static char log_buf[LOG_BUF_SIZE];
+static unsigned int log_buf_len;
+
+static struct timespec start;
 /*
  * Manual buf len as sprintf will _always_ put '\0' at the
  * and, but we want a "constant" pid to be there on restore
  */
 #define TS_BUF_OFF	12
 
-static void timediff(struct timeval *from, struct timeval *to)
+static void timediff(struct timespec *from, struct timespec *to)
 {
 	to->tv_sec -= from->tv_sec;
-	if (to->tv_usec >= from->tv_usec)
-		to->tv_usec -= from->tv_usec;
+	if (to->tv_nsec >= from->tv_nsec)
+		to->tv_nsec -= from->tv_nsec;
 	else {
 		to->tv_sec--;
-		to->tv_usec += 1000000 - from->tv_usec;
+		to->tv_nsec += 1000000000 - from->tv_nsec;
 	}
 }
 
 static void print_ts(void)
 {
-	struct timeval t;
+	struct timespec t;
+	unsigned usec;
 
-	gettimeofday(&t, NULL);
+	clock_gettime(CLOCK_MONOTONIC, &t);
 	timediff(&start, &t);
+	usec = t.tv_nsec / 1000;
 	snprintf(buffer, TS_BUF_OFF,
-			"(%02u.%06u)", (unsigned)t.tv_sec, (unsigned)t.tv_usec);
+			"(%02u.%06u)", (unsigned)t.tv_sec, usec);
 	buffer[TS_BUF_OFF - 1] = ' '; /* kill the '\0' produced by snprintf */
 }
 
+static void log_write(int fd, const char *buf, int size)
+{
+	int off = 0, ret;
+
+	while (off < size) {
+		ret = write(fd, buf + off, size - off);
+		if (ret <= 0)
+			break;
+		off += ret;
+	}
+}
+
+void log_flush(void)
+{
+	if (!log_buf_len)
+		return;
+
+	log_write(log_get_fd(), log_buf, log_buf_len);
+	log_buf_len = 0;
+}
+
+static int log_buf_init(void)
+{
+	static bool registered;
+
+	if (registered)
+		return 0;
+
+	if (atexit(log_flush) || pthread_atfork(log_flush, NULL, NULL)) {
+		pr_err("Can't setup log buffer flushing\n");
+		return -1;
+	}
+
+	registered = true;
+	log_buffered = true;
+	return 0;
+}
+
 int log_get_fd(void)
 {
 	int fd = get_service_fd(LOG_FD_OFF);
@@ -65,7 +118,10 @@ int log_init(const char *output)
 {
 	int new_logfd, fd;
 
-	gettimeofday(&start, NULL);
+	/* Messages so far go to the old log */
+	log_flush();
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
 	buf_off = TS_BUF_OFF;
 
 	if (output) {
@@ -87,6 +143,9 @@ int log_init(const char *output)
 	if (fd < 0)
 		goto err;
 
+	if (opts.log_buffered)
+		return log_buf_init();
+
 	return 0;
 
 err:
@@ -120,6 +179,7 @@ int log_init_by_pid(void)
 
 void log_fini(void)
 {
+	log_flush();
 	close_service_fd(LOG_FD_OFF);
 }
 
@@ -138,34 +198,45 @@ unsigned int log_get_loglevel(void)
 
 static void __print_on_level(unsigned int loglevel, const char *format, va_list params)
 {
-	int fd, size, ret, off;
+	int size;
 
 	if (unlikely(loglevel == LOG_MSG)) {
-		fd = STDOUT_FILENO;
-		off = buf_off;
-	} else {
-		if (loglevel > current_loglevel)
-			return;
-		fd = log_get_fd();
-		print_ts();
-		off = 0;
+		size = vsnprintf(buffer + buf_off, PAGE_SIZE - buf_off, format, params);
+		if (size > PAGE_SIZE - buf_off - 1)
+			size = PAGE_SIZE - buf_off - 1;
+		log_write(STDOUT_FILENO, buffer + buf_off, size);
+		return;
 	}
 
+	print_ts();
 	size  = vsnprintf(buffer + buf_off, PAGE_SIZE - buf_off, format, params);
 	size += buf_off;
+	if (size > PAGE_SIZE - 1)
+		size = PAGE_SIZE - 1;
 
-	while (off < size) {
-		ret = write(fd, buffer + off, size - off);
-		if (ret <= 0)
-			break;
-		off += ret;
+	if (!log_buffered) {
+		log_write(log_get_fd(), buffer, size);
+		return;
 	}
+
+	if (log_buf_len + size > LOG_BUF_SIZE)
+		log_flush();
+
+	memcpy(log_buf + log_buf_len, buffer, size);
+	log_buf_len += size;
+
+	/* Errors go out at once, criu may not live long after them */
+	if (loglevel == LOG_ERROR)
+		log_flush();
 }
 
 void print_on_level(unsigned int loglevel, const char *format, ...)
 {
 	va_list params;
 
+	if (loglevel > current_loglevel)
+		return;
+
 	va_start(params, format);
 	__print_on_level(loglevel, format, params);
 	va_end(params);
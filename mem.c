@@ -1,6 +1,8 @@
 #include <unistd.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <errno.h>
 #include <fcntl.h>
 
@@ -24,9 +26,10 @@
  * a page with soft-dirty bit cleared (i.e. -- not modified) we check
  * this map for this page presense.
  *
- * Since we scan the address space from vaddr 0 to 0xF..F, we can do
- * linear search in parent pagemap and the rover variables helps us
- * do it.
+ * The map is kept as a sorted array of non-adjacent ranges and is
+ * looked up with binary search. Since we scan the address space from
+ * vaddr 0 to 0xF..F, the rover remembers the last range found and is
+ * checked first.
  */
 
 struct mem_snap_ctx {
@@ -36,7 +39,13 @@ struct mem_snap_ctx {
 	unsigned long rover;
 };
 
-#define MEM_SNAP_BATCH	64
+/*
+ * A pagemap entry takes at least this many bytes in image (size,
+ * two tags and two one-byte varints), so the image size divided
+ * by it is enough for all the entries.
+ */
+#define MEM_SNAP_ENTRY_MIN	(sizeof(u32) + 4)
+#define MEM_SNAP_BATCH		64
 
 static int task_reset_dirty_track(int pid)
 {
@@ -75,11 +84,23 @@ int do_task_reset_dirty_track(int pid)
 	return 0;
 }
 
+static int cmp_snap_iovs(const void *a, const void *b)
+{
+	const struct iovec *ia = a, *ib = b;
+
+	if (ia->iov_base < ib->iov_base)
+		return -1;
+
+	return ia->iov_base > ib->iov_base;
+}
+
 static struct mem_snap_ctx *mem_snap_init(struct parasite_ctl *ctl)
 {
 	struct mem_snap_ctx *ctx;
 	int p_fd, pm_fd;
 	PagemapHead *h;
+	struct stat st;
+	bool sorted = true;
 
 	p_fd = get_service_fd(PARENT_FD_OFF);
 	if (p_fd < 0) {
@@ -98,10 +119,18 @@ static struct mem_snap_ctx *mem_snap_init(struct parasite_ctl *ctl)
 	if (!ctx)
 		goto err_cl;
 
+	if (img_buf_attach(pm_fd, O_RSTR))
+		goto err_free;
+
+	if (fstat(pm_fd, &st)) {
+		pr_perror("Can't stat parent pagemap");
+		goto err_free;
+	}
+
 	ctx->nr_iovs = 0;
-	ctx->alloc = MEM_SNAP_BATCH;
+	ctx->alloc = st.st_size / MEM_SNAP_ENTRY_MIN + 1;
 	ctx->rover = 0;
-	ctx->iovs = xmalloc(MEM_SNAP_BATCH * sizeof(struct iovec));
+	ctx->iovs = xmalloc(ctx->alloc * sizeof(struct iovec));
 	if (!ctx->iovs)
 		goto err_free;
 
@@ -113,6 +142,9 @@ static struct mem_snap_ctx *mem_snap_init(struct parasite_ctl *ctl)
 	while (1) {
 		int ret;
 		PagemapEntry *pe;
+		struct iovec *iov;
+		void *base;
+		size_t len;
 
 		ret = pb_read_one_eof(pm_fd, &pe, PB_PAGEMAP);
 		if (ret == 0)
@@ -120,23 +152,43 @@ static struct mem_snap_ctx *mem_snap_init(struct parasite_ctl *ctl)
 		if (ret < 0)
 			goto err_freei;
 
-		ctx->iovs[ctx->nr_iovs].iov_base = decode_pointer(pe->vaddr);
-		ctx->iovs[ctx->nr_iovs].iov_len = pe->nr_pages * PAGE_SIZE;
-		ctx->nr_iovs++;
+		base = decode_pointer(pe->vaddr);
+		len = (size_t)pe->nr_pages * PAGE_SIZE;
 		pagemap_entry__free_unpacked(pe, NULL);
 
+		if (ctx->nr_iovs) {
+			iov = &ctx->iovs[ctx->nr_iovs - 1];
+			if (iov->iov_base + iov->iov_len == base) {
+				/* Zero, parent and compressed chunk entries go in a row */
+				iov->iov_len += len;
+				continue;
+			}
+
+			if (iov->iov_base > base)
+				sorted = false;
+		}
+
+		/* Can only happen with a hand-made image */
 		if (ctx->nr_iovs >= ctx->alloc) {
-			ctx->iovs = xrealloc(ctx->iovs,
-					(ctx->alloc + MEM_SNAP_BATCH) * sizeof(struct iovec));
-			if (!ctx->iovs)
+			if (xrealloc_safe(&ctx->iovs,
+					(ctx->alloc + MEM_SNAP_BATCH) * sizeof(struct iovec)))
 				goto err_freei;
 
 			ctx->alloc += MEM_SNAP_BATCH;
 		}
+
+		iov = &ctx->iovs[ctx->nr_iovs++];
+		iov->iov_base = base;
+		iov->iov_len = len;
+	}
+
+	if (!sorted) {
+		pr_warn("Parent pagemap is not sorted\n");
+		qsort(ctx->iovs, ctx->nr_iovs, sizeof(struct iovec), cmp_snap_iovs);
 	}
 
 	pr_info("Collected parent snap of %lu entries\n", ctx->nr_iovs);
-	close(pm_fd);
+	close_image(pm_fd);
 	return ctx;
 
 err_freei:
@@ -144,7 +196,7 @@ err_freei:
 err_free:
 	xfree(ctx);
 err_cl:
-	close(pm_fd);
+	close_image(pm_fd);
 	return ERR_PTR(-1);
 }
 
@@ -159,13 +211,13 @@ static void mem_snap_close(struct mem_snap_ctx *ctx)
 unsigned int dump_pages_args_size(struct vm_area_list *vmas)
 {
 	/*
-	 * In the worst case I need one iovec for half of the
-	 * pages (e.g. every odd/even)
+	 * The iovs are passed one page pipe buf at a time
+	 * (see drain_pages) and a buf has at most UIO_MAXIOV
 	 */
 
 	return sizeof(struct parasite_dump_pages_args) +
 		vmas->nr * sizeof(struct parasite_vma_entry) +
-		(vmas->priv_size + 1) * sizeof(struct iovec) / 2;
+		UIO_MAXIOV * sizeof(struct iovec);
 }
 
 static inline bool should_dump_page(VmaEntry *vmae, u64 pme)
@@ -184,8 +236,27 @@ static inline bool should_dump_page(VmaEntry *vmae, u64 pme)
 	return false;
 }
 
+/*
+ * Anonymous pages that were read, but never written, are all
+ * mapped to the kernel zero page, there's no need to read them.
+ */
+static inline bool page_is_zero(u64 pme)
+{
+	return kerndat_zero_page_pfn &&
+		(pme & PME_PRESENT) && !(pme & PME_SWAP) &&
+		PME_PFRAME(pme) == kerndat_zero_page_pfn;
+}
+
+static inline bool snap_iov_has(struct iovec *iov, unsigned long vaddr)
+{
+	return (unsigned long)iov->iov_base <= vaddr &&
+		(unsigned long)iov->iov_base + iov->iov_len > vaddr;
+}
+
 static int page_in_parent(unsigned long vaddr, u64 map, struct mem_snap_ctx *snap)
 {
+	unsigned long lo, hi;
+
 	/*
 	 * Soft-dirty pages should be dumped here
 	 */
@@ -197,24 +268,28 @@ static int page_in_parent(unsigned long vaddr, u64 map, struct mem_snap_ctx *sna
 	 * Otherwise pagemap is screwed up.
 	 */
 
-	while (1) {
-		struct iovec *iov;
-
-		iov = &snap->iovs[snap->rover];
-		if ((unsigned long)iov->iov_base > vaddr)
-			break;
-
-		if ((unsigned long)iov->iov_base + iov->iov_len > vaddr)
+	if (snap->rover < snap->nr_iovs &&
+	    snap_iov_has(&snap->iovs[snap->rover], vaddr))
+		return 1;
+
+	lo = 0;
+	hi = snap->nr_iovs;
+	while (lo < hi) {
+		unsigned long mid = (lo + hi) / 2;
+		struct iovec *iov = &snap->iovs[mid];
+
+		if (vaddr < (unsigned long)iov->iov_base)
+			hi = mid;
+		else if (!snap_iov_has(iov, vaddr))
+			lo = mid + 1;
+		else {
+			snap->rover = mid;
 			return 1;
-
-		snap->rover++;
-		if (snap->rover >= snap->nr_iovs)
-			break;
+		}
 	}
 
-	pr_warn("Page %lx not in parent snap range (rover %lu).\n"
-			"Dumping one, but the pagemap is screwed up.\n",
-			vaddr, snap->rover);
+	pr_warn("Page %lx not in parent snap range.\n"
+			"Dumping one, but the pagemap is screwed up.\n", vaddr);
 	return 0;
 }
 
@@ -227,52 +302,84 @@ static int page_in_parent(unsigned long vaddr, u64 map, struct mem_snap_ctx *sna
  * the memory contents is present in the pagent image set.
  */
 
+/*
+ * In chunk mode the page pipe may get full in the middle of a VMA,
+ * then -EAGAIN is returned and *start is where to continue from.
+ *
+ * Pagemap is read by windows of PAGEMAP_WINDOW entries, so that
+ * huge mostly empty VMAs don't need huge buffers. VMAs smaps shows
+ * nothing resident or swapped for are not read at all.
+ */
+
+#define PAGEMAP_WINDOW	(16UL << 10)	/* 128K of map for 64M of memory */
+
 static int generate_iovs(struct vma_area *vma, int pagemap, struct page_pipe *pp, u64 *map,
-		struct mem_snap_ctx *snap)
+		struct mem_snap_ctx *snap, unsigned long *start)
 {
-	unsigned long pfn, nr_to_scan;
-	unsigned long pages[2] = {};
-	u64 aux;
-
-	aux = vma->vma.start / PAGE_SIZE * sizeof(*map);
-	if (lseek(pagemap, aux, SEEK_SET) != aux) {
-		pr_perror("Can't rewind pagemap file");
-		return -1;
-	}
+	unsigned long pfn, nr_to_scan, win_start, win_end;
+	unsigned long pages[3] = {};
+	int ret = 0;
+	u64 aux, pme;
 
 	nr_to_scan = vma_area_len(vma) / PAGE_SIZE;
-	aux = nr_to_scan * sizeof(*map);
-	if (read(pagemap, map, aux) != aux) {
-		pr_perror("Can't read pagemap file");
-		return -1;
+
+	if (vma->no_pages && !vma_area_is(vma, VMA_AREA_VDSO)) {
+		cnt_add(CNT_PAGES_SCANNED, nr_to_scan);
+		pr_info("Pagemap skipped: nothing in memory\n");
+		*start = nr_to_scan;
+		return 0;
 	}
 
-	for (pfn = 0; pfn < nr_to_scan; pfn++) {
+	win_start = win_end = *start;
+	for (pfn = *start; pfn < nr_to_scan; pfn++) {
 		unsigned long vaddr;
-		int ret;
 
-		if (!should_dump_page(&vma->vma, map[pfn]))
+		if (pfn == win_end) {
+			win_start = pfn;
+			win_end = min(nr_to_scan, pfn + PAGEMAP_WINDOW);
+
+			aux = (win_end - win_start) * sizeof(*map);
+			if (pread(pagemap, map, aux, (vma->vma.start / PAGE_SIZE + pfn) *
+						sizeof(*map)) != aux) {
+				pr_perror("Can't read pagemap file");
+				return -1;
+			}
+		}
+
+		pme = map[pfn - win_start];
+		if (!should_dump_page(&vma->vma, pme))
 			continue;
 
 		vaddr = vma->vma.start + pfn * PAGE_SIZE;
-		if (snap && page_in_parent(vaddr, map[pfn], snap)) {
-			ret = page_pipe_add_hole(pp, vaddr);
+		if (page_is_zero(pme)) {
+			ret = page_pipe_add_hole(pp, vaddr, PP_HOLE_ZERO);
+			if (ret)
+				return -1;
+			pages[2]++;
+		} else if (snap && page_in_parent(vaddr, pme, snap)) {
+			ret = page_pipe_add_hole(pp, vaddr, PP_HOLE_PARENT);
+			if (ret)
+				return -1;
 			pages[0]++;
 		} else {
 			ret = page_pipe_add_page(pp, vaddr);
+			if (ret == -EAGAIN)
+				break; /* this pfn goes first next time */
+			if (ret)
+				return -1;
 			pages[1]++;
 		}
-
-		if (ret)
-			return -1;
 	}
 
-	cnt_add(CNT_PAGES_SCANNED, nr_to_scan);
+	cnt_add(CNT_PAGES_SCANNED, pfn - *start);
 	cnt_add(CNT_PAGES_SKIPPED_PARENT, pages[0]);
 	cnt_add(CNT_PAGES_WRITTEN, pages[1]);
+	cnt_add(CNT_PAGES_ZERO, pages[2]);
 
-	pr_info("Pagemap generated: %lu pages %lu holes\n", pages[1], pages[0]);
-	return 0;
+	pr_info("Pagemap generated: %lu pages %lu holes %lu zero\n",
+			pages[1], pages[0], pages[2]);
+	*start = pfn;
+	return ret;
 }
 
 static struct parasite_dump_pages_args *prep_dump_pages_args(struct parasite_ctl *ctl,
@@ -304,6 +411,50 @@ static struct parasite_dump_pages_args *prep_dump_pages_args(struct parasite_ctl
 	return args;
 }
 
+/*
+ * Grab the pages collected in page-pipe from the task
+ */
+static int drain_pages(struct page_pipe *pp, struct parasite_ctl *ctl,
+		struct parasite_dump_pages_args *args)
+{
+	struct page_pipe_buf *ppb;
+	int ret;
+
+	debug_show_page_pipe(pp);
+
+	list_for_each_entry(ppb, &pp->bufs, l) {
+		args->nr_segs = ppb->nr_segs;
+		args->nr_pages = ppb->pages_in;
+		memcpy(pargs_iovs(args), ppb->iov, ppb->nr_segs * sizeof(struct iovec));
+		pr_debug("PPB: %d pages %d segs %u pipe\n",
+				args->nr_pages, args->nr_segs, ppb->pipe_size);
+
+		ret = __parasite_execute_daemon(PARASITE_CMD_DUMPPAGES, ctl);
+		if (ret < 0)
+			return -1;
+		ret = parasite_send_fd(ctl, ppb->p[1]);
+		if (ret)
+			return -1;
+
+		ret = __parasite_wait_daemon_ack(PARASITE_CMD_DUMPPAGES, ctl);
+		if (ret < 0)
+			return -1;
+	}
+
+	return 0;
+}
+
+static int xfer_pages(struct page_pipe *pp, struct page_xfer *xfer)
+{
+	int ret;
+
+	timing_start(TIME_MEMWRITE);
+	ret = page_xfer_dump_pages(xfer, pp, 0);
+	timing_stop(TIME_MEMWRITE);
+
+	return ret;
+}
+
 static int __parasite_dump_pages_seized(struct parasite_ctl *ctl,
 		struct parasite_dump_pages_args *args,
 		struct vm_area_list *vma_area_list,
@@ -312,8 +463,9 @@ static int __parasite_dump_pages_seized(struct parasite_ctl *ctl,
 	u64 *map;
 	int pagemap;
 	struct page_pipe *pp;
-	struct page_pipe_buf *ppb;
 	struct vma_area *vma_area;
+	struct page_xfer xfer;
+	unsigned int pp_flags = 0;
 	int ret = -1;
 	struct mem_snap_ctx *snap;
 
@@ -334,7 +486,7 @@ static int __parasite_dump_pages_seized(struct parasite_ctl *ctl,
 	if (IS_ERR(snap))
 		goto out;
 
-	map = xmalloc(vma_area_list->longest * sizeof(*map));
+	map = xmalloc(min(vma_area_list->longest, PAGEMAP_WINDOW) * sizeof(*map));
 	if (!map)
 		goto out_snap;
 
@@ -342,50 +494,67 @@ static int __parasite_dump_pages_seized(struct parasite_ctl *ctl,
 	if (ret < 0)
 		goto out_free;
 
+	/*
+	 * When the pages are written right away, do it in chunks,
+	 * so that only a few pipes are busy with task's memory and
+	 * the image is written while we're collecting more pages.
+	 * Pre-dump keeps all the pages in pipes till the task is
+	 * unfrozen, and parallel writers need them all at once.
+	 */
+	if (!pp_ret && opts.dump_jobs <= 1)
+		pp_flags |= PP_CHUNK_MODE;
+
 	ret = -1;
-	pp = create_page_pipe(vma_area_list->priv_size / 2, pargs_iovs(args));
+	pp = create_page_pipe(pp_flags);
 	if (!pp)
 		goto out_close;
 
+	if (pp->flags & PP_CHUNK_MODE) {
+		ret = open_page_xfer(&xfer, CR_FD_PAGEMAP, ctl->pid.virt);
+		if (ret < 0)
+			goto out_pp;
+	}
+
 	/*
 	 * Step 1 -- generate the pagemap
 	 */
 
 	list_for_each_entry(vma_area, &vma_area_list->h, list) {
+		unsigned long pfn = 0;
+
 		if (!privately_dump_vma(vma_area))
 			continue;
-
-		ret = generate_iovs(vma_area, pagemap, pp, map, snap);
+again:
+		ret = generate_iovs(vma_area, pagemap, pp, map, snap, &pfn);
+		if (ret == -EAGAIN) {
+			BUG_ON(!(pp->flags & PP_CHUNK_MODE));
+
+			/*
+			 * Page-pipe is full -- flush this chunk into
+			 * image and go on with the rest of the VMA.
+			 */
+			ret = drain_pages(pp, ctl, args);
+			if (!ret) {
+				timing_stop(TIME_MEMDUMP);
+				ret = xfer_pages(pp, &xfer);
+				timing_start(TIME_MEMDUMP);
+			}
+			if (!ret) {
+				page_pipe_reinit(pp);
+				goto again;
+			}
+		}
 		if (ret < 0)
-			goto out_pp;
+			goto out_xfer;
 	}
 
-	debug_show_page_pipe(pp);
-
 	/*
 	 * Step 2 -- grab pages into page-pipe
 	 */
 
-	args->off = 0;
-	list_for_each_entry(ppb, &pp->bufs, l) {
-		args->nr_segs = ppb->nr_segs;
-		args->nr_pages = ppb->pages_in;
-		pr_debug("PPB: %d pages %d segs %u pipe %d off\n",
-				args->nr_pages, args->nr_segs, ppb->pipe_size, args->off);
-
-		ret = __parasite_execute_daemon(PARASITE_CMD_DUMPPAGES, ctl);
-		if (ret < 0)
-			goto out_pp;
-		ret = parasite_send_fd(ctl, ppb->p[1]);
-		if (ret)
-			goto out_pp;
-
-		ret = __parasite_wait_daemon_ack(PARASITE_CMD_DUMPPAGES, ctl);
-		if (ret < 0)
-			goto out_pp;
-
-		args->off += args->nr_segs;
-	}
+	ret = drain_pages(pp, ctl, args);
+	if (ret < 0)
+		goto out_xfer;
 
 	timing_stop(TIME_MEMDUMP);
 
@@ -394,27 +563,26 @@ static int __parasite_dump_pages_seized(struct parasite_ctl *ctl,
 	 *           pre-dump action (see pre_dump_one_task)
 	 */
 
-	if (pp_ret)
+	if (pp->flags & PP_CHUNK_MODE)
+		ret = xfer_pages(pp, &xfer);
+	else if (pp_ret)
 		*pp_ret = pp;
 	else {
-		struct page_xfer xfer;
-
 		timing_start(TIME_MEMWRITE);
-		ret = open_page_xfer(&xfer, CR_FD_PAGEMAP, ctl->pid.virt);
-		if (ret < 0)
-			goto out_pp;
-
-		ret = page_xfer_dump_pages(&xfer, pp, 0);
-
-		xfer.close(&xfer);
+		ret = dump_page_pipe(pp, CR_FD_PAGEMAP, ctl->pid.virt, 0);
 		timing_stop(TIME_MEMWRITE);
 	}
+	if (ret < 0)
+		goto out_xfer;
 
 	/*
 	 * Step 4 -- clean up
 	 */
 
 	ret = task_reset_dirty_track(ctl->pid.real);
+out_xfer:
+	if (pp->flags & PP_CHUNK_MODE)
+		xfer.close(&xfer);
 out_pp:
 	if (ret || !pp_ret)
 		destroy_page_pipe(pp);
@@ -1,5 +1,6 @@
 #include <unistd.h>
 #include <fcntl.h>
+#include <errno.h>
 
 #undef LOG_PREFIX
 #define LOG_PREFIX "page-pipe: "
@@ -11,7 +12,16 @@ static int page_pipe_grow(struct page_pipe *pp)
 {
 	struct page_pipe_buf *ppb;
 
-	pr_debug("Will grow page pipe (iov off is %u)\n", pp->free_iov);
+	pr_debug("Will grow page pipe (%u pipes)\n", pp->nr_pipes);
+
+	if (!list_empty(&pp->free_bufs)) {
+		ppb = list_first_entry(&pp->free_bufs, struct page_pipe_buf, l);
+		list_del(&ppb->l);
+		goto out;
+	}
+
+	if ((pp->flags & PP_CHUNK_MODE) && pp->nr_pipes == NR_PIPES_PER_CHUNK)
+		return -EAGAIN;
 
 	ppb = xmalloc(sizeof(*ppb));
 	if (!ppb)
@@ -24,33 +34,35 @@ static int page_pipe_grow(struct page_pipe *pp)
 	}
 
 	ppb->pipe_size = fcntl(ppb->p[0], F_GETPIPE_SZ, 0) / PAGE_SIZE;
+	ppb->iov = NULL;
+	ppb->nr_iovs = 0;
+	pp->nr_pipes++;
+out:
 	ppb->pages_in = 0;
 	ppb->nr_segs = 0;
-	ppb->iov = &pp->iovs[pp->free_iov];
 
 	list_add_tail(&ppb->l, &pp->bufs);
-	pp->nr_pipes++;
 
 	return 0;
 }
 
-struct page_pipe *create_page_pipe(unsigned int nr_segs, struct iovec *iovs)
+struct page_pipe *create_page_pipe(unsigned int flags)
 {
 	struct page_pipe *pp;
 
-	pr_debug("Create page pipe for %u segs\n", nr_segs);
+	pr_debug("Create page pipe\n");
 
 	pp = xmalloc(sizeof(*pp));
 	if (pp) {
+		pp->flags = flags;
 		pp->nr_pipes = 0;
 		INIT_LIST_HEAD(&pp->bufs);
-		pp->nr_iovs = nr_segs;
-		pp->iovs = iovs;
-		pp->free_iov = 0;
+		INIT_LIST_HEAD(&pp->free_bufs);
 
 		pp->nr_holes = 0;
 		pp->free_hole = 0;
 		pp->holes = NULL;
+		pp->hole_flags = NULL;
 
 		if (page_pipe_grow(pp))
 			return NULL;
@@ -65,15 +77,37 @@ void destroy_page_pipe(struct page_pipe *pp)
 
 	pr_debug("Killing page pipe\n");
 
+	list_splice(&pp->free_bufs, &pp->bufs);
 	list_for_each_entry_safe(ppb, n, &pp->bufs, l) {
 		close(ppb->p[0]);
 		close(ppb->p[1]);
+		xfree(ppb->iov);
 		xfree(ppb);
 	}
 
+	xfree(pp->holes);
+	xfree(pp->hole_flags);
 	xfree(pp);
 }
 
+/*
+ * Make the page pipe empty again, to be filled with next chunk
+ * of task's memory. All the pipes must have been drained by the
+ * page xfer by that time. They're kept for reuse.
+ */
+void page_pipe_reinit(struct page_pipe *pp)
+{
+	BUG_ON(!(pp->flags & PP_CHUNK_MODE));
+
+	pr_debug("Clean up page pipe\n");
+
+	list_splice_init(&pp->bufs, &pp->free_bufs);
+	pp->free_hole = 0;
+
+	/* Never fails, there are free bufs to take */
+	page_pipe_grow(pp);
+}
+
 #define PPB_IOV_BATCH	8
 
 static inline int try_add_page_to(struct page_pipe *pp, struct page_pipe_buf *ppb,
@@ -84,6 +118,10 @@ static inline int try_add_page_to(struct page_pipe *pp, struct page_pipe_buf *pp
 	if (ppb->pages_in == ppb->pipe_size) {
 		int ret;
 
+		if ((pp->flags & PP_CHUNK_MODE) &&
+		    ppb->pipe_size >= PPB_CHUNK_PAGES)
+			return 1; /* need to add another buf */
+
 		ret = fcntl(ppb->p[0], F_SETPIPE_SZ, (ppb->pipe_size * PAGE_SIZE) << 1);
 		if (ret < 0)
 			return 1; /* need to add another buf */
@@ -108,13 +146,18 @@ static inline int try_add_page_to(struct page_pipe *pp, struct page_pipe_buf *pp
 			return 1;
 	}
 
-	pr_debug("Add iov to page pipe (%u iovs, %u/%u total)\n",
-			ppb->nr_segs, pp->free_iov, pp->nr_iovs);
+	if (ppb->nr_segs == ppb->nr_iovs) {
+		unsigned int nr = ppb->nr_iovs ? ppb->nr_iovs * 2 : PPB_IOV_BATCH;
+
+		if (xrealloc_safe(&ppb->iov, nr * sizeof(*ppb->iov)))
+			return -1;
+		ppb->nr_iovs = nr;
+	}
+
+	pr_debug("Add iov to page pipe (%u iovs)\n", ppb->nr_segs);
 	ppb->iov[ppb->nr_segs].iov_base = (void *)addr;
 	ppb->iov[ppb->nr_segs].iov_len = PAGE_SIZE;
 	ppb->nr_segs++;
-	pp->free_iov++;
-	BUG_ON(pp->free_iov > pp->nr_iovs);
 out:
 	ppb->pages_in++;
 	return 0;
@@ -145,7 +188,8 @@ int page_pipe_add_page(struct page_pipe *pp, unsigned long addr)
 
 #define PP_HOLES_BATCH	32
 
-int page_pipe_add_hole(struct page_pipe *pp, unsigned long addr)
+int page_pipe_add_hole(struct page_pipe *pp, unsigned long addr,
+		unsigned int flags)
 {
 	struct iovec *iov;
 
@@ -155,12 +199,18 @@ int page_pipe_add_hole(struct page_pipe *pp, unsigned long addr)
 		if (!pp->holes)
 			return -1;
 
+		pp->hole_flags = xrealloc(pp->hole_flags,
+				(pp->nr_holes + PP_HOLES_BATCH) * sizeof(unsigned int));
+		if (!pp->hole_flags)
+			return -1;
+
 		pp->nr_holes += PP_HOLES_BATCH;
 	}
 
 	if (pp->free_hole) {
 		iov = &pp->holes[pp->free_hole - 1];
-		if ((unsigned long)iov->iov_base + iov->iov_len == addr) {
+		if ((unsigned long)iov->iov_base + iov->iov_len == addr &&
+				pp->hole_flags[pp->free_hole - 1] == flags) {
 			iov->iov_len += PAGE_SIZE;
 			goto out;
 		}
@@ -169,6 +219,7 @@ int page_pipe_add_hole(struct page_pipe *pp, unsigned long addr)
 	iov = &pp->holes[pp->free_hole];
 	iov->iov_base = (void *)addr;
 	iov->iov_len = PAGE_SIZE;
+	pp->hole_flags[pp->free_hole] = flags;
 	pp->free_hole++;
 out:
 	return 0;
@@ -184,8 +235,7 @@ void debug_show_page_pipe(struct page_pipe *pp)
 		return;
 
 	pr_debug("Page pipe:\n");
-	pr_debug("* %u pipes %u/%u iovs:\n",
-			pp->nr_pipes, pp->free_iov, pp->nr_iovs);
+	pr_debug("* %u pipes:\n", pp->nr_pipes);
 	list_for_each_entry(ppb, &pp->bufs, l) {
 		pr_debug("\tbuf %u pages, %u iovs:\n",
 				ppb->pages_in, ppb->nr_segs);
@@ -198,6 +248,7 @@ void debug_show_page_pipe(struct page_pipe *pp)
 	pr_debug("* %u holes:\n", pp->free_hole);
 	for (i = 0; i < pp->free_hole; i++) {
 		iov = &pp->holes[i];
-		pr_debug("\t%p %zu\n", iov->iov_base, iov->iov_len / PAGE_SIZE);
+		pr_debug("\t%p %zu %s\n", iov->iov_base, iov->iov_len / PAGE_SIZE,
+				pp->hole_flags[i] & PP_HOLE_ZERO ? "zero" : "parent");
 	}
 }
@@ -1,10 +1,13 @@
 #include <fcntl.h>
 #include <stdio.h>
 #include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "image.h"
 #include "servicefd.h"
 #include "page-read.h"
+#include "compress.h"
 
 #include "protobuf.h"
 #include "protobuf/pagemap.pb-c.h"
@@ -29,10 +32,13 @@ static int get_page_vaddr(struct page_read *pr, struct iovec *iov)
 	return 1;
 }
 
-static int read_page(struct page_read *pr, unsigned long vaddr, void *buf)
+static int read_page(struct page_read *pr, unsigned long vaddr, int nr, void *buf)
 {
 	int ret;
 
+	/* Old images have one vaddr:page pair per entry */
+	BUG_ON(nr != 1);
+
 	ret = read(pr->fd_pg, buf, PAGE_SIZE);
 	if (ret != PAGE_SIZE) {
 		pr_err("Can't read mapping page %d\n", ret);
@@ -72,10 +78,15 @@ static int get_pagemap(struct page_read *pr, struct iovec *iov)
 
 static void put_pagemap(struct page_read *pr)
 {
+	/* Step over the chunk nobody asked for */
+	if (pr->pe->has_comp_len && !pr->chunk_loaded)
+		lseek(pr->fd_pg, pr->pe->comp_len, SEEK_CUR);
+	pr->chunk_loaded = false;
+
 	pagemap_entry__free_unpacked(pr->pe, NULL);
 }
 
-static int read_pagemap_page(struct page_read *pr, unsigned long vaddr, void *buf);
+static int read_pagemap_page(struct page_read *pr, unsigned long vaddr, int nr, void *buf);
 
 static void skip_pagemap_pages(struct page_read *pr, unsigned long len)
 {
@@ -83,7 +94,7 @@ static void skip_pagemap_pages(struct page_read *pr, unsigned long len)
 		return;
 
 	pr_debug("\tpr%u Skip %lx bytes from page-dump\n", pr->id, len);
-	if (!pr->pe->in_parent)
+	if (!pr->pe->in_parent && !pr->pe->has_comp_len && !pr->pe->zero)
 		lseek(pr->fd_pg, len, SEEK_CUR);
 	pr->cvaddr += len;
 }
@@ -125,34 +136,235 @@ new_pagemap:
 	}
 }
 
-static int read_pagemap_page(struct page_read *pr, unsigned long vaddr, void *buf)
+static int read_parent_pages(struct page_read *pr, unsigned long vaddr, int nr, void *buf)
 {
+	struct page_read *ppr = pr->parent;
 	int ret;
 
-	if (pr->pe->in_parent) {
-		pr_debug("\tpr%u Read page %lx from parent\n", pr->id, vaddr);
-		ret = seek_pagemap_page(pr->parent, vaddr, true);
+	/*
+	 * The parent's pagemap entries may be shorter than the
+	 * vaddr:nr range we've been asked for, so split it into
+	 * the longest pieces each parent entry can handle.
+	 */
+	while (nr) {
+		int p_nr;
+
+		pr_debug("\tpr%u Read %d pages at %lx from parent\n", pr->id, nr, vaddr);
+		ret = seek_pagemap_page(ppr, vaddr, true);
 		if (ret == -1)
 			return ret;
-		ret = read_pagemap_page(pr->parent, vaddr, buf);
+
+		p_nr = ppr->pe->nr_pages - (vaddr - ppr->pe->vaddr) / PAGE_SIZE;
+		if (p_nr > nr)
+			p_nr = nr;
+
+		ret = read_pagemap_page(ppr, vaddr, p_nr, buf);
 		if (ret == -1)
 			return ret;
-	} else {
-		off_t current_vaddr = lseek(pr->fd_pg, 0, SEEK_CUR);
-		pr_debug("\tpr%u Read page %lx from self %lx/%"PRIx64"\n", pr->id,
-				vaddr, pr->cvaddr, current_vaddr);
-		ret = read(pr->fd_pg, buf, PAGE_SIZE);
-		if (ret != PAGE_SIZE) {
-			pr_perror("Can't read mapping page %d", ret);
+
+		nr -= p_nr;
+		vaddr += (unsigned long)p_nr * PAGE_SIZE;
+		buf += (unsigned long)p_nr * PAGE_SIZE;
+	}
+
+	return 1;
+}
+
+static void *get_pagemap_chunk(struct page_read *pr, unsigned long vaddr)
+{
+	PagemapEntry *pe = pr->pe;
+	unsigned long len = (unsigned long)pe->nr_pages * PAGE_SIZE;
+
+	if (!pr->chunk_loaded) {
+		if (len > COMPRESS_CHUNK_SIZE) {
+			pr_err("pr%u Compressed pagemap %"PRIx64":%u is too long\n",
+					pr->id, pe->vaddr, pe->nr_pages);
+			return NULL;
+		}
+
+		if (!pr->chunk) {
+			pr->chunk = xmalloc(COMPRESS_CHUNK_SIZE);
+			pr->zchunk = xmalloc(compress_bound(COMPRESS_CHUNK_SIZE));
+			if (!pr->chunk || !pr->zchunk)
+				return NULL;
+		}
+
+		pr_debug("\tpr%u Decompress %u bytes for %"PRIx64":%u\n",
+				pr->id, pe->comp_len, pe->vaddr, pe->nr_pages);
+		if (read_compressed_pages(pr->fd_pg, pr->zchunk, pe->comp_len,
+					pr->chunk, len))
+			return NULL;
+
+		pr->chunk_loaded = true;
+	}
+
+	return pr->chunk + (vaddr - pe->vaddr);
+}
+
+static int read_pagemap_page(struct page_read *pr, unsigned long vaddr, int nr, void *buf)
+{
+	unsigned long len = (unsigned long)nr * PAGE_SIZE;
+	int ret;
+
+	if (vaddr + len > pr->pe->vaddr + (u64)pr->pe->nr_pages * PAGE_SIZE) {
+		pr_err("pr%u Read %lx:%d is out of pagemap %"PRIx64":%u\n", pr->id,
+				vaddr, nr, pr->pe->vaddr, pr->pe->nr_pages);
+		return -1;
+	}
+
+	if (pr->pe->in_parent) {
+		ret = read_parent_pages(pr, vaddr, nr, buf);
+		if (ret == -1)
+			return ret;
+	} else if (pr->pe->zero) {
+		memset(buf, 0, len);
+	} else if (pr->pe->has_comp_len) {
+		void *src;
+
+		src = get_pagemap_chunk(pr, vaddr);
+		if (!src)
 			return -1;
+
+		memcpy(buf, src, len);
+	} else {
+		unsigned long off = 0;
+
+		pr_debug("\tpr%u Read %d pages at %lx from self %lx\n", pr->id,
+				nr, vaddr, pr->cvaddr);
+		/* read() may return short on large runs */
+		while (off < len) {
+			ssize_t rd;
+
+			rd = read(pr->fd_pg, buf + off, len - off);
+			if (rd <= 0) {
+				pr_perror("Can't read mapping pages %zd", rd);
+				return -1;
+			}
+			off += rd;
 		}
 	}
 
-	pr->cvaddr += PAGE_SIZE;
+	pr->cvaddr += len;
 
 	return 1;
 }
 
+static int peek_pagemap_pages(struct page_read *pr, unsigned long vaddr, int nr, void **ptr)
+{
+	unsigned long len;
+	off_t off;
+
+	if (vaddr + (unsigned long)nr * PAGE_SIZE >
+			pr->pe->vaddr + (u64)pr->pe->nr_pages * PAGE_SIZE) {
+		pr_err("pr%u Peek %lx:%d is out of pagemap %"PRIx64":%u\n", pr->id,
+				vaddr, nr, pr->pe->vaddr, pr->pe->nr_pages);
+		return -1;
+	}
+
+	if (pr->pe->in_parent) {
+		struct page_read *ppr = pr->parent;
+		int p_nr;
+
+		if (seek_pagemap_page(ppr, vaddr, true))
+			return -1;
+
+		/*
+		 * Only give out what the parent entry has, the
+		 * caller will come back for the rest.
+		 */
+		p_nr = ppr->pe->nr_pages - (vaddr - ppr->pe->vaddr) / PAGE_SIZE;
+		if (p_nr < nr)
+			nr = p_nr;
+
+		nr = peek_pagemap_pages(ppr, vaddr, nr, ptr);
+		if (nr < 0)
+			return nr;
+
+		len = (unsigned long)nr * PAGE_SIZE;
+	} else if (pr->pe->zero) {
+		static char zero_page[PAGE_SIZE] __aligned(PAGE_SIZE);
+
+		/* One at a time, there's only one zero page */
+		nr = 1;
+		len = PAGE_SIZE;
+		*ptr = zero_page;
+	} else if (pr->pe->has_comp_len) {
+		/* Valid till the next entry, that's enough */
+		len = (unsigned long)nr * PAGE_SIZE;
+		*ptr = get_pagemap_chunk(pr, vaddr);
+		if (!*ptr)
+			return -1;
+	} else {
+		len = (unsigned long)nr * PAGE_SIZE;
+
+		/* Keep the file position in sync for read_pages & co */
+		off = lseek(pr->fd_pg, len, SEEK_CUR);
+		if (off < 0) {
+			pr_perror("Can't seek pages image");
+			return -1;
+		}
+
+		off -= len;
+		if (off + len > pr->pg_map_len) {
+			pr_err("pr%u Pages %lx:%d are beyond the image\n", pr->id, vaddr, nr);
+			return -1;
+		}
+
+		*ptr = pr->pg_map + off;
+	}
+
+	pr->cvaddr += len;
+
+	return nr;
+}
+
+static int map_page_read_chain(struct page_read *pr)
+{
+	struct stat st;
+
+	if (pr->parent && map_page_read_chain(pr->parent))
+		return -1;
+
+	if (fstat(pr->fd_pg, &st)) {
+		pr_perror("Can't stat pages image");
+		return -1;
+	}
+
+	if (st.st_size) {
+		pr->pg_map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, pr->fd_pg, 0);
+		if (pr->pg_map == MAP_FAILED) {
+			pr_perror("Can't map pages image");
+			pr->pg_map = NULL;
+			return -1;
+		}
+
+		pr->pg_map_len = st.st_size;
+	}
+
+	pr->peek_pages = peek_pagemap_pages;
+	pr_debug("Mapped page read %u (%zu bytes)\n", pr->id, pr->pg_map_len);
+
+	return 0;
+}
+
+/*
+ * Map pages images of the whole chain, so that the contents can
+ * be accessed with ->peek_pages without copying it into a buffer.
+ * Old-format images can't be mapped, the pages are read then.
+ */
+int map_page_read(struct page_read *pr)
+{
+	struct page_read *p;
+
+	for (p = pr; p; p = p->parent)
+		if (p->read_pages != read_pagemap_page) {
+			pr_warn("Old pages image format, reading pages instead of mapping\n");
+			return 0;
+		}
+
+	return map_page_read_chain(pr);
+}
+
 static void close_page_read(struct page_read *pr)
 {
 	if (pr->parent) {
@@ -160,8 +372,14 @@ static void close_page_read(struct page_read *pr)
 		xfree(pr->parent);
 	}
 
+	if (pr->pg_map)
+		munmap(pr->pg_map, pr->pg_map_len);
+
+	xfree(pr->chunk);
+	xfree(pr->zchunk);
+
 	close(pr->fd_pg);
-	close(pr->fd);
+	close_image(pr->fd);
 }
 
 static int try_open_parent(int dfd, int pid, struct page_read *pr, int flags)
@@ -199,6 +417,12 @@ err_cl:
 int open_page_read_at(int dfd, int pid, struct page_read *pr, int flags)
 {
 	pr->pe = NULL;
+	pr->pg_map = NULL;
+	pr->pg_map_len = 0;
+	pr->peek_pages = NULL;
+	pr->chunk = NULL;
+	pr->chunk_loaded = false;
+	pr->zchunk = NULL;
 
 	pr->fd = open_image_at(dfd, CR_FD_PAGEMAP, O_RSTR, (long)pid);
 	if (pr->fd < 0) {
@@ -209,15 +433,21 @@ int open_page_read_at(int dfd, int pid, struct page_read *pr, int flags)
 		pr->parent = NULL;
 		pr->get_pagemap = get_page_vaddr;
 		pr->put_pagemap = NULL;
-		pr->read_page = read_page;
+		pr->read_pages = read_page;
+		pr->skip_pages = NULL;
 	} else {
 		static unsigned ids = 1;
 
-		if (try_open_parent(dfd, pid, pr, flags)) {
+		if (img_buf_attach(pr->fd, O_RSTR)) {
 			close(pr->fd);
 			return -1;
 		}
 
+		if (try_open_parent(dfd, pid, pr, flags)) {
+			close_image(pr->fd);
+			return -1;
+		}
+
 		pr->fd_pg = open_pages_image_at(dfd, flags, pr->fd);
 		if (pr->fd_pg < 0) {
 			close_page_read(pr);
@@ -226,7 +456,8 @@ int open_page_read_at(int dfd, int pid, struct page_read *pr, int flags)
 
 		pr->get_pagemap = get_pagemap;
 		pr->put_pagemap = put_pagemap;
-		pr->read_page = read_pagemap_page;
+		pr->read_pages = read_pagemap_page;
+		pr->skip_pages = skip_pagemap_pages;
 		pr->id = ids++;
 
 		pr_debug("Opened page read %u (parent %u)\n",
@@ -1,15 +1,21 @@
 #include <sys/socket.h>
+#include <sys/signalfd.h>
+#include <sys/wait.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <linux/falloc.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
 
 #include "cr_options.h"
 #include "servicefd.h"
 #include "image.h"
 #include "page-xfer.h"
 #include "page-pipe.h"
+#include "compress.h"
+#include "stats.h"
 
 #include "protobuf.h"
 #include "protobuf/pagemap.pb-c.h"
@@ -24,6 +30,7 @@ struct page_server_iov {
 #define PS_IOV_ADD	1
 #define PS_IOV_HOLE	2
 #define PS_IOV_OPEN	3
+#define PS_IOV_ZERO	4
 
 #define PS_IOV_FLUSH		0x1023
 
@@ -129,7 +136,7 @@ static int page_server_add(int sk, struct page_server_iov *pi)
 	return 0;
 }
 
-static int page_server_hole(int sk, struct page_server_iov *pi)
+static int page_server_hole(int sk, struct page_server_iov *pi, unsigned int flags)
 {
 	struct page_xfer *lxfer = &cxfer.loc_xfer;
 	struct iovec iov;
@@ -142,7 +149,7 @@ static int page_server_hole(int sk, struct page_server_iov *pi)
 	iov.iov_base = decode_pointer(pi->vaddr);
 	iov.iov_len = pi->nr_pages * PAGE_SIZE;
 
-	if (lxfer->write_hole(lxfer, &iov))
+	if (lxfer->write_hole(lxfer, &iov, flags))
 		return -1;
 
 	return 0;
@@ -185,7 +192,10 @@ static int page_server_serve(int sk)
 			ret = page_server_add(sk, &pi);
 			break;
 		case PS_IOV_HOLE:
-			ret = page_server_hole(sk, &pi);
+			ret = page_server_hole(sk, &pi, PP_HOLE_PARENT);
+			break;
+		case PS_IOV_ZERO:
+			ret = page_server_hole(sk, &pi, PP_HOLE_ZERO);
 			break;
 		case PS_IOV_FLUSH:
 		{
@@ -242,13 +252,164 @@ static int get_sockaddr_in(struct sockaddr_in *addr)
 	return 0;
 }
 
-int cr_page_server(bool daemon_mode)
+/*
+ * Every connection is served by its own worker process, so that
+ * pages of different tasks are written into images in parallel.
+ * The first connection is the one dump makes when it starts and
+ * keeps till the very end, so once it's over no new ones will
+ * come and we only have to wait for the rest of the workers.
+ */
+
+#define PS_BACKLOG	64
+
+static int page_server_fork(int sk, int sfd, sigset_t *oldmask)
 {
-	int sk, ask = -1;
-	struct sockaddr_in saddr, caddr;
+	struct sockaddr_in caddr;
 	socklen_t clen = sizeof(caddr);
+	int ask, pid;
+
+	ask = accept(sk, (struct sockaddr *)&caddr, &clen);
+	if (ask < 0) {
+		pr_perror("Can't accept connection to server");
+		return -1;
+	}
+
+	pr_info("Accepted connection from %s:%u\n",
+			inet_ntoa(caddr.sin_addr),
+			(int)ntohs(caddr.sin_port));
+
+	/* Each connection writes page images with its own IDs */
+	if (up_page_ids_base()) {
+		close(ask);
+		return 0;
+	}
+
+	pid = fork();
+	if (pid == 0) {
+		int ret;
 
-	up_page_ids_base();
+		close(sk);
+		close(sfd);
+		sigprocmask(SIG_SETMASK, oldmask, NULL);
+
+		ret = page_server_serve(ask);
+		exit(ret ? 1 : 0);
+	}
+
+	if (pid < 0)
+		pr_perror("Can't fork page server worker");
+
+	close(ask);
+	return pid;
+}
+
+static int page_server_reap(int *nr_workers, int master, bool block)
+{
+	int pid, status, ret = 0;
+
+	while (*nr_workers) {
+		pid = waitpid(-1, &status, block ? 0 : WNOHANG);
+		if (pid == 0)
+			break;
+		if (pid < 0) {
+			pr_perror("Can't wait page server workers");
+			return -1;
+		}
+
+		(*nr_workers)--;
+		if (!WIFEXITED(status) || WEXITSTATUS(status)) {
+			pr_err("Page server worker %d failed (%#x)\n", pid, status);
+			ret = -1;
+		}
+
+		if (pid == master && !ret)
+			ret = 1;
+	}
+
+	return ret;
+}
+
+static int page_server_serve_all(int sk)
+{
+	int sfd, master = 0, nr_workers = 0, ret = -1;
+	sigset_t mask, oldmask;
+
+	sigemptyset(&mask);
+	sigaddset(&mask, SIGCHLD);
+	if (sigprocmask(SIG_BLOCK, &mask, &oldmask)) {
+		pr_perror("Can't block SIGCHLD");
+		return -1;
+	}
+
+	sfd = signalfd(-1, &mask, 0);
+	if (sfd < 0) {
+		pr_perror("Can't create signalfd");
+		goto out_mask;
+	}
+
+	while (1) {
+		struct pollfd pfd[2] = {
+			{ .fd = sk,  .events = POLLIN, },
+			{ .fd = sfd, .events = POLLIN, },
+		};
+
+		if (poll(pfd, 2, -1) < 0) {
+			if (errno == EINTR)
+				continue;
+			pr_perror("Can't poll page server sockets");
+			ret = -1;
+			break;
+		}
+
+		if (pfd[1].revents & POLLIN) {
+			struct signalfd_siginfo si;
+
+			if (read(sfd, &si, sizeof(si)) != sizeof(si)) {
+				pr_perror("Can't read from signalfd");
+				ret = -1;
+				break;
+			}
+
+			ret = page_server_reap(&nr_workers, master, false);
+			if (ret)
+				break;
+		}
+
+		if (pfd[0].revents & POLLIN) {
+			int pid;
+
+			pid = page_server_fork(sk, sfd, &oldmask);
+			if (pid < 0) {
+				ret = -1;
+				break;
+			}
+
+			/* The connection is rejected */
+			if (!pid)
+				continue;
+
+			if (!master)
+				master = pid;
+			nr_workers++;
+		}
+	}
+
+	if (page_server_reap(&nr_workers, master, true) < 0)
+		ret = -1;
+	if (ret > 0)
+		ret = 0;
+
+	pr_info("Page server is over\n");
+	close(sfd);
+out_mask:
+	sigprocmask(SIG_SETMASK, &oldmask, NULL);
+	return ret;
+}
+
+int cr_page_server(bool daemon_mode)
+{
+	int sk, ret = -1;
+	struct sockaddr_in saddr;
 
 	pr_info("Starting page server on port %u\n", (int)ntohs(opts.ps_port));
 
@@ -266,7 +427,7 @@ int cr_page_server(bool daemon_mode)
 		goto out;
 	}
 
-	if (listen(sk, 1)) {
+	if (listen(sk, PS_BACKLOG)) {
 		pr_perror("Can't listen on page server socket");
 		goto out;
 	}
@@ -274,67 +435,118 @@ int cr_page_server(bool daemon_mode)
 	if (daemon_mode)
 		if (daemon(1, 0) == -1) {
 			pr_perror("Can't run in the background");
-			return -errno;
+			ret = -errno;
+			goto out;
 		}
 
 	if (opts.pidfile) {
 		if (write_pidfile(getpid()) == -1) {
 			pr_perror("Can't write pidfile");
-			return -1;
+			goto out;
 		}
 	}
 
-	ask = accept(sk, (struct sockaddr *)&caddr, &clen);
-	if (ask < 0)
-		pr_perror("Can't accept connection to server");
-
+	ret = page_server_serve_all(sk);
 out:
 	close(sk);
-
-	if (ask < 0)
-		return -1;
-
-	pr_info("Accepted connection from %s:%u\n",
-			inet_ntoa(caddr.sin_addr),
-			(int)ntohs(caddr.sin_port));
-
-	return page_server_serve(ask);
+	return ret;
 }
 
 static int page_server_sk = -1;
 
-int connect_to_page_server(void)
+/*
+ * Sockets of closed page xfers, each has the flush command sent,
+ * but the answer is read later, so that the server writes one
+ * task's pages while we're dumping the next one. Each connection
+ * is a process on the server, so only that many are kept, then
+ * the oldest one is waited for.
+ */
+#define PS_PENDING_XFERS	16
+
+static int xfer_sks[PS_PENDING_XFERS];
+static int nr_xfer_sks, xfer_sks_head;
+static bool xfer_sks_failed;
+
+static int page_server_connect(void)
 {
 	struct sockaddr_in saddr;
-
-	if (!opts.use_page_server)
-		return 0;
+	int sk;
 
 	pr_info("Connecting to server %s:%u\n",
 			opts.addr, (int)ntohs(opts.ps_port));
 
-	page_server_sk = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP);
-	if (page_server_sk < 0) {
+	sk = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (sk < 0) {
 		pr_perror("Can't create socket");
 		return -1;
 	}
 
 	if (get_sockaddr_in(&saddr))
-		return -1;
+		goto err;
 
-	if (connect(page_server_sk, (struct sockaddr *)&saddr, sizeof(saddr)) < 0) {
+	if (connect(sk, (struct sockaddr *)&saddr, sizeof(saddr)) < 0) {
 		pr_perror("Can't connect to server");
+		goto err;
+	}
+
+	return sk;
+
+err:
+	close(sk);
+	return -1;
+}
+
+static int page_server_flush(int sk)
+{
+	struct page_server_iov pi = { .cmd = PS_IOV_FLUSH };
+
+	if (write(sk, &pi, sizeof(pi)) != sizeof(pi)) {
+		pr_perror("Can't write the fini command to server");
 		return -1;
 	}
 
 	return 0;
 }
 
-int disconnect_from_page_server(void)
+static int page_server_flush_wait(int sk)
 {
-	struct page_server_iov pi = { .cmd = PS_IOV_FLUSH };
 	int32_t status = -1;
-	int ret = -1;
+
+	if (read(sk, &status, sizeof(status)) != sizeof(status)) {
+		pr_perror("The page server doesn't answer");
+		return -1;
+	}
+
+	return status;
+}
+
+static void drain_xfer_sk(void)
+{
+	int sk = xfer_sks[xfer_sks_head];
+
+	if (page_server_flush_wait(sk))
+		xfer_sks_failed = true;
+	close(sk);
+
+	xfer_sks_head = (xfer_sks_head + 1) % PS_PENDING_XFERS;
+	nr_xfer_sks--;
+}
+
+int connect_to_page_server(void)
+{
+	if (!opts.use_page_server)
+		return 0;
+
+	page_server_sk = page_server_connect();
+	if (page_server_sk < 0)
+		return -1;
+
+	return 0;
+}
+
+int disconnect_from_page_server(void)
+{
+	int ret = 0;
 
 	if (!opts.use_page_server)
 		return 0;
@@ -345,20 +557,23 @@ int disconnect_from_page_server(void)
 	pr_info("Disconnect from the page server %s:%u\n",
 			opts.addr, (int)ntohs(opts.ps_port));
 
-	if (write(page_server_sk, &pi, sizeof(pi)) != sizeof(pi)) {
-		pr_perror("Can't write the fini command to server");
-		goto out;
-	}
+	/*
+	 * All the xfers' connections go first, the main one
+	 * is the last, after it the server quits.
+	 */
+	while (nr_xfer_sks)
+		drain_xfer_sk();
 
-	if (read(page_server_sk, &status, sizeof(status)) != sizeof(status)) {
-		pr_perror("The page server doesn't answer");
-		goto out;
-	}
+	if (xfer_sks_failed)
+		ret = -1;
+	xfer_sks_failed = false;
+
+	if (page_server_flush(page_server_sk) ||
+	    page_server_flush_wait(page_server_sk))
+		ret = -1;
 
-	ret = 0;
-out:
 	close_safe(&page_server_sk);
-	return ret ? : status;
+	return ret;
 }
 
 static int write_pagemap_to_server(struct page_xfer *xfer,
@@ -392,11 +607,12 @@ static int write_pages_to_server(struct page_xfer *xfer,
 	return 0;
 }
 
-static int write_hole_to_server(struct page_xfer *xfer, struct iovec *iov)
+static int write_hole_to_server(struct page_xfer *xfer, struct iovec *iov,
+		unsigned int flags)
 {
 	struct page_server_iov pi;
 
-	pi.cmd = PS_IOV_HOLE;
+	pi.cmd = flags & PP_HOLE_ZERO ? PS_IOV_ZERO : PS_IOV_HOLE;
 	pi.dst_id = xfer->dst_id;
 	pi.vaddr = encode_pointer(iov->iov_base);
 	pi.nr_pages = iov->iov_len / PAGE_SIZE;
@@ -411,6 +627,16 @@ static int write_hole_to_server(struct page_xfer *xfer, struct iovec *iov)
 
 static void close_server_xfer(struct page_xfer *xfer)
 {
+	if (page_server_flush(xfer->fd)) {
+		xfer_sks_failed = true;
+		close(xfer->fd);
+	} else {
+		if (nr_xfer_sks == PS_PENDING_XFERS)
+			drain_xfer_sk();
+		xfer_sks[(xfer_sks_head + nr_xfer_sks) % PS_PENDING_XFERS] = xfer->fd;
+		nr_xfer_sks++;
+	}
+
 	xfer->fd = -1;
 }
 
@@ -418,7 +644,15 @@ static int open_page_server_xfer(struct page_xfer *xfer, int fd_type, long id)
 {
 	struct page_server_iov pi;
 
-	xfer->fd = page_server_sk;
+	/*
+	 * Each image goes via its own connection, so that the
+	 * server can write them in parallel.
+	 */
+	xfer->fd = page_server_connect();
+	if (xfer->fd < 0)
+		return -1;
+
+	xfer->comp = NULL;
 	xfer->write_pagemap = write_pagemap_to_server;
 	xfer->write_pages = write_pages_to_server;
 	xfer->write_hole = write_hole_to_server;
@@ -432,6 +666,7 @@ static int open_page_server_xfer(struct page_xfer *xfer, int fd_type, long id)
 
 	if (write(xfer->fd, &pi, sizeof(pi)) != sizeof(pi)) {
 		pr_perror("Can't write to page server");
+		close(xfer->fd);
 		return -1;
 	}
 
@@ -466,25 +701,188 @@ static int write_pages_loc(struct page_xfer *xfer,
 	return 0;
 }
 
-static int write_pagehole_loc(struct page_xfer *xfer, struct iovec *iov)
+static int write_pagehole_loc(struct page_xfer *xfer, struct iovec *iov,
+		unsigned int flags)
 {
 	PagemapEntry pe = PAGEMAP_ENTRY__INIT;
 
 	pe.vaddr = encode_pointer(iov->iov_base);
 	pe.nr_pages = iov->iov_len / PAGE_SIZE;
-	pe.has_in_parent = true;
-	pe.in_parent = true;
+	if (flags & PP_HOLE_ZERO) {
+		pe.has_zero = true;
+		pe.zero = true;
+	} else {
+		pe.has_in_parent = true;
+		pe.in_parent = true;
+	}
+
+	if (pb_write_one(xfer->fd, &pe, PB_PAGEMAP) < 0)
+		return -1;
+
+	return 0;
+}
+
+/*
+ * With --compress pages are read from the pipe and written
+ * by COMPRESS_CHUNK_PAGES chunks, each with its own pagemap
+ * entry, see compress.h for details.
+ */
+
+struct page_xfer_comp {
+	void		*vaddr;		/* of the chunk being filled */
+	unsigned long	filled;		/* bytes in buf */
+	unsigned long	left;		/* bytes till the end of pagemap */
+	void		*buf;
+	void		*zbuf;
+};
+
+static int write_pagemap_comp(struct page_xfer *xfer,
+		struct iovec *iov)
+{
+	if (opts.auto_dedup && xfer->parent != NULL) {
+		if (dedup_one_iovec(xfer->parent, iov) == -1) {
+			pr_perror("Auto-deduplication failed");
+			return -1;
+		}
+	}
+
+	/* The entries are written by flush_pages_comp */
+	xfer->comp->vaddr = iov->iov_base;
+	xfer->comp->filled = 0;
+	xfer->comp->left = iov->iov_len;
+	return 0;
+}
+
+/*
+ * Pages written with zeroes are not mapped to the zero page, but
+ * we see the contents here anyway, so catch them as well. This
+ * loop is simple enough for the compiler to vectorize it.
+ */
+static bool pages_are_zero(void *buf, unsigned long len)
+{
+	unsigned long *p = buf, *end = buf + len;
+
+	while (p < end) {
+		unsigned long acc = 0, *pend = (void *)p + PAGE_SIZE;
+
+		for (; p < pend; p++)
+			acc |= *p;
+		if (acc)
+			return false;
+	}
+
+	return true;
+}
+
+static int flush_pages_comp(struct page_xfer *xfer)
+{
+	struct page_xfer_comp *comp = xfer->comp;
+	PagemapEntry pe = PAGEMAP_ENTRY__INIT;
+	struct iovec iov;
+	long zlen;
+
+	if (pages_are_zero(comp->buf, comp->filled)) {
+		iov.iov_base = comp->vaddr;
+		iov.iov_len = comp->filled;
+		if (write_pagehole_loc(xfer, &iov, PP_HOLE_ZERO))
+			return -1;
+
+		comp->vaddr += comp->filled;
+		comp->filled = 0;
+		return 0;
+	}
+
+	zlen = compress_pages(comp->buf, comp->filled, comp->zbuf);
+	if (zlen < 0)
+		return -1;
+
+	pe.vaddr = encode_pointer(comp->vaddr);
+	pe.nr_pages = comp->filled / PAGE_SIZE;
+	pe.has_comp_len = true;
+	pe.comp_len = zlen;
 
 	if (pb_write_one(xfer->fd, &pe, PB_PAGEMAP) < 0)
 		return -1;
 
+	if (write_img_buf(xfer->fd_pg,
+			zlen == comp->filled ? comp->buf : comp->zbuf, zlen))
+		return -1;
+
+	comp->vaddr += comp->filled;
+	comp->filled = 0;
+	return 0;
+}
+
+/*
+ * The page server calls this with whatever it got from the
+ * socket, so pages may come in pieces.
+ */
+static int write_pages_comp(struct page_xfer *xfer,
+		int p, unsigned long len)
+{
+	struct page_xfer_comp *comp = xfer->comp;
+
+	if (len > comp->left) {
+		pr_err("Too many pages for pagemap at %p\n", comp->vaddr);
+		return -1;
+	}
+
+	while (len) {
+		unsigned long n;
+		ssize_t ret;
+
+		n = min(len, COMPRESS_CHUNK_SIZE - comp->filled);
+		ret = read(p, comp->buf + comp->filled, n);
+		if (ret <= 0) {
+			pr_perror("Can't read pages from pipe");
+			return -1;
+		}
+
+		comp->filled += ret;
+		comp->left -= ret;
+		len -= ret;
+
+		if ((comp->filled == COMPRESS_CHUNK_SIZE || !comp->left) &&
+				flush_pages_comp(xfer))
+			return -1;
+	}
+
+	return 0;
+}
+
+static int open_page_xfer_comp(struct page_xfer *xfer)
+{
+	struct page_xfer_comp *comp;
+
+	comp = xmalloc(sizeof(*comp));
+	if (!comp)
+		return -1;
+
+	comp->buf = xmalloc(COMPRESS_CHUNK_SIZE);
+	comp->zbuf = xmalloc(compress_bound(COMPRESS_CHUNK_SIZE));
+	if (!comp->buf || !comp->zbuf) {
+		xfree(comp->buf);
+		xfree(comp->zbuf);
+		xfree(comp);
+		return -1;
+	}
+
+	xfer->comp = comp;
+	xfer->write_pagemap = write_pagemap_comp;
+	xfer->write_pages = write_pages_comp;
 	return 0;
 }
 
 static void close_page_xfer(struct page_xfer *xfer)
 {
+	if (xfer->comp) {
+		xfree(xfer->comp->buf);
+		xfree(xfer->comp->zbuf);
+		xfree(xfer->comp);
+	}
+
 	close(xfer->fd_pg);
-	close(xfer->fd);
+	close_image(xfer->fd);
 }
 
 int page_xfer_dump_pages(struct page_xfer *xfer, struct page_pipe *pp,
@@ -509,7 +907,8 @@ int page_xfer_dump_pages(struct page_xfer *xfer, struct page_pipe *pp,
 			while (hole && (hole->iov_base < iov->iov_base)) {
 				pr_debug("\th %p [%u]\n", hole->iov_base,
 						(unsigned int)(hole->iov_len / PAGE_SIZE));
-				if (xfer->write_hole(xfer, hole))
+				if (xfer->write_hole(xfer, hole,
+						pp->hole_flags[hole - pp->holes]))
 					return -1;
 
 				hole++;
@@ -526,13 +925,16 @@ int page_xfer_dump_pages(struct page_xfer *xfer, struct page_pipe *pp,
 				return -1;
 			if (xfer->write_pages(xfer, ppb->p[0], iov->iov_len))
 				return -1;
+
+			cnt_add(CNT_PAGES_XFERED, iov->iov_len / PAGE_SIZE);
 		}
 	}
 
 	while (hole) {
 		pr_debug("\th* %p [%u]\n", hole->iov_base,
 				(unsigned int)(hole->iov_len / PAGE_SIZE));
-		if (xfer->write_hole(xfer, hole))
+		if (xfer->write_hole(xfer, hole,
+				pp->hole_flags[hole - pp->holes]))
 			return -1;
 
 		hole++;
@@ -543,15 +945,133 @@ int page_xfer_dump_pages(struct page_xfer *xfer, struct page_pipe *pp,
 	return 0;
 }
 
+/*
+ * With --dump-jobs pages are written into images by child processes,
+ * while we go on with the next task. The xfer is opened here, so that
+ * pages images IDs are allocated in one place, and is closed after the
+ * writer exits, so that page server connections are flushed after the
+ * pages. The pipes are inherited by the writer, so the caller is free
+ * to destroy its page_pipe right after this returns.
+ */
+
+struct page_writer {
+	struct list_head	l;
+	pid_t			pid;
+	struct page_xfer	xfer;
+};
+
+static LIST_HEAD(page_writers);
+static unsigned int nr_page_writers;
+
+static int wait_page_writer(struct page_writer *pw)
+{
+	int status, ret = 0;
+
+	if (waitpid(pw->pid, &status, 0) != pw->pid) {
+		pr_perror("Can't wait pages writer %d", pw->pid);
+		ret = -1;
+	} else if (!WIFEXITED(status) || WEXITSTATUS(status)) {
+		pr_err("Pages writer %d failed (%#x)\n", pw->pid, status);
+		ret = -1;
+	}
+
+	pw->xfer.close(&pw->xfer);
+	list_del(&pw->l);
+	nr_page_writers--;
+	xfree(pw);
+
+	return ret;
+}
+
+int wait_page_writers(void)
+{
+	struct page_writer *pw, *n;
+	int ret = 0;
+
+	list_for_each_entry_safe(pw, n, &page_writers, l)
+		if (wait_page_writer(pw))
+			ret = -1;
+
+	return ret;
+}
+
+int dump_page_pipe(struct page_pipe *pp, int fd_type, long id, unsigned long off)
+{
+	struct page_writer *pw;
+	int ret;
+
+	if (opts.dump_jobs <= 1) {
+		struct page_xfer xfer;
+
+		ret = open_page_xfer(&xfer, fd_type, id);
+		if (ret < 0)
+			return -1;
+
+		ret = page_xfer_dump_pages(&xfer, pp, off);
+
+		xfer.close(&xfer);
+		return ret;
+	}
+
+	if (nr_page_writers >= opts.dump_jobs) {
+		pw = list_first_entry(&page_writers, struct page_writer, l);
+		if (wait_page_writer(pw))
+			return -1;
+	}
+
+	pw = xmalloc(sizeof(*pw));
+	if (!pw)
+		return -1;
+
+	if (open_page_xfer(&pw->xfer, fd_type, id)) {
+		xfree(pw);
+		return -1;
+	}
+
+	/* The pagemap head goes before the writer's entries */
+	if (img_buf_flush(pw->xfer.fd)) {
+		pw->xfer.close(&pw->xfer);
+		xfree(pw);
+		return -1;
+	}
+
+	pw->pid = fork();
+	if (pw->pid == 0) {
+		ret = page_xfer_dump_pages(&pw->xfer, pp, off);
+		if (img_buf_flush(pw->xfer.fd))
+			ret = -1;
+		exit(ret ? 1 : 0);
+	}
+
+	if (pw->pid < 0) {
+		pr_perror("Can't fork pages writer");
+		pw->xfer.close(&pw->xfer);
+		xfree(pw);
+		return -1;
+	}
+
+	pr_debug("Pages writer %d started for %d/%ld\n", pw->pid, fd_type, id);
+	list_add_tail(&pw->l, &page_writers);
+	nr_page_writers++;
+
+	return 0;
+}
+
 static int open_page_local_xfer(struct page_xfer *xfer, int fd_type, long id)
 {
+	xfer->comp = NULL;
 	xfer->fd = open_image(fd_type, O_DUMP, id);
 	if (xfer->fd < 0)
 		return -1;
 
+	if (img_buf_attach(xfer->fd, O_DUMP)) {
+		close(xfer->fd);
+		return -1;
+	}
+
 	xfer->fd_pg = open_pages_image(O_DUMP, xfer->fd);
 	if (xfer->fd_pg < 0) {
-		close(xfer->fd);
+		close_image(xfer->fd);
 		return -1;
 	}
 
@@ -584,6 +1104,12 @@ out:
 	xfer->write_pages = write_pages_loc;
 	xfer->write_hole = write_pagehole_loc;
 	xfer->close = close_page_xfer;
+
+	if (opts.compress && open_page_xfer_comp(xfer)) {
+		close_page_xfer(xfer);
+		return -1;
+	}
+
 	return 0;
 }
 
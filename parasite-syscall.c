@@ -239,28 +239,6 @@ void *parasite_args_s(struct parasite_ctl *ctl, int args_size)
 	return ctl->addr_args;
 }
 
-static int parasite_execute_trap_by_pid(unsigned int cmd,
-					struct parasite_ctl *ctl, pid_t pid,
-					void *stack,
-					struct thread_ctx *octx)
-{
-	user_regs_struct_t regs = octx->regs;
-	int ret;
-
-	*ctl->addr_cmd = cmd;
-
-	ret = parasite_run(pid, PTRACE_CONT, ctl->parasite_ip, stack, &regs, octx);
-	if (ret == 0)
-		ret = parasite_trap(ctl, pid, &regs, octx);
-	if (ret == 0)
-		ret = (int)REG_RES(regs);
-
-	if (ret)
-		pr_err("Parasite exited with %d\n", ret);
-
-	return ret;
-}
-
 static int __parasite_send_cmd(int sockfd, struct ctl_msg *m)
 {
 	int ret;
@@ -332,6 +310,9 @@ int __parasite_execute_daemon(unsigned int cmd, struct parasite_ctl *ctl)
 {
 	struct ctl_msg m;
 
+	/* Keep parasite's messages after ours in the log */
+	log_flush();
+
 	m = ctl_msg_cmd(cmd);
 	return __parasite_send_cmd(ctl->tsock, &m);
 }
@@ -538,41 +519,96 @@ err:
 	return -1;
 }
 
-int parasite_dump_thread_seized(struct parasite_ctl *ctl, int id,
-				struct pid *tid, CoreEntry *core)
+/*
+ * Run the parasite in up to nr_thread_stacks threads at once, then
+ * collect the results. Threads that were started are always waited
+ * for, so that their context is restored.
+ */
+static int dump_threads_batch(struct parasite_ctl *ctl, struct pstree_item *item,
+		int *ids, unsigned int nr)
 {
-	struct parasite_dump_thread *args;
-	pid_t pid = tid->real;
-	ThreadCoreEntry *tc = core->thread_core;
-	int ret;
-	struct thread_ctx octx;
+	struct parasite_dump_threads_args *args;
+	struct thread_ctx octx[PARASITE_THREADS_BATCH];
+	user_regs_struct_t regs;
+	unsigned int i, started;
+	int ret = 0;
 
-	BUG_ON(id == 0); /* Leader is dumped in dump_task_core_all */
+	args = parasite_args(ctl, struct parasite_dump_threads_args);
+	args->stacks = (unsigned long)ctl->r_thread_stack;
+	args->nr = nr;
 
-	args = parasite_args(ctl, struct parasite_dump_thread);
+	*ctl->addr_cmd = PARASITE_CMD_DUMP_THREAD;
 
-	ret = get_thread_ctx(pid, &octx);
-	if (ret)
-		return -1;
+	for (started = 0; started < nr; started++) {
+		pid_t pid = item->threads[ids[started]].real;
+		void *stack = ctl->r_thread_stack + (started + 1) * PARASITE_STACK_SIZE;
 
-	tc->has_blk_sigset = true;
-	memcpy(&tc->blk_sigset, &octx.sigmask, sizeof(k_rtsigset_t));
+		if (get_thread_ctx(pid, &octx[started])) {
+			ret = -1;
+			break;
+		}
 
-	ret = parasite_execute_trap_by_pid(PARASITE_CMD_DUMP_THREAD, ctl,
-			pid, ctl->r_thread_stack, &octx);
-	if (ret) {
-		pr_err("Can't init thread in parasite %d\n", pid);
-		return -1;
+		regs = octx[started].regs;
+		if (parasite_run(pid, PTRACE_CONT, ctl->parasite_ip, stack,
+					&regs, &octx[started])) {
+			ret = -1;
+			break;
+		}
 	}
 
-	ret = get_task_regs(pid, octx.regs, core);
-	if (ret) {
-		pr_err("Can't obtain regs for thread %d\n", pid);
-		return -1;
+	for (i = 0; i < started; i++) {
+		pid_t pid = item->threads[ids[i]].real;
+
+		if (parasite_trap(ctl, pid, &regs, &octx[i]) || REG_RES(regs)) {
+			pr_err("Can't init thread in parasite %d\n", pid);
+			ret = -1;
+		}
+	}
+
+	for (i = 0; !ret && i < nr; i++) {
+		struct pid *tid = &item->threads[ids[i]];
+		CoreEntry *core = item->core[ids[i]];
+		ThreadCoreEntry *tc = core->thread_core;
+
+		tc->has_blk_sigset = true;
+		memcpy(&tc->blk_sigset, &octx[i].sigmask, sizeof(k_rtsigset_t));
+
+		ret = get_task_regs(tid->real, octx[i].regs, core);
+		if (ret) {
+			pr_err("Can't obtain regs for thread %d\n", tid->real);
+			break;
+		}
+
+		tid->virt = args->ti[i].tid;
+		ret = dump_thread_core(tid->real, core, &args->ti[i]);
+	}
+
+	return ret;
+}
+
+/* Leader is dumped in dump_task_core_all, here go the rest */
+int parasite_dump_threads_seized(struct parasite_ctl *ctl, struct pstree_item *item)
+{
+	int ids[PARASITE_THREADS_BATCH];
+	unsigned int nr = 0;
+	int i;
+
+	for (i = 0; i < item->nr_threads; i++) {
+		if (item->threads[i].real == item->pid.real)
+			continue;
+
+		ids[nr++] = i;
+		if (nr == ctl->nr_thread_stacks) {
+			if (dump_threads_batch(ctl, item, ids, nr))
+				return -1;
+			nr = 0;
+		}
 	}
 
-	tid->virt = args->tid;
-	return dump_thread_core(pid, core, args);
+	if (nr && dump_threads_batch(ctl, item, ids, nr))
+		return -1;
+
+	return 0;
 }
 
 int parasite_dump_sigacts_seized(struct parasite_ctl *ctl, struct cr_fdset *cr_fdset)
@@ -1156,8 +1192,10 @@ struct parasite_ctl *parasite_infect_seized(pid_t pid, struct pstree_item *item,
 	ctl->args_size = parasite_args_size(vma_area_list, dfds, timer_n);
 	map_exchange_size = parasite_size + ctl->args_size;
 	map_exchange_size += RESTORE_STACK_SIGFRAME + PARASITE_STACK_SIZE;
-	if (item->nr_threads > 1)
-		map_exchange_size += PARASITE_STACK_SIZE;
+	if (item->nr_threads > 1) {
+		ctl->nr_thread_stacks = min(item->nr_threads - 1, PARASITE_THREADS_BATCH);
+		map_exchange_size += ctl->nr_thread_stacks * PARASITE_STACK_SIZE;
+	}
 
 	memcpy(&item->core[0]->tc->blk_sigset, &ctl->orig.sigmask, sizeof(k_rtsigset_t));
 
@@ -1182,10 +1220,8 @@ struct parasite_ctl *parasite_infect_seized(pid_t pid, struct pstree_item *item,
 	p += PARASITE_STACK_SIZE;
 	ctl->rstack = ctl->remote_map + p;
 
-	if (item->nr_threads > 1) {
-		p += PARASITE_STACK_SIZE;
+	if (item->nr_threads > 1)
 		ctl->r_thread_stack = ctl->remote_map + p;
-	}
 
 	if (parasite_start_daemon(ctl, item))
 		goto err_restore;
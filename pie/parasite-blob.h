@@ -0,0 +1,1201 @@
+/* Autogenerated by pie/../scripts/gen-offsets.sh, do not edit */
+#ifndef __parasite_h__
+#define __parasite_h__
+
+#define parasite_blob_offset____export_parasite_args 0x0000000000002520
+#define parasite_blob_offset____export_parasite_cmd 0x0000000000000020
+#define parasite_blob_offset____export_parasite_head_start 0x0000000000000000
+
+static char parasite_blob[] = {
+0x48, 0x83, 0xec, 0x10, 0x48, 0x83, 0xe4, 0xf0, 
+0x6a, 0x00, 0x48, 0x89, 0xe5, 0x8b, 0x3d, 0x0d, 
+0x00, 0x00, 0x00, 0x48, 0x8d, 0x35, 0x06, 0x25, 
+0x00, 0x00, 0xe8, 0x61, 0x0c, 0x00, 0x00, 0xcc, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x41, 0x55, 0x41, 0x54, 0x49, 0x89, 0xfc, 0x55, 
+0x53, 0x48, 0x83, 0xec, 0x08, 0x8b, 0x37, 0x85, 
+0xf6, 0x74, 0x6d, 0x48, 0x8d, 0x5f, 0x10, 0x31, 
+0xed, 0xeb, 0x12, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x83, 0xc5, 0x01, 0x48, 0x83, 0xc3, 0x18, 0x41, 
+0x3b, 0x2c, 0x24, 0x73, 0x53, 0x48, 0x8b, 0x73, 
+0x08, 0x48, 0x8b, 0x3b, 0x8b, 0x53, 0x10, 0x41, 
+0x0b, 0x54, 0x24, 0x04, 0xe8, 0x43, 0x1a, 0x00, 
+0x00, 0x41, 0x89, 0xc5, 0x85, 0xc0, 0x74, 0xd8, 
+0x48, 0x83, 0xec, 0x08, 0x4c, 0x8b, 0x4b, 0x08, 
+0x4c, 0x8b, 0x03, 0xb9, 0x2f, 0x00, 0x00, 0x00, 
+0x50, 0x48, 0x8d, 0x15, 0x40, 0x1e, 0x00, 0x00, 
+0x48, 0x8d, 0x35, 0x31, 0x1f, 0x00, 0x00, 0x31, 
+0xc0, 0xbf, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x6d, 
+0x0e, 0x00, 0x00, 0x5a, 0x59, 0xeb, 0x0c, 0x66, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x31, 0xed, 0x41, 0x8b, 0x44, 0x24, 0x04, 
+0x85, 0xc0, 0x75, 0x03, 0x45, 0x31, 0xe4, 0x4c, 
+0x89, 0x25, 0x3a, 0x24, 0x00, 0x00, 0x48, 0x83, 
+0xc4, 0x08, 0x44, 0x89, 0xe8, 0x5b, 0x5d, 0x41, 
+0x5c, 0x41, 0x5d, 0xc3, 0x66, 0x66, 0x2e, 0x0f, 
+0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 
+0x48, 0x83, 0xec, 0x18, 0x66, 0x0f, 0x6e, 0xcf, 
+0x8b, 0x3d, 0xa2, 0x1d, 0x00, 0x00, 0x31, 0xc9, 
+0x89, 0x74, 0x24, 0x08, 0x66, 0x0f, 0x70, 0xc1, 
+0xe0, 0x45, 0x31, 0xc9, 0x45, 0x31, 0xc0, 0x48, 
+0x89, 0xe6, 0xba, 0x0c, 0x00, 0x00, 0x00, 0x66, 
+0x0f, 0xd6, 0x04, 0x24, 0xe8, 0x6b, 0x1a, 0x00, 
+0x00, 0x83, 0xf8, 0x0c, 0x75, 0x2a, 0x44, 0x8b, 
+0x44, 0x24, 0x08, 0x8b, 0x4c, 0x24, 0x04, 0x31, 
+0xc0, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x8b, 0x14, 
+0x24, 0x48, 0x8d, 0x35, 0xaf, 0x1d, 0x00, 0x00, 
+0xe8, 0xdb, 0x0d, 0x00, 0x00, 0x31, 0xc0, 0x48, 
+0x83, 0xc4, 0x18, 0xc3, 0x0f, 0x1f, 0x40, 0x00, 
+0x41, 0x89, 0xc0, 0x41, 0xb9, 0x0c, 0x00, 0x00, 
+0x00, 0x31, 0xc0, 0xb9, 0x66, 0x01, 0x00, 0x00, 
+0x48, 0x8d, 0x15, 0x79, 0x1d, 0x00, 0x00, 0x48, 
+0x8d, 0x35, 0xaa, 0x1e, 0x00, 0x00, 0xbf, 0x01, 
+0x00, 0x00, 0x00, 0xe8, 0xa8, 0x0d, 0x00, 0x00, 
+0xb8, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xc8, 0x90, 
+0x48, 0x83, 0xec, 0x08, 0x48, 0x8b, 0x77, 0x08, 
+0x48, 0x8b, 0x3f, 0xe8, 0x3c, 0x19, 0x00, 0x00, 
+0x4c, 0x8d, 0x05, 0x49, 0x1d, 0x00, 0x00, 0x31, 
+0xc0, 0x41, 0xb9, 0xf8, 0x01, 0x00, 0x00, 0xb9, 
+0xf8, 0x01, 0x00, 0x00, 0x4c, 0x89, 0xc2, 0xbf, 
+0x01, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x35, 0x56, 
+0x1d, 0x00, 0x00, 0xe8, 0x68, 0x0d, 0x00, 0x00, 
+0x48, 0xc7, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0f, 0x0b, 0x66, 0x2e, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x55, 0x48, 0x89, 0xe5, 0x41, 0x56, 0x53, 0x48, 
+0x8b, 0x3d, 0x32, 0x23, 0x00, 0x00, 0x48, 0x85, 
+0xff, 0x74, 0x0a, 0x31, 0xc0, 0x89, 0x47, 0x04, 
+0xe8, 0x53, 0xfe, 0xff, 0xff, 0x48, 0x8b, 0x05, 
+0x24, 0x23, 0x00, 0x00, 0x4c, 0x8b, 0xb0, 0xb0, 
+0x00, 0x00, 0x00, 0x48, 0x8d, 0x58, 0x08, 0xe8, 
+0x44, 0x1b, 0x00, 0x00, 0x48, 0x89, 0xd9, 0xbf, 
+0x04, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x35, 0x13, 
+0x1d, 0x00, 0x00, 0x48, 0x89, 0xc2, 0x4d, 0x89, 
+0xf0, 0x31, 0xc0, 0xe8, 0x00, 0x0d, 0x00, 0x00, 
+0x8b, 0x3d, 0x7a, 0x1c, 0x00, 0x00, 0xe8, 0x81, 
+0x18, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 
+0xe8, 0x2b, 0x0c, 0x00, 0x00, 0x48, 0x89, 0xd8, 
+0x48, 0x89, 0xc4, 0xb8, 0x0f, 0x00, 0x00, 0x00, 
+0x0f, 0x05, 0x4c, 0x8d, 0x05, 0x97, 0x1c, 0x00, 
+0x00, 0x41, 0xb9, 0x9a, 0x01, 0x00, 0x00, 0x31, 
+0xc0, 0xb9, 0x9a, 0x01, 0x00, 0x00, 0x4c, 0x89, 
+0xc2, 0x48, 0x8d, 0x35, 0xa9, 0x1c, 0x00, 0x00, 
+0xbf, 0x01, 0x00, 0x00, 0x00, 0xe8, 0xb6, 0x0c, 
+0x00, 0x00, 0x48, 0xc7, 0x04, 0x25, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0b, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x41, 0x57, 0x48, 0x8d, 0x35, 0xb5, 0x1c, 0x00, 
+0x00, 0x31, 0xc0, 0x41, 0x56, 0x41, 0x55, 0x41, 
+0x54, 0x55, 0x53, 0x48, 0x89, 0xfb, 0xbf, 0x04, 
+0x00, 0x00, 0x00, 0x48, 0x83, 0xec, 0x38, 0x48, 
+0xc7, 0x44, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 
+0xc7, 0x44, 0x24, 0x2c, 0x00, 0x00, 0x00, 0x00, 
+0xe8, 0x6b, 0x0c, 0x00, 0x00, 0x31, 0xf6, 0xbf, 
+0x02, 0x00, 0x00, 0x00, 0xe8, 0x2f, 0xfe, 0xff, 
+0xff, 0x85, 0xc0, 0x0f, 0x85, 0x92, 0x00, 0x00, 
+0x00, 0x89, 0xc5, 0x48, 0x8d, 0x44, 0x24, 0x24, 
+0x4c, 0x8d, 0x35, 0x85, 0x1c, 0x00, 0x00, 0x48, 
+0x89, 0x04, 0x24, 0x4c, 0x8d, 0x25, 0xce, 0x1b, 
+0x00, 0x00, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x4c, 0x89, 0xf6, 0xbf, 0x04, 0x00, 0x00, 0x00, 
+0x31, 0xc0, 0xe8, 0x29, 0x0c, 0x00, 0x00, 0x48, 
+0x8b, 0x34, 0x24, 0x45, 0x31, 0xc9, 0x45, 0x31, 
+0xc0, 0x8b, 0x3d, 0x99, 0x1b, 0x00, 0x00, 0xb9, 
+0x00, 0x01, 0x00, 0x00, 0xba, 0x0c, 0x00, 0x00, 
+0x00, 0x48, 0xc7, 0x44, 0x24, 0x24, 0x00, 0x00, 
+0x00, 0x00, 0xc7, 0x44, 0x24, 0x2c, 0x00, 0x00, 
+0x00, 0x00, 0xe8, 0x71, 0x18, 0x00, 0x00, 0x83, 
+0xf8, 0x0c, 0x0f, 0x85, 0xc7, 0x06, 0x00, 0x00, 
+0x44, 0x8b, 0x44, 0x24, 0x2c, 0x8b, 0x4c, 0x24, 
+0x28, 0x31, 0xc0, 0xbf, 0x04, 0x00, 0x00, 0x00, 
+0x8b, 0x54, 0x24, 0x24, 0x48, 0x8d, 0x35, 0x2a, 
+0x1c, 0x00, 0x00, 0xe8, 0xd0, 0x0b, 0x00, 0x00, 
+0x85, 0xed, 0x74, 0x14, 0x83, 0x7c, 0x24, 0x24, 
+0x06, 0x75, 0x2d, 0x31, 0xc0, 0xe8, 0x6e, 0xfe, 
+0xff, 0xff, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x44, 0x8b, 0x44, 0x24, 0x24, 0x41, 0x8d, 0x40, 
+0xfa, 0x83, 0xf8, 0x0b, 0x0f, 0x87, 0x0b, 0x05, 
+0x00, 0x00, 0x49, 0x63, 0x04, 0x84, 0x4c, 0x01, 
+0xe0, 0xff, 0xe0, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0xb9, 0xb1, 0x01, 0x00, 0x00, 0x48, 0x8d, 0x15, 
+0x4c, 0x1b, 0x00, 0x00, 0x48, 0x8d, 0x35, 0xed, 
+0x1c, 0x00, 0x00, 0x31, 0xc0, 0xbf, 0x01, 0x00, 
+0x00, 0x00, 0xe8, 0x79, 0x0b, 0x00, 0x00, 0xe9, 
+0x3c, 0xff, 0xff, 0xff, 0x8b, 0x3b, 0x48, 0x8d, 
+0x53, 0x04, 0xbe, 0x29, 0x54, 0x00, 0x00, 0xe8, 
+0x38, 0x17, 0x00, 0x00, 0x41, 0x89, 0xc0, 0x85, 
+0xc0, 0x0f, 0x88, 0x45, 0x05, 0x00, 0x00, 0x8b, 
+0x3b, 0x48, 0x8d, 0x53, 0x08, 0xbe, 0x0f, 0x54, 
+0x00, 0x00, 0xe8, 0x1d, 0x17, 0x00, 0x00, 0x41, 
+0x89, 0xc0, 0x85, 0xc0, 0x0f, 0x88, 0x43, 0x05, 
+0x00, 0x00, 0x8b, 0x3b, 0x48, 0x8d, 0x53, 0x10, 
+0xbe, 0x38, 0x54, 0x04, 0x80, 0xe8, 0x02, 0x17, 
+0x00, 0x00, 0x41, 0x89, 0xc0, 0x85, 0xc0, 0x0f, 
+0x88, 0x83, 0x06, 0x00, 0x00, 0x8b, 0x3b, 0x48, 
+0x8d, 0x53, 0x14, 0xbe, 0x39, 0x54, 0x04, 0x80, 
+0xe8, 0xe7, 0x16, 0x00, 0x00, 0x41, 0x89, 0xc0, 
+0x85, 0xc0, 0x0f, 0x88, 0x3d, 0x06, 0x00, 0x00, 
+0x8b, 0x3b, 0x48, 0x8d, 0x53, 0x18, 0xbe, 0x40, 
+0x54, 0x04, 0x80, 0xe8, 0xcc, 0x16, 0x00, 0x00, 
+0x41, 0x89, 0xc0, 0x85, 0xc0, 0x0f, 0x88, 0x60, 
+0x06, 0x00, 0x00, 0xc6, 0x43, 0x0c, 0x00, 0xeb, 
+0x77, 0x48, 0x8d, 0x74, 0x24, 0x1e, 0xba, 0x02, 
+0x00, 0x00, 0x00, 0x48, 0x8d, 0x3d, 0x44, 0x1b, 
+0x00, 0x00, 0xe8, 0x09, 0x18, 0x00, 0x00, 0x49, 
+0x89, 0xc7, 0x85, 0xc0, 0x0f, 0x89, 0x90, 0x03, 
+0x00, 0x00, 0x83, 0xf8, 0xfe, 0x0f, 0x84, 0x87, 
+0x03, 0x00, 0x00, 0x4c, 0x8d, 0x2d, 0x76, 0x1a, 
+0x00, 0x00, 0x89, 0x44, 0x24, 0x0c, 0x41, 0x89, 
+0xc0, 0xb9, 0xea, 0x00, 0x00, 0x00, 0x4c, 0x89, 
+0xea, 0x48, 0x8d, 0x35, 0xe8, 0x1d, 0x00, 0x00, 
+0xe9, 0x5e, 0x04, 0x00, 0x00, 0x44, 0x8b, 0x03, 
+0x8b, 0x3d, 0x12, 0x1a, 0x00, 0x00, 0x48, 0x8d, 
+0x4b, 0x04, 0x31, 0xd2, 0x41, 0xb9, 0x01, 0x00, 
+0x00, 0x00, 0x31, 0xf6, 0xe8, 0xbf, 0x11, 0x00, 
+0x00, 0x41, 0x89, 0xc7, 0x85, 0xc0, 0x0f, 0x85, 
+0xdc, 0x04, 0x00, 0x00, 0x0f, 0x1f, 0x40, 0x00, 
+0x8b, 0x7c, 0x24, 0x24, 0x31, 0xf6, 0xe8, 0x35, 
+0xfc, 0xff, 0xff, 0x85, 0xc0, 0x0f, 0x84, 0x25, 
+0xfe, 0xff, 0xff, 0xe9, 0x93, 0xfe, 0xff, 0xff, 
+0x45, 0x31, 0xc0, 0x31, 0xc9, 0x31, 0xd2, 0x31, 
+0xf6, 0xbf, 0x1b, 0x00, 0x00, 0x00, 0xe8, 0x31, 
+0x18, 0x00, 0x00, 0x31, 0xff, 0x31, 0xf6, 0x89, 
+0x03, 0xe8, 0x8a, 0x17, 0x00, 0x00, 0x89, 0xc7, 
+0x85, 0xc0, 0x0f, 0x88, 0x22, 0x06, 0x00, 0x00, 
+0x89, 0x43, 0x04, 0x3d, 0xf7, 0x03, 0x00, 0x00, 
+0x0f, 0x87, 0x4d, 0x06, 0x00, 0x00, 0x48, 0x8d, 
+0x73, 0x08, 0xe8, 0x69, 0x17, 0x00, 0x00, 0x89, 
+0xc7, 0x85, 0xc0, 0x0f, 0x88, 0x01, 0x06, 0x00, 
+0x00, 0x44, 0x8b, 0x43, 0x04, 0x41, 0x39, 0xc0, 
+0x74, 0x96, 0x4c, 0x8d, 0x2d, 0xbf, 0x19, 0x00, 
+0x00, 0x41, 0x89, 0xc1, 0x31, 0xc0, 0xb9, 0xbb, 
+0x00, 0x00, 0x00, 0x4c, 0x89, 0xea, 0x48, 0x8d, 
+0x35, 0xa3, 0x1c, 0x00, 0x00, 0xbf, 0x01, 0x00, 
+0x00, 0x00, 0xe8, 0xe1, 0x09, 0x00, 0x00, 0xe9, 
+0x63, 0x03, 0x00, 0x00, 0x31, 0xff, 0xe8, 0x89, 
+0x15, 0x00, 0x00, 0x48, 0x89, 0x03, 0xe8, 0x15, 
+0x16, 0x00, 0x00, 0x89, 0x43, 0x08, 0xe8, 0x5d, 
+0x17, 0x00, 0x00, 0x31, 0xff, 0x89, 0x43, 0x0c, 
+0xe8, 0x2f, 0x17, 0x00, 0x00, 0x31, 0xff, 0x89, 
+0x43, 0x10, 0xe8, 0xf5, 0x16, 0x00, 0x00, 0x89, 
+0x43, 0x14, 0x89, 0xc7, 0xe8, 0xeb, 0x16, 0x00, 
+0x00, 0x45, 0x31, 0xd2, 0x48, 0x8d, 0x73, 0x18, 
+0x45, 0x31, 0xc0, 0x44, 0x89, 0x53, 0x24, 0x31, 
+0xc9, 0x31, 0xd2, 0xbf, 0x28, 0x00, 0x00, 0x00, 
+0xe8, 0x77, 0x17, 0x00, 0x00, 0x49, 0x89, 0xc5, 
+0x89, 0xc6, 0x85, 0xc0, 0x0f, 0x84, 0xd3, 0x03, 
+0x00, 0x00, 0x8b, 0x7c, 0x24, 0x24, 0xe8, 0x45, 
+0xfb, 0xff, 0xff, 0x85, 0xc0, 0x0f, 0x85, 0xa8, 
+0xfd, 0xff, 0xff, 0x44, 0x89, 0xed, 0x4c, 0x8d, 
+0x2d, 0x23, 0x19, 0x00, 0x00, 0xb9, 0xe3, 0x01, 
+0x00, 0x00, 0x4c, 0x89, 0xea, 0xbf, 0x01, 0x00, 
+0x00, 0x00, 0x31, 0xc0, 0x48, 0x8d, 0x35, 0x95, 
+0x1d, 0x00, 0x00, 0xe8, 0x48, 0x09, 0x00, 0x00, 
+0x8b, 0x3d, 0xc2, 0x18, 0x00, 0x00, 0xbe, 0x01, 
+0x00, 0x00, 0x00, 0xe8, 0xd4, 0x15, 0x00, 0x00, 
+0xe9, 0xfb, 0xfc, 0xff, 0xff, 0x31, 0xd2, 0x83, 
+0x3b, 0x00, 0x4c, 0x8d, 0x6b, 0x10, 0x41, 0x89, 
+0xd7, 0x7f, 0x2e, 0xe9, 0xa6, 0x04, 0x00, 0x00, 
+0x41, 0x8b, 0x7d, 0xf8, 0xe8, 0xab, 0x17, 0x00, 
+0x00, 0x41, 0x89, 0x45, 0x20, 0x41, 0x89, 0xc1, 
+0x85, 0xc0, 0x0f, 0x88, 0x0c, 0x04, 0x00, 0x00, 
+0x41, 0x83, 0xc7, 0x01, 0x49, 0x83, 0xc5, 0x30, 
+0x44, 0x3b, 0x3b, 0x0f, 0x8d, 0x91, 0x00, 0x00, 
+0x00, 0x41, 0x8b, 0x7d, 0xf8, 0x4c, 0x89, 0xee, 
+0xe8, 0x73, 0x17, 0x00, 0x00, 0x85, 0xc0, 0x79, 
+0xc7, 0x89, 0x44, 0x24, 0x0c, 0x49, 0x89, 0xc7, 
+0x41, 0x89, 0xc0, 0xb9, 0x7f, 0x00, 0x00, 0x00, 
+0x4c, 0x8d, 0x2d, 0x91, 0x18, 0x00, 0x00, 0x48, 
+0x8d, 0x35, 0xea, 0x1a, 0x00, 0x00, 0x4c, 0x89, 
+0xea, 0xe9, 0x85, 0x02, 0x00, 0x00, 0x31, 0xff, 
+0x48, 0x89, 0xde, 0xe8, 0xe8, 0x14, 0x00, 0x00, 
+0x85, 0xc0, 0x0f, 0x84, 0x56, 0x03, 0x00, 0x00, 
+0x89, 0xc5, 0x41, 0x89, 0xc0, 0x4c, 0x8d, 0x2d, 
+0x64, 0x18, 0x00, 0x00, 0x31, 0xc0, 0x48, 0x8d, 
+0x35, 0x93, 0x1a, 0x00, 0x00, 0xbf, 0x01, 0x00, 
+0x00, 0x00, 0xb9, 0x72, 0x00, 0x00, 0x00, 0x4c, 
+0x89, 0xea, 0xe8, 0x89, 0x08, 0x00, 0x00, 0x8b, 
+0x7c, 0x24, 0x24, 0x89, 0xee, 0xe8, 0x4e, 0xfa, 
+0xff, 0xff, 0x85, 0xc0, 0x0f, 0x84, 0x13, 0xff, 
+0xff, 0xff, 0xe9, 0xac, 0xfc, 0xff, 0xff, 0x48, 
+0x89, 0xdf, 0xe8, 0x89, 0xf9, 0xff, 0xff, 0x41, 
+0x89, 0xc1, 0x8b, 0x7c, 0x24, 0x24, 0x44, 0x89, 
+0xce, 0x44, 0x89, 0x4c, 0x24, 0x0c, 0xe8, 0x25, 
+0xfa, 0xff, 0xff, 0x85, 0xc0, 0x0f, 0x85, 0x88, 
+0xfc, 0xff, 0xff, 0x44, 0x8b, 0x4c, 0x24, 0x0c, 
+0x45, 0x85, 0xc9, 0x0f, 0x84, 0x07, 0xfc, 0xff, 
+0xff, 0x44, 0x89, 0xcd, 0x4c, 0x8d, 0x2d, 0xf5, 
+0x17, 0x00, 0x00, 0xe9, 0xcd, 0xfe, 0xff, 0xff, 
+0x48, 0xba, 0x63, 0x72, 0x69, 0x75, 0x76, 0x64, 
+0x73, 0x6f, 0x48, 0x8b, 0x03, 0x48, 0x39, 0x10, 
+0x0f, 0x84, 0x50, 0x02, 0x00, 0x00, 0x31, 0xc0, 
+0x48, 0xc7, 0x43, 0x10, 0xff, 0xff, 0xff, 0xff, 
+0x89, 0x43, 0x18, 0x31, 0xf6, 0xbf, 0x11, 0x00, 
+0x00, 0x00, 0xe8, 0xd1, 0xf9, 0xff, 0xff, 0x85, 
+0xc0, 0x0f, 0x84, 0xc1, 0xfb, 0xff, 0xff, 0xe9, 
+0x2f, 0xfc, 0xff, 0xff, 0x41, 0xbd, 0x01, 0x00, 
+0x00, 0x00, 0x49, 0x89, 0xdf, 0x0f, 0x1f, 0x00, 
+0x41, 0x83, 0xfd, 0x09, 0x74, 0x3b, 0x41, 0x83, 
+0xfd, 0x13, 0x74, 0x35, 0xb9, 0x08, 0x00, 0x00, 
+0x00, 0x4c, 0x89, 0xfa, 0x31, 0xf6, 0x44, 0x89, 
+0xef, 0xe8, 0x86, 0x13, 0x00, 0x00, 0x41, 0x89, 
+0xc1, 0x85, 0xc0, 0x0f, 0x88, 0x62, 0x01, 0x00, 
+0x00, 0x41, 0x83, 0xc5, 0x01, 0x49, 0x83, 0xc7, 
+0x20, 0x41, 0x83, 0xfd, 0x41, 0x0f, 0x84, 0x47, 
+0xff, 0xff, 0xff, 0x41, 0x83, 0xfd, 0x09, 0x75, 
+0xc5, 0x41, 0x83, 0xc5, 0x01, 0x49, 0x83, 0xc7, 
+0x20, 0xeb, 0xb5, 0x8b, 0x3d, 0x17, 0x17, 0x00, 
+0x00, 0x31, 0xc9, 0x48, 0x8d, 0x74, 0x24, 0x20, 
+0xba, 0x01, 0x00, 0x00, 0x00, 0xe8, 0xf6, 0x10, 
+0x00, 0x00, 0x85, 0xc0, 0x0f, 0x85, 0x50, 0x03, 
+0x00, 0x00, 0x44, 0x8b, 0x6c, 0x24, 0x20, 0x45, 
+0x85, 0xed, 0x0f, 0x88, 0x42, 0x03, 0x00, 0x00, 
+0x8b, 0x03, 0x8b, 0x53, 0x08, 0x44, 0x89, 0xef, 
+0xb9, 0x0a, 0x00, 0x00, 0x00, 0x48, 0x6b, 0xc0, 
+0x18, 0x48, 0x8d, 0x74, 0x03, 0x10, 0xe8, 0x25, 
+0x16, 0x00, 0x00, 0x44, 0x89, 0xef, 0x49, 0x89, 
+0xc7, 0x8b, 0x43, 0x0c, 0xc1, 0xe0, 0x0c, 0x44, 
+0x39, 0xf8, 0x0f, 0x85, 0xdf, 0x02, 0x00, 0x00, 
+0xe8, 0xc7, 0x12, 0x00, 0x00, 0xe9, 0xc6, 0xfc, 
+0xff, 0xff, 0x41, 0x83, 0xef, 0x01, 0x75, 0x0b, 
+0x80, 0x7c, 0x24, 0x1e, 0x31, 0x0f, 0x84, 0x6d, 
+0x02, 0x00, 0x00, 0x4c, 0x8d, 0x3d, 0x8e, 0x16, 
+0x00, 0x00, 0xbe, 0xc0, 0x01, 0x00, 0x00, 0x4c, 
+0x89, 0xff, 0xe8, 0x25, 0x14, 0x00, 0x00, 0x85, 
+0xc0, 0x0f, 0x85, 0x52, 0x03, 0x00, 0x00, 0x48, 
+0x8d, 0x3d, 0x7c, 0x17, 0x00, 0x00, 0x45, 0x31, 
+0xc0, 0xb9, 0x00, 0x00, 0xed, 0xc0, 0x4c, 0x89, 
+0xfe, 0x48, 0x89, 0xfa, 0xe8, 0xff, 0x14, 0x00, 
+0x00, 0x85, 0xc0, 0x0f, 0x85, 0x4e, 0x03, 0x00, 
+0x00, 0x4c, 0x89, 0xff, 0xe8, 0x4f, 0x0d, 0x00, 
+0x00, 0x41, 0x89, 0xc5, 0x45, 0x85, 0xed, 0x0f, 
+0x88, 0xd0, 0x00, 0x00, 0x00, 0x8b, 0x3d, 0x4d, 
+0x16, 0x00, 0x00, 0x45, 0x31, 0xc9, 0x48, 0x8d, 
+0x4c, 0x24, 0x20, 0x31, 0xd2, 0x41, 0xb8, 0x01, 
+0x00, 0x00, 0x00, 0x31, 0xf6, 0x44, 0x89, 0x6c, 
+0x24, 0x20, 0xe8, 0xf1, 0x0d, 0x00, 0x00, 0x44, 
+0x89, 0xef, 0x89, 0x44, 0x24, 0x0c, 0xe8, 0x31, 
+0x12, 0x00, 0x00, 0x44, 0x8b, 0x4c, 0x24, 0x0c, 
+0xe9, 0x35, 0xfe, 0xff, 0xff, 0x4c, 0x8d, 0x2d, 
+0x54, 0x16, 0x00, 0x00, 0xb9, 0xda, 0x01, 0x00, 
+0x00, 0x48, 0x8d, 0x35, 0x88, 0x1a, 0x00, 0x00, 
+0x4c, 0x89, 0xea, 0xbf, 0x01, 0x00, 0x00, 0x00, 
+0x31, 0xc0, 0xe8, 0x79, 0x06, 0x00, 0x00, 0x8b, 
+0x7c, 0x24, 0x24, 0x83, 0xce, 0xff, 0xe8, 0x3d, 
+0xf8, 0xff, 0xff, 0x85, 0xc0, 0x0f, 0x85, 0xa0, 
+0xfa, 0xff, 0xff, 0x83, 0xcd, 0xff, 0xe9, 0xfa, 
+0xfc, 0xff, 0xff, 0x89, 0x44, 0x24, 0x0c, 0x49, 
+0x89, 0xc7, 0x41, 0x89, 0xc0, 0xb9, 0x5f, 0x00, 
+0x00, 0x00, 0x4c, 0x8d, 0x2d, 0x07, 0x16, 0x00, 
+0x00, 0x48, 0x8d, 0x35, 0x08, 0x18, 0x00, 0x00, 
+0x4c, 0x89, 0xea, 0xbf, 0x01, 0x00, 0x00, 0x00, 
+0x31, 0xc0, 0xe8, 0x31, 0x06, 0x00, 0x00, 0x8b, 
+0x74, 0x24, 0x0c, 0x8b, 0x7c, 0x24, 0x24, 0xe8, 
+0xf4, 0xf7, 0xff, 0xff, 0x85, 0xc0, 0x0f, 0x85, 
+0x57, 0xfa, 0xff, 0xff, 0x44, 0x89, 0xfd, 0xe9, 
+0xb1, 0xfc, 0xff, 0xff, 0x83, 0xf8, 0xe7, 0x75, 
+0x1d, 0x45, 0x31, 0xc9, 0x44, 0x89, 0x4b, 0x04, 
+0xe9, 0xaa, 0xfa, 0xff, 0xff, 0x44, 0x89, 0xee, 
+0xe9, 0x7d, 0xfc, 0xff, 0xff, 0x83, 0xf8, 0xe7, 
+0x0f, 0x84, 0x1b, 0x01, 0x00, 0x00, 0x41, 0x83, 
+0xf8, 0xfb, 0x0f, 0x85, 0xf8, 0x01, 0x00, 0x00, 
+0x31, 0xd2, 0x48, 0xc7, 0x43, 0x04, 0x00, 0x00, 
+0x00, 0x00, 0x48, 0xc7, 0x43, 0x10, 0x00, 0x00, 
+0x00, 0x00, 0x89, 0x53, 0x18, 0xc6, 0x43, 0x0c, 
+0x01, 0xe9, 0x5a, 0xfb, 0xff, 0xff, 0x48, 0x83, 
+0x78, 0x08, 0xff, 0x0f, 0x84, 0xa5, 0xfd, 0xff, 
+0xff, 0xc7, 0x43, 0x18, 0x01, 0x00, 0x00, 0x00, 
+0x48, 0x8b, 0x40, 0x08, 0x48, 0x89, 0x43, 0x10, 
+0xe9, 0x9e, 0xfd, 0xff, 0xff, 0x48, 0x8d, 0x73, 
+0x28, 0x31, 0xff, 0xe8, 0x5c, 0x13, 0x00, 0x00, 
+0x41, 0x89, 0xc1, 0xe9, 0x32, 0xfd, 0xff, 0xff, 
+0x4c, 0x8d, 0x2d, 0x51, 0x15, 0x00, 0x00, 0x41, 
+0x89, 0xc0, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x31, 
+0xc0, 0x48, 0x8d, 0x35, 0xa0, 0x18, 0x00, 0x00, 
+0xb9, 0xce, 0x00, 0x00, 0x00, 0x4c, 0x89, 0xea, 
+0xe8, 0x73, 0x05, 0x00, 0x00, 0x8b, 0x7c, 0x24, 
+0x24, 0x44, 0x89, 0xfe, 0xe8, 0x37, 0xf7, 0xff, 
+0xff, 0x85, 0xc0, 0x0f, 0x84, 0x43, 0xff, 0xff, 
+0xff, 0xe9, 0x95, 0xf9, 0xff, 0xff, 0x48, 0x8d, 
+0x73, 0x20, 0xbf, 0x01, 0x00, 0x00, 0x00, 0xe8, 
+0x7c, 0x11, 0x00, 0x00, 0x85, 0xc0, 0x0f, 0x85, 
+0x94, 0xfc, 0xff, 0xff, 0x48, 0x8d, 0x73, 0x40, 
+0xbf, 0x02, 0x00, 0x00, 0x00, 0xe8, 0x66, 0x11, 
+0x00, 0x00, 0x85, 0xc0, 0x0f, 0x84, 0xbe, 0xfa, 
+0xff, 0xff, 0xe9, 0x79, 0xfc, 0xff, 0xff, 0x41, 
+0x89, 0xc1, 0x41, 0xb8, 0x0c, 0x00, 0x00, 0x00, 
+0x31, 0xc0, 0xb9, 0x7b, 0x01, 0x00, 0x00, 0x48, 
+0x8d, 0x15, 0xd2, 0x14, 0x00, 0x00, 0x48, 0x8d, 
+0x35, 0x3b, 0x16, 0x00, 0x00, 0xbf, 0x01, 0x00, 
+0x00, 0x00, 0xe8, 0x01, 0x05, 0x00, 0x00, 0xe9, 
+0x37, 0xf9, 0xff, 0xff, 0x89, 0x44, 0x24, 0x0c, 
+0x49, 0x89, 0xc7, 0x41, 0x89, 0xc0, 0xb9, 0x85, 
+0x00, 0x00, 0x00, 0x4c, 0x8d, 0x2d, 0xa6, 0x14, 
+0x00, 0x00, 0x48, 0x8d, 0x35, 0x2f, 0x17, 0x00, 
+0x00, 0x4c, 0x89, 0xea, 0xe9, 0x9a, 0xfe, 0xff, 
+0xff, 0x45, 0x31, 0xc0, 0x44, 0x89, 0x43, 0x08, 
+0xe9, 0x8d, 0xf9, 0xff, 0xff, 0x83, 0xf8, 0xe7, 
+0x0f, 0x85, 0xd0, 0xfe, 0xff, 0xff, 0x31, 0xf6, 
+0x89, 0x73, 0x14, 0xe9, 0xb0, 0xf9, 0xff, 0xff, 
+0x31, 0xd2, 0x31, 0xf6, 0x48, 0x8d, 0x3d, 0x26, 
+0x15, 0x00, 0x00, 0xe8, 0x2c, 0x10, 0x00, 0x00, 
+0x41, 0x89, 0xc5, 0xe9, 0xc4, 0xfd, 0xff, 0xff, 
+0x83, 0xf8, 0xe7, 0x0f, 0x85, 0xa5, 0xfe, 0xff, 
+0xff, 0x31, 0xff, 0x89, 0x7b, 0x10, 0xe9, 0x6a, 
+0xf9, 0xff, 0xff, 0x83, 0xf8, 0xe7, 0x0f, 0x85, 
+0x92, 0xfe, 0xff, 0xff, 0x31, 0xc9, 0x89, 0x4b, 
+0x18, 0xe9, 0x8d, 0xf9, 0xff, 0xff, 0x31, 0xf6, 
+0xbf, 0x0b, 0x00, 0x00, 0x00, 0xe8, 0x3e, 0xf6, 
+0xff, 0xff, 0x85, 0xc0, 0x0f, 0x84, 0x2e, 0xf8, 
+0xff, 0xff, 0xe9, 0x9c, 0xf8, 0xff, 0xff, 0xe8, 
+0xe8, 0x0f, 0x00, 0x00, 0x44, 0x8b, 0x4b, 0x0c, 
+0x45, 0x89, 0xf8, 0x31, 0xc0, 0x4c, 0x8d, 0x2d, 
+0x0c, 0x14, 0x00, 0x00, 0xb9, 0x4b, 0x00, 0x00, 
+0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x89, 
+0xea, 0x48, 0x8d, 0x35, 0xc8, 0x15, 0x00, 0x00, 
+0xe8, 0x33, 0x04, 0x00, 0x00, 0xe9, 0xb5, 0xfd, 
+0xff, 0xff, 0x8b, 0x7c, 0x24, 0x24, 0x83, 0xce, 
+0xff, 0xe8, 0xf2, 0xf5, 0xff, 0xff, 0x85, 0xc0, 
+0x0f, 0x85, 0x55, 0xf8, 0xff, 0xff, 0x4c, 0x8d, 
+0x2d, 0xd3, 0x13, 0x00, 0x00, 0xe9, 0xa9, 0xfd, 
+0xff, 0xff, 0x4c, 0x8d, 0x2d, 0xc7, 0x13, 0x00, 
+0x00, 0x41, 0x89, 0xf8, 0xb9, 0xc3, 0x00, 0x00, 
+0x00, 0x4c, 0x89, 0xea, 0x48, 0x8d, 0x35, 0xe5, 
+0x16, 0x00, 0x00, 0xe9, 0x6b, 0xfd, 0xff, 0xff, 
+0x4c, 0x8d, 0x2d, 0xa9, 0x13, 0x00, 0x00, 0xb9, 
+0x40, 0x01, 0x00, 0x00, 0x48, 0x8d, 0x35, 0xad, 
+0x17, 0x00, 0x00, 0x4c, 0x89, 0xea, 0xe9, 0x50, 
+0xfd, 0xff, 0xff, 0x4c, 0x8d, 0x2d, 0x8e, 0x13, 
+0x00, 0x00, 0x41, 0x89, 0xc0, 0xb9, 0xb2, 0x00, 
+0x00, 0x00, 0x4c, 0x89, 0xea, 0x48, 0x8d, 0x35, 
+0x44, 0x16, 0x00, 0x00, 0xe9, 0x32, 0xfd, 0xff, 
+0xff, 0x4c, 0x8d, 0x2d, 0x70, 0x13, 0x00, 0x00, 
+0x41, 0x89, 0xc0, 0xb9, 0xf6, 0x00, 0x00, 0x00, 
+0x4c, 0x89, 0xea, 0x48, 0x8d, 0x35, 0x16, 0x17, 
+0x00, 0x00, 0xe9, 0x14, 0xfd, 0xff, 0xff, 0x4c, 
+0x8d, 0x2d, 0x52, 0x13, 0x00, 0x00, 0x41, 0x89, 
+0xc0, 0x31, 0xc0, 0xb9, 0xfc, 0x00, 0x00, 0x00, 
+0x4c, 0x89, 0xea, 0x48, 0x8d, 0x35, 0x26, 0x17, 
+0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 0xe8, 
+0x74, 0x03, 0x00, 0x00, 0x4c, 0x89, 0xff, 0xe8, 
+0x8c, 0x10, 0x00, 0x00, 0xe9, 0xee, 0xfc, 0xff, 
+0xff, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x53, 0x31, 0xd2, 0x48, 0x89, 0xfb, 0xbe, 0x05, 
+0x00, 0x00, 0x00, 0x48, 0x83, 0xec, 0x10, 0x48, 
+0x8b, 0x47, 0x78, 0xbf, 0x01, 0x00, 0x00, 0x00, 
+0x48, 0x89, 0x05, 0x39, 0x19, 0x00, 0x00, 0xe8, 
+0x90, 0x0f, 0x00, 0x00, 0x89, 0x05, 0xb6, 0x12, 
+0x00, 0x00, 0x85, 0xc0, 0x78, 0x49, 0x8b, 0x13, 
+0x89, 0xc7, 0x48, 0x8d, 0x73, 0x04, 0xe8, 0x85, 
+0x0f, 0x00, 0x00, 0x85, 0xc0, 0x78, 0x61, 0x8b, 
+0x3d, 0x9b, 0x12, 0x00, 0x00, 0x31, 0xc9, 0x48, 
+0x8d, 0x74, 0x24, 0x0c, 0xba, 0x01, 0x00, 0x00, 
+0x00, 0xe8, 0x7a, 0x0c, 0x00, 0x00, 0x85, 0xc0, 
+0x75, 0x3f, 0x8b, 0x7c, 0x24, 0x0c, 0x85, 0xff, 
+0x78, 0x37, 0xe8, 0x39, 0x02, 0x00, 0x00, 0x8b, 
+0x7b, 0x74, 0xe8, 0x51, 0x02, 0x00, 0x00, 0x48, 
+0x89, 0xdf, 0xe8, 0x49, 0xf6, 0xff, 0xff, 0x41, 
+0x89, 0xc0, 0xb9, 0x05, 0x02, 0x00, 0x00, 0x31, 
+0xc0, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8d, 
+0x15, 0x93, 0x12, 0x00, 0x00, 0x48, 0x8d, 0x35, 
+0x4c, 0x17, 0x00, 0x00, 0xe8, 0xc7, 0x02, 0x00, 
+0x00, 0x31, 0xc0, 0xe8, 0x70, 0xf5, 0xff, 0xff, 
+0xb9, 0x0b, 0x02, 0x00, 0x00, 0x48, 0x8d, 0x15, 
+0x74, 0x12, 0x00, 0x00, 0x48, 0x8d, 0x35, 0x55, 
+0x17, 0x00, 0x00, 0x31, 0xc0, 0xbf, 0x01, 0x00, 
+0x00, 0x00, 0xe8, 0xa1, 0x02, 0x00, 0x00, 0xeb, 
+0xd8, 0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x40, 0x00, 
+0x55, 0x89, 0xf9, 0x48, 0x89, 0xf5, 0x89, 0xfa, 
+0x53, 0x31, 0xc0, 0x89, 0xfb, 0x48, 0x8d, 0x35, 
+0xfb, 0x12, 0x00, 0x00, 0xbf, 0x03, 0x00, 0x00, 
+0x00, 0x48, 0x83, 0xec, 0x18, 0xe8, 0x6e, 0x02, 
+0x00, 0x00, 0x83, 0xfb, 0x03, 0x74, 0x49, 0x83, 
+0xfb, 0x04, 0x0f, 0x84, 0xc0, 0x00, 0x00, 0x00, 
+0x83, 0xfb, 0x02, 0x0f, 0x84, 0xa7, 0x00, 0x00, 
+0x00, 0x31, 0xc0, 0x41, 0x89, 0xd8, 0xb9, 0x2d, 
+0x02, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 
+0x48, 0x8d, 0x15, 0x01, 0x12, 0x00, 0x00, 0x48, 
+0x8d, 0x35, 0x52, 0x17, 0x00, 0x00, 0xe8, 0x35, 
+0x02, 0x00, 0x00, 0xb8, 0xea, 0xff, 0xff, 0xff, 
+0x48, 0x83, 0xc4, 0x18, 0x5b, 0x5d, 0xc3, 0x66, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x48, 0x8b, 0x45, 0x00, 0x4c, 0x8d, 0x44, 0x24, 
+0x08, 0x48, 0x89, 0x6c, 0x24, 0x08, 0x4c, 0x89, 
+0xc3, 0x48, 0x29, 0xc3, 0x48, 0xc1, 0xeb, 0x0e, 
+0x49, 0x39, 0xc0, 0x72, 0x6b, 0x3b, 0x5d, 0x08, 
+0x73, 0x66, 0xe8, 0x21, 0x10, 0x00, 0x00, 0x89, 
+0xdb, 0x48, 0x8b, 0x6c, 0x24, 0x08, 0x45, 0x31, 
+0xc0, 0x48, 0x8d, 0x1c, 0x9b, 0x48, 0x89, 0xc2, 
+0x31, 0xc9, 0xbf, 0x28, 0x00, 0x00, 0x00, 0x48, 
+0xc1, 0xe3, 0x03, 0x48, 0x8d, 0x44, 0x1d, 0x00, 
+0x48, 0x8d, 0x74, 0x1d, 0x10, 0x89, 0x50, 0x18, 
+0x31, 0xd2, 0xc7, 0x40, 0x1c, 0x00, 0x00, 0x00, 
+0x00, 0xe8, 0xae, 0x0f, 0x00, 0x00, 0x85, 0xc0, 
+0x75, 0x8e, 0x48, 0x8d, 0x74, 0x1d, 0x20, 0x31, 
+0xff, 0xe8, 0x6e, 0x0f, 0x00, 0x00, 0xeb, 0x80, 
+0x48, 0x89, 0xef, 0xe8, 0x48, 0xfe, 0xff, 0xff, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x48, 0x89, 0xef, 0xe8, 0xf8, 0xf3, 0xff, 0xff, 
+0x31, 0xc0, 0xb9, 0xda, 0x00, 0x00, 0x00, 0x48, 
+0x8d, 0x15, 0x4a, 0x11, 0x00, 0x00, 0xbf, 0x01, 
+0x00, 0x00, 0x00, 0x48, 0x8d, 0x35, 0x5e, 0x16, 
+0x00, 0x00, 0xe8, 0x79, 0x01, 0x00, 0x00, 0xb8, 
+0xff, 0xff, 0xff, 0xff, 0xe9, 0x3f, 0xff, 0xff, 
+0xff, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x48, 0x83, 
+0xec, 0x08, 0x0f, 0xb6, 0x07, 0x44, 0x8b, 0x25, 
+0x28, 0x17, 0x00, 0x00, 0x84, 0xc0, 0x74, 0x78, 
+0x48, 0x89, 0xfd, 0x48, 0x89, 0xf3, 0xeb, 0x0c, 
+0x0f, 0xb6, 0x45, 0x01, 0x48, 0x83, 0xc5, 0x01, 
+0x84, 0xc0, 0x74, 0x64, 0x48, 0x8b, 0x53, 0x48, 
+0x88, 0x02, 0x48, 0x8b, 0x53, 0x48, 0x48, 0x8d, 
+0x42, 0x01, 0x48, 0x89, 0x43, 0x48, 0x48, 0x29, 
+0xd8, 0x48, 0x83, 0xf8, 0x45, 0x7e, 0xd9, 0xc6, 
+0x42, 0x01, 0x3e, 0x48, 0x8b, 0x43, 0x48, 0x4c, 
+0x8d, 0x6b, 0x05, 0xc6, 0x40, 0x01, 0x0a, 0x48, 
+0x8b, 0x43, 0x48, 0x48, 0x8d, 0x50, 0x02, 0x48, 
+0x89, 0x53, 0x48, 0x4c, 0x39, 0xea, 0x74, 0xb8, 
+0x8b, 0x3d, 0x7a, 0x10, 0x00, 0x00, 0x48, 0x29, 
+0xda, 0x48, 0x89, 0xde, 0x48, 0x83, 0xc5, 0x01, 
+0xe8, 0x5f, 0x0c, 0x00, 0x00, 0x44, 0x89, 0x23, 
+0xc6, 0x43, 0x04, 0x20, 0x4c, 0x89, 0x6b, 0x48, 
+0x0f, 0xb6, 0x45, 0x00, 0x84, 0xc0, 0x75, 0x9c, 
+0x48, 0x83, 0xc4, 0x08, 0x5b, 0x5d, 0x41, 0x5c, 
+0x41, 0x5d, 0xc3, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x53, 0x89, 0xfb, 0x8b, 0x3d, 0x3f, 0x10, 0x00, 
+0x00, 0xe8, 0x3e, 0x0c, 0x00, 0x00, 0x89, 0x1d, 
+0x34, 0x10, 0x00, 0x00, 0x5b, 0xc3, 0x66, 0x2e, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x89, 0x3d, 0x1e, 0x10, 0x00, 0x00, 0xc3, 0x66, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x49, 0x89, 0xca, 0x48, 0x63, 0xce, 0x49, 0x89, 
+0xf8, 0x89, 0xf0, 0x48, 0x8d, 0x7c, 0x0f, 0xff, 
+0x85, 0xd2, 0x78, 0x6c, 0x41, 0xbb, 0x00, 0x00, 
+0x00, 0x00, 0x74, 0x54, 0x41, 0xb9, 0xcd, 0xcc, 
+0xcc, 0xcc, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x89, 0xd1, 0x49, 0x0f, 0xaf, 0xc9, 0x48, 0xc1, 
+0xe9, 0x23, 0x8d, 0x34, 0x89, 0x01, 0xf6, 0x29, 
+0xf2, 0x48, 0x89, 0xfe, 0x48, 0x8d, 0x7f, 0xff, 
+0x83, 0xc2, 0x30, 0x88, 0x57, 0x01, 0x89, 0xca, 
+0x85, 0xc9, 0x75, 0xdc, 0x45, 0x85, 0xdb, 0x75, 
+0x0f, 0x49, 0x89, 0x32, 0x4c, 0x29, 0xc6, 0x29, 
+0xf0, 0xc3, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x89, 0xfe, 0xc6, 0x07, 0x2d, 0x49, 0x89, 
+0x32, 0x4c, 0x29, 0xc6, 0x29, 0xf0, 0xc3, 0x90, 
+0x48, 0x89, 0xfe, 0xc6, 0x07, 0x30, 0x49, 0x89, 
+0x32, 0x4c, 0x29, 0xc6, 0x29, 0xf0, 0xc3, 0x90, 
+0xf7, 0xda, 0x41, 0xbb, 0x01, 0x00, 0x00, 0x00, 
+0xeb, 0x92, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x48, 0x81, 
+0xec, 0xc8, 0x00, 0x00, 0x00, 0x39, 0x3d, 0x71, 
+0x0f, 0x00, 0x00, 0x48, 0x89, 0x94, 0x24, 0xa0, 
+0x00, 0x00, 0x00, 0x48, 0x89, 0x8c, 0x24, 0xa8, 
+0x00, 0x00, 0x00, 0x4c, 0x89, 0x84, 0x24, 0xb0, 
+0x00, 0x00, 0x00, 0x4c, 0x89, 0x8c, 0x24, 0xb8, 
+0x00, 0x00, 0x00, 0x73, 0x13, 0x48, 0x81, 0xc4, 
+0xc8, 0x00, 0x00, 0x00, 0x5b, 0x5d, 0x41, 0x5c, 
+0x41, 0x5d, 0xc3, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x8d, 0x6c, 0x24, 0x45, 0xc6, 0x44, 0x24, 
+0x44, 0x20, 0x48, 0x8d, 0x84, 0x24, 0xf0, 0x00, 
+0x00, 0x00, 0x44, 0x8b, 0x25, 0x7b, 0x15, 0x00, 
+0x00, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0x8d, 
+0x84, 0x24, 0x90, 0x00, 0x00, 0x00, 0x48, 0x8d, 
+0x5c, 0x24, 0x40, 0x48, 0x89, 0x44, 0x24, 0x38, 
+0x0f, 0xb6, 0x06, 0x44, 0x89, 0x64, 0x24, 0x40, 
+0x48, 0x89, 0xac, 0x24, 0x88, 0x00, 0x00, 0x00, 
+0xc7, 0x44, 0x24, 0x28, 0x10, 0x00, 0x00, 0x00, 
+0x84, 0xc0, 0x75, 0x3d, 0xeb, 0x78, 0x66, 0x2e, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0f, 0xb6, 0x46, 0x01, 0x3c, 0x6c, 0x0f, 0x84, 
+0x94, 0x00, 0x00, 0x00, 0x3c, 0x73, 0x0f, 0x84, 
+0x4c, 0x01, 0x00, 0x00, 0x3c, 0x78, 0x0f, 0x84, 
+0x14, 0x04, 0x00, 0x00, 0x3c, 0x64, 0x0f, 0x84, 
+0xc4, 0x03, 0x00, 0x00, 0x41, 0x0f, 0xb6, 0x45, 
+0x01, 0x49, 0x8d, 0x75, 0x01, 0x84, 0xc0, 0x74, 
+0x3d, 0x4c, 0x8d, 0x6e, 0x01, 0x3c, 0x25, 0x74, 
+0xc7, 0x48, 0x8b, 0x94, 0x24, 0x88, 0x00, 0x00, 
+0x00, 0x88, 0x02, 0x48, 0x8b, 0x94, 0x24, 0x88, 
+0x00, 0x00, 0x00, 0x48, 0x8d, 0x42, 0x01, 0x48, 
+0x89, 0x84, 0x24, 0x88, 0x00, 0x00, 0x00, 0x48, 
+0x29, 0xd8, 0x48, 0x83, 0xf8, 0x45, 0x0f, 0x8f, 
+0x2c, 0x01, 0x00, 0x00, 0x4c, 0x89, 0xee, 0x0f, 
+0xb6, 0x06, 0x84, 0xc0, 0x75, 0xc3, 0x48, 0x8b, 
+0x94, 0x24, 0x88, 0x00, 0x00, 0x00, 0x48, 0x39, 
+0xea, 0x0f, 0x84, 0x16, 0xff, 0xff, 0xff, 0x8b, 
+0x3d, 0x63, 0x0e, 0x00, 0x00, 0x48, 0x29, 0xda, 
+0x48, 0x89, 0xde, 0xe8, 0x4c, 0x0a, 0x00, 0x00, 
+0x48, 0x81, 0xc4, 0xc8, 0x00, 0x00, 0x00, 0x5b, 
+0x5d, 0x41, 0x5c, 0x41, 0x5d, 0xc3, 0x66, 0x90, 
+0x0f, 0xb6, 0x46, 0x02, 0x4c, 0x8d, 0x6e, 0x02, 
+0x3c, 0x6c, 0x75, 0x08, 0x0f, 0xb6, 0x46, 0x03, 
+0x4c, 0x8d, 0x6e, 0x03, 0x3c, 0x73, 0x0f, 0x84, 
+0xa4, 0x00, 0x00, 0x00, 0x3c, 0x78, 0x0f, 0x84, 
+0x3c, 0x01, 0x00, 0x00, 0x3c, 0x64, 0x0f, 0x85, 
+0x58, 0xff, 0xff, 0xff, 0x8b, 0x44, 0x24, 0x28, 
+0x83, 0xf8, 0x2f, 0x0f, 0x87, 0xb7, 0x04, 0x00, 
+0x00, 0x89, 0xc2, 0x48, 0x03, 0x54, 0x24, 0x38, 
+0x83, 0xc0, 0x08, 0xc6, 0x44, 0x24, 0x25, 0x00, 
+0x48, 0x8b, 0x0a, 0x89, 0x44, 0x24, 0x28, 0x48, 
+0x85, 0xc9, 0x0f, 0x88, 0xb7, 0x04, 0x00, 0x00, 
+0x41, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x84, 
+0xbc, 0x04, 0x00, 0x00, 0x48, 0xbf, 0xcd, 0xcc, 
+0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x48, 0x8d, 
+0x74, 0x24, 0x24, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x89, 0xc8, 0x48, 0xf7, 0xe7, 0x48, 0xc1, 
+0xea, 0x03, 0x48, 0x8d, 0x04, 0x92, 0x48, 0x01, 
+0xc0, 0x48, 0x29, 0xc1, 0x48, 0x89, 0xf0, 0x48, 
+0x8d, 0x76, 0xff, 0x83, 0xc1, 0x30, 0x88, 0x4e, 
+0x01, 0x48, 0x89, 0xd1, 0x48, 0x85, 0xd2, 0x75, 
+0xd7, 0x45, 0x85, 0xc0, 0x74, 0x06, 0xc6, 0x06, 
+0x2d, 0x48, 0x89, 0xf0, 0x48, 0x89, 0xde, 0x48, 
+0x89, 0xc7, 0xe8, 0xa9, 0xfc, 0xff, 0xff, 0xe9, 
+0xc8, 0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x40, 0x00, 
+0x8b, 0x44, 0x24, 0x28, 0x83, 0xf8, 0x2f, 0x77, 
+0x7f, 0x89, 0xc2, 0x83, 0xc0, 0x08, 0x48, 0x03, 
+0x54, 0x24, 0x38, 0x89, 0x44, 0x24, 0x28, 0x48, 
+0x8b, 0x3a, 0x48, 0x89, 0xde, 0xe8, 0x7e, 0xfc, 
+0xff, 0xff, 0xe9, 0x9d, 0xfe, 0xff, 0xff, 0x66, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xc6, 0x42, 0x01, 0x3e, 0x48, 0x8b, 0x84, 0x24, 
+0x88, 0x00, 0x00, 0x00, 0xc6, 0x40, 0x01, 0x0a, 
+0x48, 0x8b, 0x84, 0x24, 0x88, 0x00, 0x00, 0x00, 
+0x48, 0x8d, 0x50, 0x02, 0x48, 0x89, 0x94, 0x24, 
+0x88, 0x00, 0x00, 0x00, 0x48, 0x39, 0xea, 0x0f, 
+0x84, 0xa7, 0xfe, 0xff, 0xff, 0x8b, 0x3d, 0x25, 
+0x0d, 0x00, 0x00, 0x48, 0x29, 0xda, 0x48, 0x89, 
+0xde, 0xe8, 0x0e, 0x09, 0x00, 0x00, 0x44, 0x89, 
+0x64, 0x24, 0x40, 0xc6, 0x44, 0x24, 0x44, 0x20, 
+0x48, 0x89, 0xac, 0x24, 0x88, 0x00, 0x00, 0x00, 
+0xe9, 0x7f, 0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x00, 
+0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0x8d, 0x42, 
+0x08, 0x48, 0x89, 0x44, 0x24, 0x30, 0xe9, 0x7c, 
+0xff, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x8b, 0x44, 0x24, 0x28, 0x83, 0xf8, 0x2f, 0x0f, 
+0x87, 0x6b, 0x03, 0x00, 0x00, 0x89, 0xc2, 0x83, 
+0xc0, 0x08, 0x48, 0x03, 0x54, 0x24, 0x38, 0x89, 
+0x44, 0x24, 0x28, 0x48, 0x8b, 0x12, 0x31, 0xff, 
+0x48, 0x8d, 0x74, 0x24, 0x1f, 0xc6, 0x44, 0x24, 
+0x22, 0x00, 0x48, 0x8d, 0x05, 0xca, 0x0d, 0x00, 
+0x00, 0x48, 0x89, 0xd1, 0x83, 0xe1, 0x0f, 0x0f, 
+0xb6, 0x0c, 0x08, 0x88, 0x4c, 0x24, 0x21, 0x48, 
+0x89, 0xd1, 0x48, 0xc1, 0xe9, 0x04, 0x83, 0xe1, 
+0x0f, 0x0f, 0xb6, 0x0c, 0x08, 0x80, 0xf9, 0x30, 
+0x88, 0x4c, 0x24, 0x20, 0x48, 0x89, 0xd1, 0x40, 
+0x0f, 0x94, 0xc7, 0x48, 0xc1, 0xe9, 0x08, 0x83, 
+0xe1, 0x0f, 0x48, 0x8d, 0x7c, 0x3c, 0x20, 0x0f, 
+0xb6, 0x0c, 0x08, 0x80, 0xf9, 0x30, 0x88, 0x4c, 
+0x24, 0x1f, 0x48, 0x89, 0xd1, 0x48, 0x0f, 0x45, 
+0xfe, 0x48, 0xc1, 0xe9, 0x0c, 0x48, 0x8d, 0x74, 
+0x24, 0x1e, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 
+0x08, 0x80, 0xf9, 0x30, 0x88, 0x4c, 0x24, 0x1e, 
+0x48, 0x89, 0xd1, 0x48, 0x0f, 0x45, 0xfe, 0x48, 
+0xc1, 0xe9, 0x10, 0x48, 0x8d, 0x74, 0x24, 0x1d, 
+0x83, 0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 0x08, 0x80, 
+0xf9, 0x30, 0x88, 0x4c, 0x24, 0x1d, 0x48, 0x89, 
+0xd1, 0x48, 0x0f, 0x45, 0xfe, 0x48, 0xc1, 0xe9, 
+0x14, 0x48, 0x8d, 0x74, 0x24, 0x1c, 0x83, 0xe1, 
+0x0f, 0x0f, 0xb6, 0x0c, 0x08, 0x80, 0xf9, 0x30, 
+0x88, 0x4c, 0x24, 0x1c, 0x48, 0x89, 0xd1, 0x48, 
+0x0f, 0x45, 0xfe, 0x48, 0xc1, 0xe9, 0x18, 0x48, 
+0x8d, 0x74, 0x24, 0x1b, 0x83, 0xe1, 0x0f, 0x0f, 
+0xb6, 0x0c, 0x08, 0x80, 0xf9, 0x30, 0x88, 0x4c, 
+0x24, 0x1b, 0x89, 0xd1, 0x48, 0x0f, 0x45, 0xfe, 
+0xc1, 0xe9, 0x1c, 0x48, 0x8d, 0x74, 0x24, 0x1a, 
+0x0f, 0xb6, 0x0c, 0x08, 0x80, 0xf9, 0x30, 0x88, 
+0x4c, 0x24, 0x1a, 0x48, 0x89, 0xd1, 0x48, 0x0f, 
+0x45, 0xfe, 0x48, 0xc1, 0xe9, 0x20, 0x48, 0x8d, 
+0x74, 0x24, 0x19, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 
+0x0c, 0x08, 0x80, 0xf9, 0x30, 0x88, 0x4c, 0x24, 
+0x19, 0x48, 0x89, 0xd1, 0x48, 0x0f, 0x45, 0xfe, 
+0x48, 0xc1, 0xe9, 0x24, 0x48, 0x8d, 0x74, 0x24, 
+0x18, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 0x08, 
+0x80, 0xf9, 0x30, 0x88, 0x4c, 0x24, 0x18, 0x48, 
+0x89, 0xd1, 0x48, 0x0f, 0x45, 0xfe, 0x48, 0xc1, 
+0xe9, 0x28, 0x48, 0x8d, 0x74, 0x24, 0x17, 0x83, 
+0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 0x08, 0x80, 0xf9, 
+0x30, 0x88, 0x4c, 0x24, 0x17, 0x48, 0x89, 0xd1, 
+0x48, 0x0f, 0x45, 0xfe, 0x48, 0xc1, 0xe9, 0x2c, 
+0x48, 0x8d, 0x74, 0x24, 0x16, 0x83, 0xe1, 0x0f, 
+0x0f, 0xb6, 0x0c, 0x08, 0x80, 0xf9, 0x30, 0x88, 
+0x4c, 0x24, 0x16, 0x48, 0x89, 0xd1, 0x48, 0x0f, 
+0x45, 0xfe, 0x48, 0xc1, 0xe9, 0x30, 0x48, 0x8d, 
+0x74, 0x24, 0x15, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 
+0x0c, 0x08, 0x80, 0xf9, 0x30, 0x88, 0x4c, 0x24, 
+0x15, 0x48, 0x89, 0xd1, 0x48, 0x0f, 0x45, 0xfe, 
+0x48, 0xc1, 0xe9, 0x34, 0x48, 0x8d, 0x74, 0x24, 
+0x14, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 0x08, 
+0x80, 0xf9, 0x30, 0x88, 0x4c, 0x24, 0x14, 0x48, 
+0x89, 0xd1, 0x48, 0x0f, 0x45, 0xfe, 0x48, 0xc1, 
+0xe9, 0x38, 0x48, 0x8d, 0x74, 0x24, 0x13, 0x83, 
+0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 0x08, 0x80, 0xf9, 
+0x30, 0x88, 0x4c, 0x24, 0x13, 0x48, 0x0f, 0x45, 
+0xfe, 0x48, 0xc1, 0xea, 0x3c, 0xe9, 0x31, 0x01, 
+0x00, 0x00, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x8b, 0x44, 0x24, 0x28, 0x83, 0xf8, 0x2f, 0x0f, 
+0x87, 0x6b, 0x01, 0x00, 0x00, 0x89, 0xc2, 0x83, 
+0xc0, 0x08, 0x48, 0x03, 0x54, 0x24, 0x38, 0x89, 
+0x44, 0x24, 0x28, 0x8b, 0x12, 0x48, 0x8d, 0x7c, 
+0x24, 0x10, 0x48, 0x8d, 0x4c, 0x24, 0x08, 0xbe, 
+0x0b, 0x00, 0x00, 0x00, 0xc6, 0x44, 0x24, 0x1b, 
+0x00, 0xe8, 0xb2, 0xfa, 0xff, 0xff, 0x48, 0x8b, 
+0x7c, 0x24, 0x08, 0x48, 0x89, 0xde, 0xe8, 0xd5, 
+0xf9, 0xff, 0xff, 0xe9, 0xf4, 0xfb, 0xff, 0xff, 
+0x8b, 0x44, 0x24, 0x28, 0x83, 0xf8, 0x2f, 0x0f, 
+0x87, 0x0b, 0x01, 0x00, 0x00, 0x89, 0xc2, 0x83, 
+0xc0, 0x08, 0x48, 0x03, 0x54, 0x24, 0x38, 0x89, 
+0x44, 0x24, 0x28, 0x8b, 0x12, 0x48, 0x8d, 0x05, 
+0xa7, 0x0b, 0x00, 0x00, 0x31, 0xff, 0x48, 0x8d, 
+0x74, 0x24, 0x17, 0xc6, 0x44, 0x24, 0x1a, 0x00, 
+0x89, 0xd1, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 
+0x08, 0x88, 0x4c, 0x24, 0x19, 0x89, 0xd1, 0xc1, 
+0xe9, 0x04, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 
+0x08, 0x80, 0xf9, 0x30, 0x88, 0x4c, 0x24, 0x18, 
+0x89, 0xd1, 0x40, 0x0f, 0x94, 0xc7, 0xc1, 0xe9, 
+0x08, 0x83, 0xe1, 0x0f, 0x48, 0x8d, 0x7c, 0x3c, 
+0x18, 0x0f, 0xb6, 0x0c, 0x08, 0x80, 0xf9, 0x30, 
+0x88, 0x4c, 0x24, 0x17, 0x89, 0xd1, 0x48, 0x0f, 
+0x45, 0xfe, 0xc1, 0xe9, 0x0c, 0x48, 0x8d, 0x74, 
+0x24, 0x16, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 
+0x08, 0x80, 0xf9, 0x30, 0x88, 0x4c, 0x24, 0x16, 
+0x89, 0xd1, 0x48, 0x0f, 0x45, 0xfe, 0xc1, 0xe9, 
+0x10, 0x48, 0x8d, 0x74, 0x24, 0x15, 0x83, 0xe1, 
+0x0f, 0x0f, 0xb6, 0x0c, 0x08, 0x80, 0xf9, 0x30, 
+0x88, 0x4c, 0x24, 0x15, 0x89, 0xd1, 0x48, 0x0f, 
+0x45, 0xfe, 0xc1, 0xe9, 0x14, 0x48, 0x8d, 0x74, 
+0x24, 0x14, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 
+0x08, 0x80, 0xf9, 0x30, 0x88, 0x4c, 0x24, 0x14, 
+0x89, 0xd1, 0x48, 0x0f, 0x45, 0xfe, 0xc1, 0xe9, 
+0x18, 0x48, 0x8d, 0x74, 0x24, 0x13, 0x83, 0xe1, 
+0x0f, 0x0f, 0xb6, 0x0c, 0x08, 0x88, 0x4c, 0x24, 
+0x13, 0x80, 0xf9, 0x30, 0x48, 0x0f, 0x45, 0xfe, 
+0xc1, 0xea, 0x1c, 0x0f, 0xb6, 0x04, 0x10, 0x48, 
+0x8d, 0x54, 0x24, 0x12, 0x48, 0x89, 0xde, 0x3c, 
+0x30, 0x88, 0x44, 0x24, 0x12, 0x0f, 0xb7, 0x05, 
+0x14, 0x10, 0x00, 0x00, 0x48, 0x0f, 0x45, 0xfa, 
+0x66, 0x89, 0x47, 0xfe, 0x48, 0x83, 0xef, 0x02, 
+0xe8, 0xc3, 0xf8, 0xff, 0xff, 0xe9, 0xe2, 0xfa, 
+0xff, 0xff, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0x8d, 0x42, 
+0x08, 0x48, 0x89, 0x44, 0x24, 0x30, 0xe9, 0xf0, 
+0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0x8d, 0x42, 
+0x08, 0x48, 0x89, 0x44, 0x24, 0x30, 0xe9, 0x90, 
+0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0x8d, 0x42, 
+0x08, 0x48, 0x89, 0x44, 0x24, 0x30, 0xe9, 0x90, 
+0xfc, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x8b, 0x54, 0x24, 0x30, 0xc6, 0x44, 0x24, 
+0x25, 0x00, 0x48, 0x8b, 0x0a, 0x48, 0x8d, 0x42, 
+0x08, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0x85, 
+0xc9, 0x0f, 0x89, 0x49, 0xfb, 0xff, 0xff, 0x48, 
+0xf7, 0xd9, 0x41, 0xb8, 0x01, 0x00, 0x00, 0x00, 
+0xe9, 0x47, 0xfb, 0xff, 0xff, 0x0f, 0x1f, 0x00, 
+0xc6, 0x44, 0x24, 0x24, 0x30, 0x48, 0x8d, 0x44, 
+0x24, 0x24, 0xe9, 0x7d, 0xfb, 0xff, 0xff, 0x90, 
+0x41, 0x54, 0x31, 0xd2, 0xbe, 0x00, 0x00, 0x01, 
+0x00, 0x55, 0x53, 0x48, 0x89, 0xfb, 0xe8, 0x01, 
+0x05, 0x00, 0x00, 0x48, 0x89, 0xc5, 0x41, 0x89, 
+0xc4, 0x85, 0xc0, 0x78, 0x2b, 0xbe, 0x02, 0x00, 
+0x00, 0x00, 0x48, 0x89, 0xdf, 0xe8, 0x82, 0x07, 
+0x00, 0x00, 0x85, 0xc0, 0x75, 0x42, 0x48, 0x89, 
+0xdf, 0xe8, 0x7a, 0x06, 0x00, 0x00, 0x85, 0xc0, 
+0x75, 0x6f, 0x44, 0x89, 0xe0, 0x5b, 0x5d, 0x41, 
+0x5c, 0xc3, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x41, 0x89, 0xc1, 0x49, 0x89, 0xd8, 0xb9, 0x15, 
+0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 
+0x48, 0x8d, 0x15, 0xdd, 0x09, 0x00, 0x00, 0x48, 
+0x8d, 0x35, 0x72, 0x0e, 0x00, 0x00, 0x31, 0xc0, 
+0xe8, 0x23, 0xf9, 0xff, 0xff, 0xeb, 0xae, 0x90, 
+0x41, 0x89, 0xc1, 0x49, 0x89, 0xd8, 0xb9, 0x19, 
+0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 
+0x48, 0x8d, 0x15, 0xb5, 0x09, 0x00, 0x00, 0x48, 
+0x8d, 0x35, 0x7a, 0x0e, 0x00, 0x00, 0x31, 0xc0, 
+0xe8, 0xfb, 0xf8, 0xff, 0xff, 0x85, 0xed, 0x78, 
+0x08, 0x44, 0x89, 0xe7, 0xe8, 0x7b, 0x04, 0x00, 
+0x00, 0x41, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xeb, 
+0x91, 0x41, 0x89, 0xc1, 0x49, 0x89, 0xd8, 0xb9, 
+0x1f, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 
+0x00, 0x48, 0x8d, 0x15, 0x7c, 0x09, 0x00, 0x00, 
+0x48, 0x8d, 0x35, 0x71, 0x0e, 0x00, 0x00, 0x31, 
+0xc0, 0xe8, 0xc2, 0xf8, 0xff, 0xff, 0xeb, 0xc5, 
+0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 
+0x55, 0x53, 0x48, 0x81, 0xec, 0x38, 0x1c, 0x00, 
+0x00, 0x41, 0x80, 0xf9, 0x01, 0x48, 0x19, 0xc0, 
+0x89, 0x54, 0x24, 0x48, 0x4c, 0x8d, 0x9c, 0x24, 
+0x88, 0x04, 0x00, 0x00, 0x48, 0x8d, 0x94, 0x24, 
+0x88, 0x00, 0x00, 0x00, 0x48, 0x25, 0x61, 0xe8, 
+0xff, 0xff, 0x89, 0x7c, 0x24, 0x28, 0x48, 0x05, 
+0xa0, 0x17, 0x00, 0x00, 0x48, 0x89, 0x4c, 0x24, 
+0x08, 0x48, 0x89, 0x84, 0x24, 0x80, 0x00, 0x00, 
+0x00, 0x48, 0x8d, 0x44, 0x24, 0x78, 0x48, 0x89, 
+0x44, 0x24, 0x50, 0x48, 0x8b, 0x05, 0x4e, 0x0e, 
+0x00, 0x00, 0x4c, 0x89, 0x5c, 0x24, 0x78, 0x48, 
+0xc7, 0x44, 0x24, 0x58, 0x01, 0x00, 0x00, 0x00, 
+0x48, 0x89, 0x74, 0x24, 0x40, 0x48, 0x89, 0x54, 
+0x24, 0x60, 0x48, 0xc7, 0x84, 0x24, 0x88, 0x00, 
+0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x48, 0x89, 
+0x84, 0x24, 0x90, 0x00, 0x00, 0x00, 0x45, 0x85, 
+0xc0, 0x0f, 0x8e, 0x9a, 0x01, 0x00, 0x00, 0x44, 
+0x89, 0x44, 0x24, 0x10, 0x45, 0x31, 0xff, 0x4c, 
+0x8d, 0x6c, 0x24, 0x38, 0x45, 0x89, 0xcc, 0x48, 
+0x8d, 0x84, 0x24, 0x98, 0x00, 0x00, 0x00, 0x4c, 
+0x89, 0x5c, 0x24, 0x20, 0x48, 0x89, 0x44, 0x24, 
+0x18, 0x44, 0x8b, 0x44, 0x24, 0x10, 0xb8, 0xfc, 
+0x00, 0x00, 0x00, 0x48, 0x8b, 0x4c, 0x24, 0x08, 
+0x48, 0x8b, 0x7c, 0x24, 0x18, 0x45, 0x29, 0xf8, 
+0x41, 0x39, 0xc0, 0x44, 0x0f, 0x4f, 0xc0, 0x41, 
+0x8d, 0x40, 0x04, 0x48, 0x98, 0x48, 0xc1, 0xe0, 
+0x02, 0x48, 0x89, 0x44, 0x24, 0x68, 0x48, 0x89, 
+0x02, 0x49, 0x63, 0xd7, 0x42, 0x8d, 0x04, 0x85, 
+0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x1c, 0x91, 
+0x44, 0x89, 0xc1, 0x81, 0xe1, 0xff, 0xff, 0xff, 
+0x3f, 0x48, 0x89, 0xde, 0xf3, 0xa5, 0x89, 0xc1, 
+0x83, 0xe1, 0x03, 0x74, 0x02, 0xf3, 0xa4, 0x45, 
+0x84, 0xe4, 0x75, 0x44, 0x8b, 0x7c, 0x24, 0x28, 
+0x31, 0xd2, 0x48, 0x8d, 0x74, 0x24, 0x40, 0x44, 
+0x89, 0x44, 0x24, 0x14, 0xe8, 0x23, 0x04, 0x00, 
+0x00, 0x44, 0x8b, 0x44, 0x24, 0x14, 0x85, 0xc0, 
+0x89, 0xc2, 0x0f, 0x8e, 0xd6, 0x00, 0x00, 0x00, 
+0x45, 0x01, 0xc7, 0x44, 0x39, 0x7c, 0x24, 0x10, 
+0x0f, 0x8e, 0xeb, 0x00, 0x00, 0x00, 0x48, 0x8b, 
+0x54, 0x24, 0x60, 0xe9, 0x69, 0xff, 0xff, 0xff, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x48, 0x8b, 0x4c, 0x24, 0x08, 0x49, 0x63, 0xc0, 
+0x44, 0x89, 0x44, 0x24, 0x14, 0x48, 0x01, 0xd0, 
+0x44, 0x89, 0x7c, 0x24, 0x2c, 0x48, 0x8b, 0x6c, 
+0x24, 0x20, 0x4c, 0x8d, 0x34, 0x81, 0xeb, 0x3f, 
+0x48, 0x8d, 0x54, 0x24, 0x30, 0xbe, 0x11, 0x00, 
+0x00, 0x00, 0x44, 0x89, 0xff, 0xe8, 0x3a, 0x04, 
+0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x85, 
+0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x30, 
+0x48, 0x83, 0xc3, 0x04, 0x48, 0x83, 0xc5, 0x18, 
+0x48, 0x89, 0x45, 0xec, 0x8b, 0x44, 0x24, 0x38, 
+0x89, 0x45, 0xf8, 0x8b, 0x44, 0x24, 0x3c, 0x89, 
+0x45, 0xfc, 0x49, 0x39, 0xde, 0x74, 0x48, 0x44, 
+0x8b, 0x3b, 0x31, 0xd2, 0xbe, 0x01, 0x00, 0x00, 
+0x00, 0x44, 0x89, 0xff, 0xe8, 0xfb, 0x03, 0x00, 
+0x00, 0x85, 0xc0, 0x78, 0x4b, 0x88, 0x45, 0x00, 
+0x4c, 0x89, 0xea, 0xbe, 0x10, 0x00, 0x00, 0x00, 
+0x44, 0x89, 0xff, 0xe8, 0xe4, 0x03, 0x00, 0x00, 
+0x48, 0x85, 0xc0, 0x75, 0x33, 0x8b, 0x44, 0x24, 
+0x3c, 0x85, 0xc0, 0x75, 0x8b, 0x31, 0xc0, 0x48, 
+0x83, 0xc3, 0x04, 0x48, 0x83, 0xc5, 0x18, 0x89, 
+0x45, 0xfc, 0x49, 0x39, 0xde, 0x75, 0xb8, 0x44, 
+0x8b, 0x44, 0x24, 0x14, 0x44, 0x8b, 0x7c, 0x24, 
+0x2c, 0xe9, 0x06, 0xff, 0xff, 0xff, 0x75, 0x0d, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xba, 0xff, 0xff, 0xff, 0xff, 0x48, 0x81, 0xc4, 
+0x38, 0x1c, 0x00, 0x00, 0x89, 0xd0, 0x5b, 0x5d, 
+0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 
+0xc3, 0x31, 0xd2, 0xeb, 0xe8, 0x0f, 0x1f, 0x00, 
+0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 
+0x55, 0x48, 0x89, 0xcd, 0x53, 0x48, 0x81, 0xec, 
+0x08, 0x1c, 0x00, 0x00, 0x48, 0x83, 0xf9, 0x01, 
+0x48, 0x8d, 0x84, 0x24, 0x58, 0x04, 0x00, 0x00, 
+0x48, 0x8d, 0x4c, 0x24, 0x58, 0x48, 0xc7, 0x44, 
+0x24, 0x28, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 
+0x44, 0x24, 0x08, 0x48, 0x89, 0x44, 0x24, 0x48, 
+0x48, 0x19, 0xc0, 0x48, 0x25, 0x61, 0xe8, 0xff, 
+0xff, 0xc7, 0x44, 0x24, 0x18, 0x00, 0x00, 0x00, 
+0x00, 0x48, 0x05, 0xa0, 0x17, 0x00, 0x00, 0x48, 
+0x89, 0x4c, 0x24, 0x30, 0x48, 0x89, 0x44, 0x24, 
+0x50, 0x48, 0x8d, 0x44, 0x24, 0x48, 0x48, 0x89, 
+0x44, 0x24, 0x20, 0x48, 0x8b, 0x05, 0x0e, 0x0c, 
+0x00, 0x00, 0x48, 0xc7, 0x44, 0x24, 0x10, 0x00, 
+0x00, 0x00, 0x00, 0x48, 0xc7, 0x44, 0x24, 0x58, 
+0x00, 0x04, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 
+0x60, 0x85, 0xd2, 0x0f, 0x8e, 0x47, 0x01, 0x00, 
+0x00, 0x48, 0x8d, 0x44, 0x24, 0x68, 0x41, 0x89, 
+0xfd, 0x49, 0x89, 0xf6, 0x89, 0xd3, 0x48, 0x89, 
+0x04, 0x24, 0x45, 0x31, 0xe4, 0x4c, 0x8d, 0x7c, 
+0x24, 0x10, 0x89, 0xd8, 0xba, 0xfc, 0x00, 0x00, 
+0x00, 0x4c, 0x89, 0xfe, 0x44, 0x89, 0xef, 0x44, 
+0x29, 0xe0, 0x39, 0xd0, 0x0f, 0x4f, 0xc2, 0x31, 
+0xd2, 0x83, 0xc0, 0x04, 0x48, 0x98, 0x48, 0xc1, 
+0xe0, 0x02, 0x48, 0x89, 0x44, 0x24, 0x38, 0x48, 
+0x89, 0x01, 0xe8, 0x51, 0x02, 0x00, 0x00, 0x89, 
+0xc2, 0x85, 0xc0, 0x0f, 0x8e, 0xff, 0x00, 0x00, 
+0x00, 0x48, 0x83, 0x7c, 0x24, 0x38, 0x0f, 0x0f, 
+0x86, 0xdb, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 
+0x24, 0x30, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xcd, 
+0x00, 0x00, 0x00, 0x83, 0x78, 0x0c, 0x01, 0x0f, 
+0x85, 0xc3, 0x00, 0x00, 0x00, 0xf6, 0x44, 0x24, 
+0x40, 0x08, 0x0f, 0x85, 0xe0, 0x00, 0x00, 0x00, 
+0x48, 0x8b, 0x00, 0x48, 0x83, 0xe8, 0x10, 0x48, 
+0xc1, 0xe8, 0x02, 0x3d, 0xfc, 0x00, 0x00, 0x00, 
+0x0f, 0x8f, 0x8a, 0x00, 0x00, 0x00, 0x85, 0xc0, 
+0x7e, 0x66, 0x4d, 0x63, 0xcc, 0x89, 0xc1, 0x48, 
+0x8b, 0x34, 0x24, 0x8d, 0x14, 0x85, 0x00, 0x00, 
+0x00, 0x00, 0x81, 0xe1, 0xff, 0xff, 0xff, 0x3f, 
+0x4b, 0x8d, 0x3c, 0x8e, 0xf3, 0xa5, 0x89, 0xd1, 
+0x83, 0xe1, 0x03, 0x74, 0x02, 0xf3, 0xa4, 0x48, 
+0x85, 0xed, 0x74, 0x24, 0x8d, 0x14, 0x40, 0x4b, 
+0x8d, 0x34, 0x49, 0xc1, 0xe2, 0x03, 0x48, 0x8d, 
+0x7c, 0xf5, 0x00, 0x48, 0x8b, 0x74, 0x24, 0x08, 
+0x89, 0xd1, 0xc1, 0xe9, 0x02, 0xf3, 0xa5, 0x89, 
+0xd1, 0x83, 0xe1, 0x03, 0x74, 0x02, 0xf3, 0xa4, 
+0x41, 0x01, 0xc4, 0x44, 0x39, 0xe3, 0x7e, 0x58, 
+0x48, 0x8b, 0x4c, 0x24, 0x30, 0xe9, 0x20, 0xff, 
+0xff, 0xff, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0xba, 0xff, 0xff, 0xff, 0xff, 0x48, 0x81, 0xc4, 
+0x08, 0x1c, 0x00, 0x00, 0x89, 0xd0, 0x5b, 0x5d, 
+0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 
+0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x48, 0xc7, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0f, 0x0b, 0x66, 0x2e, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xba, 0xea, 0xff, 0xff, 0xff, 0xeb, 0xc6, 0x66, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x31, 0xd2, 0xeb, 0xb9, 0x0f, 0x1f, 0x40, 0x00, 
+0xb8, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x44, 0xd0, 
+0xeb, 0xab, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0xba, 0xe9, 0xff, 0xff, 0xff, 0xeb, 0x9e, 0x90, 
+0x49, 0x89, 0xca, 0x0f, 0x05, 0xc3, 0x66, 0x90, 
+0x48, 0xc7, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x0f, 
+0x05, 0x0f, 0x1f, 0x00, 0xb8, 0x00, 0x00, 0x00, 
+0x00, 0xeb, 0xe5, 0x90, 0xb8, 0x01, 0x00, 0x00, 
+0x00, 0xeb, 0xdd, 0x90, 0xb8, 0x02, 0x00, 0x00, 
+0x00, 0xeb, 0xd5, 0x90, 0xb8, 0x03, 0x00, 0x00, 
+0x00, 0xeb, 0xcd, 0x90, 0xb8, 0x08, 0x00, 0x00, 
+0x00, 0xeb, 0xc5, 0x90, 0xb8, 0x09, 0x00, 0x00, 
+0x00, 0xeb, 0xbd, 0x90, 0xb8, 0x0a, 0x00, 0x00, 
+0x00, 0xeb, 0xb5, 0x90, 0xb8, 0x0b, 0x00, 0x00, 
+0x00, 0xeb, 0xad, 0x90, 0xb8, 0x0c, 0x00, 0x00, 
+0x00, 0xeb, 0xa5, 0x90, 0xb8, 0x0d, 0x00, 0x00, 
+0x00, 0xeb, 0x9d, 0x90, 0xb8, 0x0e, 0x00, 0x00, 
+0x00, 0xeb, 0x95, 0x90, 0xb8, 0x0f, 0x00, 0x00, 
+0x00, 0xeb, 0x8d, 0x90, 0xb8, 0x10, 0x00, 0x00, 
+0x00, 0xeb, 0x85, 0x90, 0xb8, 0x11, 0x00, 0x00, 
+0x00, 0xe9, 0x7a, 0xff, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x19, 0x00, 0x00, 0x00, 0xe9, 0x6e, 0xff, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x1b, 0x00, 0x00, 
+0x00, 0xe9, 0x62, 0xff, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x1c, 0x00, 0x00, 0x00, 0xe9, 0x56, 0xff, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x1e, 0x00, 0x00, 
+0x00, 0xe9, 0x4a, 0xff, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x22, 0x00, 0x00, 0x00, 0xe9, 0x3e, 0xff, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x23, 0x00, 0x00, 
+0x00, 0xe9, 0x32, 0xff, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x24, 0x00, 0x00, 0x00, 0xe9, 0x26, 0xff, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x26, 0x00, 0x00, 
+0x00, 0xe9, 0x1a, 0xff, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x27, 0x00, 0x00, 0x00, 0xe9, 0x0e, 0xff, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x29, 0x00, 0x00, 
+0x00, 0xe9, 0x02, 0xff, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x2a, 0x00, 0x00, 0x00, 0xe9, 0xf6, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x2c, 0x00, 0x00, 
+0x00, 0xe9, 0xea, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x2d, 0x00, 0x00, 0x00, 0xe9, 0xde, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x2e, 0x00, 0x00, 
+0x00, 0xe9, 0xd2, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x2f, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x30, 0x00, 0x00, 
+0x00, 0xe9, 0xba, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x31, 0x00, 0x00, 0x00, 0xe9, 0xae, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x36, 0x00, 0x00, 
+0x00, 0xe9, 0xa2, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x37, 0x00, 0x00, 0x00, 0xe9, 0x96, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x38, 0x00, 0x00, 
+0x00, 0xe9, 0x8a, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x3c, 0x00, 0x00, 0x00, 0xe9, 0x7e, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x3d, 0x00, 0x00, 
+0x00, 0xe9, 0x72, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x3e, 0x00, 0x00, 0x00, 0xe9, 0x66, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x48, 0x00, 0x00, 
+0x00, 0xe9, 0x5a, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x49, 0x00, 0x00, 0x00, 0xe9, 0x4e, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x53, 0x00, 0x00, 
+0x00, 0xe9, 0x42, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x54, 0x00, 0x00, 0x00, 0xe9, 0x36, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x57, 0x00, 0x00, 
+0x00, 0xe9, 0x2a, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x59, 0x00, 0x00, 0x00, 0xe9, 0x1e, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x5f, 0x00, 0x00, 
+0x00, 0xe9, 0x12, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x73, 0x00, 0x00, 0x00, 0xe9, 0x06, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x75, 0x00, 0x00, 
+0x00, 0xe9, 0xfa, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x77, 0x00, 0x00, 0x00, 0xe9, 0xee, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x79, 0x00, 0x00, 
+0x00, 0xe9, 0xe2, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x7a, 0x00, 0x00, 0x00, 0xe9, 0xd6, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x7b, 0x00, 0x00, 
+0x00, 0xe9, 0xca, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x7c, 0x00, 0x00, 0x00, 0xe9, 0xbe, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x7e, 0x00, 0x00, 
+0x00, 0xe9, 0xb2, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x83, 0x00, 0x00, 
+0x00, 0xe9, 0x9a, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x87, 0x00, 0x00, 0x00, 0xe9, 0x8e, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x8d, 0x00, 0x00, 
+0x00, 0xe9, 0x82, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x90, 0x00, 0x00, 0x00, 0xe9, 0x76, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x9d, 0x00, 0x00, 
+0x00, 0xe9, 0x6a, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x9e, 0x00, 0x00, 0x00, 0xe9, 0x5e, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xa0, 0x00, 0x00, 
+0x00, 0xe9, 0x52, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0xa5, 0x00, 0x00, 0x00, 0xe9, 0x46, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xa6, 0x00, 0x00, 
+0x00, 0xe9, 0x3a, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0xba, 0x00, 0x00, 0x00, 0xe9, 0x2e, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xca, 0x00, 0x00, 
+0x00, 0xe9, 0x22, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0xcd, 0x00, 0x00, 0x00, 0xe9, 0x16, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xd3, 0x00, 0x00, 
+0x00, 0xe9, 0x0a, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0xda, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xdb, 0x00, 0x00, 
+0x00, 0xe9, 0xf2, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0xde, 0x00, 0x00, 0x00, 0xe9, 0xe6, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xdf, 0x00, 0x00, 
+0x00, 0xe9, 0xda, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0xe0, 0x00, 0x00, 0x00, 0xe9, 0xce, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xe1, 0x00, 0x00, 
+0x00, 0xe9, 0xc2, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0xe2, 0x00, 0x00, 0x00, 0xe9, 0xb6, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xe7, 0x00, 0x00, 
+0x00, 0xe9, 0xaa, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x11, 0x01, 0x00, 0x00, 0xe9, 0x9e, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x12, 0x01, 0x00, 
+0x00, 0xe9, 0x92, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x16, 0x01, 0x00, 0x00, 0xe9, 0x86, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x21, 0x01, 0x00, 
+0x00, 0xe9, 0x7a, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x29, 0x01, 0x00, 0x00, 0xe9, 0x6e, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x2c, 0x01, 0x00, 
+0x00, 0xe9, 0x62, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x2d, 0x01, 0x00, 0x00, 0xe9, 0x56, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x2e, 0x01, 0x00, 
+0x00, 0xe9, 0x4a, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x30, 0x01, 0x00, 0x00, 0xe9, 0x3e, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x34, 0x01, 0x00, 
+0x00, 0xe9, 0x32, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x38, 0x01, 0x00, 0x00, 0xe9, 0x26, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x3f, 0x01, 0x00, 
+0x00, 0xe9, 0x1a, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x43, 0x01, 0x00, 0x00, 0xe9, 0x0e, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xb3, 0x01, 0x00, 
+0x00, 0xe9, 0x02, 0xfc, 0xff, 0xff, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x70, 0x72, 0x6f, 0x63, 0x2e, 0x63, 0x72, 0x74, 
+0x6f, 0x6f, 0x6c, 0x73, 0x00, 0x00, 0x00, 0x00, 
+0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 
+0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
+0xab, 0xe4, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 
+0xd3, 0xe8, 0xff, 0xff, 0x7c, 0xe8, 0xff, 0xff, 
+0xae, 0xe7, 0xff, 0xff, 0x3d, 0xe7, 0xff, 0xff, 
+0x94, 0xe6, 0xff, 0xff, 0x18, 0xe6, 0xff, 0xff, 
+0xd5, 0xe5, 0xff, 0xff, 0x89, 0xe5, 0xff, 0xff, 
+0xfc, 0xe4, 0xff, 0xff, 0x40, 0xe8, 0xff, 0xff, 
+0x70, 0x69, 0x65, 0x2f, 0x70, 0x61, 0x72, 0x61, 
+0x73, 0x69, 0x74, 0x65, 0x2e, 0x63, 0x00, 0x5f, 
+0x5f, 0x73, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x63, 
+0x6b, 0x20, 0x6d, 0x73, 0x67, 0x3a, 0x20, 0x25, 
+0x64, 0x20, 0x25, 0x64, 0x20, 0x25, 0x64, 0x0a, 
+0x00, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 
+0x25, 0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 
+0x42, 0x55, 0x47, 0x20, 0x61, 0x74, 0x20, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x0a, 0x00, 0x25, 0x6c, 
+0x64, 0x3a, 0x20, 0x6e, 0x65, 0x77, 0x5f, 0x73, 
+0x70, 0x3d, 0x25, 0x6c, 0x78, 0x20, 0x69, 0x70, 
+0x20, 0x25, 0x6c, 0x78, 0x0a, 0x00, 0x52, 0x75, 
+0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x61, 
+0x65, 0x6d, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x72, 
+0x65, 0x61, 0x64, 0x20, 0x6c, 0x65, 0x61, 0x64, 
+0x65, 0x72, 0x0a, 0x00, 0x44, 0x61, 0x65, 0x6d, 
+0x6f, 0x6e, 0x20, 0x77, 0x61, 0x69, 0x73, 0x20, 
+0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 
+0x61, 0x6e, 0x64, 0x0a, 0x00, 0x5f, 0x5f, 0x66, 
+0x65, 0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x6d, 
+0x73, 0x67, 0x3a, 0x20, 0x25, 0x64, 0x20, 0x25, 
+0x64, 0x20, 0x25, 0x64, 0x0a, 0x00, 0x2f, 0x70, 
+0x72, 0x6f, 0x63, 0x2f, 0x73, 0x65, 0x6c, 0x66, 
+0x00, 0x2f, 0x70, 0x72, 0x6f, 0x63, 0x00, 0x50, 
+0x61, 0x72, 0x61, 0x73, 0x69, 0x74, 0x65, 0x20, 
+0x63, 0x6d, 0x64, 0x20, 0x25, 0x64, 0x2f, 0x25, 
+0x78, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 
+0x73, 0x0a, 0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 
+0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0x62, 0x63, 
+0x64, 0x65, 0x66, 0x00, 0x70, 0x69, 0x65, 0x2f, 
+0x75, 0x74, 0x69, 0x6c, 0x2e, 0x63, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x6d, 
+0x70, 0x72, 0x6f, 0x74, 0x65, 0x63, 0x74, 0x28, 
+0x25, 0x30, 0x38, 0x6c, 0x78, 0x2c, 0x20, 0x25, 
+0x6c, 0x75, 0x29, 0x20, 0x66, 0x61, 0x69, 0x6c, 
+0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 
+0x63, 0x6f, 0x64, 0x65, 0x20, 0x25, 0x64, 0x0a, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x53, 
+0x65, 0x6e, 0x74, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 
+0x20, 0x25, 0x64, 0x20, 0x62, 0x79, 0x74, 0x65, 
+0x73, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 
+0x25, 0x64, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 
+0x74, 0x65, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x54, 
+0x72, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x20, 0x6d, 
+0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x72, 
+0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x20, 
+0x28, 0x25, 0x64, 0x2f, 0x25, 0x64, 0x29, 0x0a, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x72, 
+0x65, 0x6a, 0x65, 0x63, 0x74, 0x65, 0x64, 0x0a, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x73, 0x70, 0x6c, 
+0x69, 0x63, 0x65, 0x20, 0x70, 0x61, 0x67, 0x65, 
+0x73, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x69, 0x70, 
+0x65, 0x20, 0x28, 0x25, 0x64, 0x2f, 0x25, 0x64, 
+0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x73, 
+0x79, 0x73, 0x5f, 0x73, 0x69, 0x67, 0x61, 0x63, 
+0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x61, 0x69, 
+0x6c, 0x65, 0x64, 0x20, 0x28, 0x25, 0x64, 0x29, 
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x67, 
+0x65, 0x74, 0x69, 0x74, 0x69, 0x6d, 0x65, 0x72, 
+0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 
+0x28, 0x25, 0x64, 0x29, 0x0a, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x73, 
+0x79, 0x73, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x72, 
+0x5f, 0x67, 0x65, 0x74, 0x74, 0x69, 0x6d, 0x65, 
+0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 
+0x28, 0x25, 0x64, 0x29, 0x0a, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x73, 
+0x79, 0x73, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x72, 
+0x5f, 0x67, 0x65, 0x74, 0x6f, 0x76, 0x65, 0x72, 
+0x72, 0x75, 0x6e, 0x20, 0x66, 0x61, 0x69, 0x6c, 
+0x65, 0x64, 0x20, 0x28, 0x25, 0x64, 0x29, 0x0a, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x54, 
+0x6f, 0x6f, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 
+0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x20, 0x69, 
+0x6e, 0x20, 0x74, 0x61, 0x73, 0x6b, 0x20, 0x25, 
+0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x47, 
+0x72, 0x6f, 0x75, 0x70, 0x73, 0x20, 0x63, 0x68, 
+0x61, 0x6e, 0x67, 0x65, 0x64, 0x20, 0x6f, 0x6e, 
+0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6c, 0x79, 
+0x20, 0x25, 0x64, 0x20, 0x2d, 0x3e, 0x20, 0x25, 
+0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x45, 
+0x72, 0x72, 0x6f, 0x72, 0x20, 0x63, 0x61, 0x6c, 
+0x6c, 0x69, 0x6e, 0x67, 0x20, 0x67, 0x65, 0x74, 
+0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x20, 0x28, 
+0x25, 0x64, 0x29, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x73, 
+0x65, 0x6e, 0x64, 0x5f, 0x66, 0x64, 0x73, 0x20, 
+0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x28, 
+0x25, 0x64, 0x29, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x72, 0x65, 0x61, 
+0x64, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x2f, 0x70, 
+0x72, 0x6f, 0x63, 0x2f, 0x73, 0x65, 0x6c, 0x66, 
+0x20, 0x28, 0x25, 0x64, 0x29, 0x0a, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x63, 0x72, 0x65, 
+0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x64, 0x69, 
+0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x20, 
+0x28, 0x25, 0x64, 0x29, 0x0a, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x6d, 
+0x6f, 0x75, 0x6e, 0x74, 0x20, 0x66, 0x61, 0x69, 
+0x6c, 0x65, 0x64, 0x20, 0x28, 0x25, 0x64, 0x29, 
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x54, 
+0x54, 0x59, 0x3a, 0x20, 0x43, 0x61, 0x6e, 0x27, 
+0x74, 0x20, 0x67, 0x65, 0x74, 0x20, 0x73, 0x69, 
+0x64, 0x2f, 0x70, 0x67, 0x72, 0x70, 0x3a, 0x20, 
+0x25, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x63, 
+0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x69, 
+0x6e, 0x20, 0x70, 0x61, 0x72, 0x61, 0x73, 0x69, 
+0x74, 0x65, 0x20, 0x64, 0x61, 0x65, 0x6d, 0x6f, 
+0x6e, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 
+0x20, 0x6c, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3a, 
+0x20, 0x25, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x6c, 0x6f, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 
+0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 
+0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20, 
+0x66, 0x6f, 0x72, 0x20, 0x77, 0x72, 0x69, 0x74, 
+0x69, 0x6e, 0x67, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x63, 0x72, 0x65, 
+0x61, 0x74, 0x65, 0x20, 0x73, 0x6f, 0x63, 0x6b, 
+0x65, 0x74, 0x3a, 0x20, 0x25, 0x64, 0x0a, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x63, 0x6f, 0x6e, 
+0x6e, 0x65, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 
+0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 
+0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x0a, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x54, 
+0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x72, 0x75, 
+0x6e, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x75, 0x6e, 
+0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x73, 0x74, 
+0x61, 0x63, 0x6b, 0x20, 0x25, 0x6c, 0x78, 0x0a, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x63, 
+0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x74, 
+0x6f, 0x20, 0x70, 0x61, 0x72, 0x61, 0x73, 0x69, 
+0x74, 0x65, 0x3a, 0x20, 0x25, 0x64, 0x0a, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x6f, 0x70, 0x65, 
+0x6e, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 
+0x6f, 0x72, 0x79, 0x20, 0x25, 0x73, 0x3a, 0x20, 
+0x25, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x64, 0x65, 0x74, 
+0x61, 0x63, 0x68, 0x20, 0x6d, 0x6f, 0x75, 0x6e, 
+0x74, 0x20, 0x25, 0x73, 0x3a, 0x20, 0x25, 0x64, 
+0x0a, 0x3a, 0x20, 0x25, 0x6d, 0x0a, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x72, 0x65, 0x6d, 
+0x6f, 0x76, 0x65, 0x20, 0x74, 0x6d, 0x70, 0x20, 
+0x64, 0x69, 0x72, 0x20, 0x25, 0x73, 0x3a, 0x20, 
+0x25, 0x64, 0x0a, 0x3a, 0x20, 0x25, 0x6d, 0x0a, 
+0x00, 0x00, 0x00, 0x00, 0x70, 0x69, 0x65, 0x3a, 
+0x30, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+
+};
+
+#endif /* __parasite_h__ */
@@ -68,7 +68,7 @@ static int dump_pages(struct parasite_dump_pages_args *args)
 		return -1;
 
 	iovs = pargs_iovs(args);
-	ret = sys_vmsplice(p, &iovs[args->off], args->nr_segs,
+	ret = sys_vmsplice(p, iovs, args->nr_segs,
 				SPLICE_F_GIFT | SPLICE_F_NONBLOCK);
 	if (ret != PAGE_SIZE * args->nr_pages) {
 		sys_close(p);
@@ -208,10 +208,19 @@ static int drain_fds(struct parasite_drain_fd *args)
 	return ret;
 }
 
-static int dump_thread(struct parasite_dump_thread *args)
+static int dump_thread(struct parasite_dump_threads_args *args)
 {
-	args->tid = sys_gettid();
-	return dump_thread_common(args);
+	unsigned long sp = (unsigned long)&args;
+	unsigned int i;
+
+	i = (sp - args->stacks) / PARASITE_STACK_SIZE;
+	if (sp < args->stacks || i >= args->nr) {
+		pr_err("Thread runs on unknown stack %lx\n", sp);
+		return -1;
+	}
+
+	args->ti[i].tid = sys_gettid();
+	return dump_thread_common(&args->ti[i]);
 }
 
 static char proc_mountpoint[] = "proc.crtools";
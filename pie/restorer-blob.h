@@ -0,0 +1,2414 @@
+/* Autogenerated by pie/../scripts/gen-offsets.sh, do not edit */
+#ifndef __restorer_h__
+#define __restorer_h__
+
+#define restorer_blob_offset____export_parasite_args 0x0000000000004b00
+#define restorer_blob_offset____export_restore_task 0x0000000000000d30
+#define restorer_blob_offset____export_restore_thread 0x0000000000000960
+#define restorer_blob_offset____export_unmap 0x0000000000000d10
+
+static char restorer_blob[] = {
+0x41, 0x57, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0x31, 
+0xd2, 0x41, 0x56, 0xbe, 0x04, 0x00, 0x00, 0x00, 
+0x41, 0x55, 0x41, 0x54, 0x49, 0x89, 0xfc, 0xbf, 
+0x1c, 0x00, 0x00, 0x00, 0x55, 0x53, 0x48, 0x83, 
+0xec, 0x38, 0xe8, 0xa5, 0x3b, 0x00, 0x00, 0x85, 
+0xc0, 0x0f, 0x85, 0x13, 0x02, 0x00, 0x00, 0x41, 
+0x8b, 0x54, 0x24, 0x28, 0x41, 0x8b, 0x74, 0x24, 
+0x20, 0x41, 0x8b, 0x7c, 0x24, 0x18, 0xe8, 0xf9, 
+0x3a, 0x00, 0x00, 0x85, 0xc0, 0x0f, 0x85, 0xd3, 
+0x01, 0x00, 0x00, 0x41, 0x8b, 0x7c, 0x24, 0x30, 
+0xe8, 0x0b, 0x3b, 0x00, 0x00, 0xbf, 0xff, 0xff, 
+0xff, 0xff, 0xe8, 0x01, 0x3b, 0x00, 0x00, 0x48, 
+0x89, 0xc2, 0x41, 0x8b, 0x44, 0x24, 0x30, 0x48, 
+0x39, 0xc2, 0x0f, 0x85, 0x8d, 0x01, 0x00, 0x00, 
+0x41, 0x8b, 0x54, 0x24, 0x2c, 0x41, 0x8b, 0x74, 
+0x24, 0x24, 0x41, 0x8b, 0x7c, 0x24, 0x1c, 0xe8, 
+0xc4, 0x3a, 0x00, 0x00, 0x85, 0xc0, 0x0f, 0x85, 
+0xdd, 0x01, 0x00, 0x00, 0x41, 0x8b, 0x7c, 0x24, 
+0x34, 0xe8, 0xd6, 0x3a, 0x00, 0x00, 0xbf, 0xff, 
+0xff, 0xff, 0xff, 0xe8, 0xcc, 0x3a, 0x00, 0x00, 
+0x48, 0x89, 0xc2, 0x41, 0x8b, 0x44, 0x24, 0x34, 
+0x48, 0x39, 0xc2, 0x0f, 0x85, 0x2b, 0x01, 0x00, 
+0x00, 0x41, 0x8b, 0x74, 0x24, 0x78, 0x45, 0x31, 
+0xc0, 0x31, 0xc9, 0x31, 0xd2, 0xbf, 0x1c, 0x00, 
+0x00, 0x00, 0xe8, 0x05, 0x3b, 0x00, 0x00, 0x85, 
+0xc0, 0x0f, 0x85, 0xc1, 0x01, 0x00, 0x00, 0x45, 
+0x31, 0xf6, 0x45, 0x31, 0xff, 0x41, 0xbd, 0x01, 
+0x00, 0x00, 0x00, 0x31, 0xdb, 0xeb, 0x3a, 0x90, 
+0x49, 0x8b, 0x54, 0x24, 0x70, 0x44, 0x89, 0xe8, 
+0x89, 0xd9, 0xd3, 0xe0, 0x42, 0x23, 0x04, 0x3a, 
+0x75, 0x1d, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0x31, 
+0xd2, 0xbf, 0x18, 0x00, 0x00, 0x00, 0x49, 0x8d, 
+0x34, 0x1e, 0xe8, 0xc5, 0x3a, 0x00, 0x00, 0x85, 
+0xc0, 0x0f, 0x85, 0xa1, 0x00, 0x00, 0x00, 0x48, 
+0x83, 0xc3, 0x01, 0x48, 0x83, 0xfb, 0x20, 0x74, 
+0x0c, 0x41, 0x8d, 0x2c, 0x1e, 0x3b, 0x2d, 0xb5, 
+0x49, 0x00, 0x00, 0x7e, 0xbb, 0x49, 0x83, 0xc7, 
+0x04, 0x49, 0x83, 0xfe, 0x20, 0x74, 0x11, 0x41, 
+0xbe, 0x20, 0x00, 0x00, 0x00, 0xeb, 0xa4, 0x66, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x49, 0x8b, 0x4c, 0x24, 0x60, 0x49, 0x8b, 0x54, 
+0x24, 0x50, 0x48, 0x8d, 0x7c, 0x24, 0x08, 0x48, 
+0xc7, 0x44, 0x24, 0x08, 0x22, 0x05, 0x08, 0x20, 
+0x8b, 0x01, 0x89, 0x44, 0x24, 0x10, 0x8b, 0x02, 
+0x89, 0x44, 0x24, 0x14, 0x49, 0x8b, 0x44, 0x24, 
+0x40, 0x8b, 0x30, 0x89, 0x74, 0x24, 0x18, 0x8b, 
+0x49, 0x04, 0x48, 0x8d, 0x74, 0x24, 0x10, 0x89, 
+0x4c, 0x24, 0x1c, 0x8b, 0x52, 0x04, 0x89, 0x54, 
+0x24, 0x20, 0x8b, 0x40, 0x04, 0x89, 0x44, 0x24, 
+0x24, 0xe8, 0xf6, 0x39, 0x00, 0x00, 0x89, 0xc2, 
+0x85, 0xc0, 0x0f, 0x85, 0x1f, 0x01, 0x00, 0x00, 
+0x48, 0x83, 0xc4, 0x38, 0x89, 0xd0, 0x5b, 0x5d, 
+0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 
+0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x41, 0x89, 0xc1, 0x41, 0x89, 0xe8, 0xb9, 0xa0, 
+0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 
+0x48, 0x8d, 0x15, 0x99, 0x3b, 0x00, 0x00, 0x48, 
+0x8d, 0x35, 0x4a, 0x3f, 0x00, 0x00, 0x31, 0xc0, 
+0xe8, 0x0b, 0x2c, 0x00, 0x00, 0xba, 0xff, 0xff, 
+0xff, 0xff, 0xeb, 0xbc, 0xb9, 0x83, 0x00, 0x00, 
+0x00, 0x48, 0x8d, 0x15, 0x78, 0x3b, 0x00, 0x00, 
+0x48, 0x8d, 0x35, 0xc9, 0x3e, 0x00, 0x00, 0x31, 
+0xc0, 0xbf, 0x01, 0x00, 0x00, 0x00, 0xe8, 0xe5, 
+0x2b, 0x00, 0x00, 0xeb, 0xd8, 0xb9, 0x77, 0x00, 
+0x00, 0x00, 0x48, 0x8d, 0x15, 0x57, 0x3b, 0x00, 
+0x00, 0x48, 0x8d, 0x35, 0x38, 0x3e, 0x00, 0x00, 
+0x31, 0xc0, 0xbf, 0x01, 0x00, 0x00, 0x00, 0xe8, 
+0xc4, 0x2b, 0x00, 0x00, 0xeb, 0xb7, 0x41, 0x89, 
+0xc0, 0xb9, 0x71, 0x00, 0x00, 0x00, 0x31, 0xc0, 
+0xbf, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x15, 
+0x2c, 0x3b, 0x00, 0x00, 0x48, 0x8d, 0x35, 0xc5, 
+0x3d, 0x00, 0x00, 0xe8, 0xa0, 0x2b, 0x00, 0x00, 
+0xeb, 0x93, 0x41, 0x89, 0xc0, 0xb9, 0x65, 0x00, 
+0x00, 0x00, 0x31, 0xc0, 0xbf, 0x01, 0x00, 0x00, 
+0x00, 0x48, 0x8d, 0x15, 0x08, 0x3b, 0x00, 0x00, 
+0x48, 0x8d, 0x35, 0x61, 0x3d, 0x00, 0x00, 0xe8, 
+0x7c, 0x2b, 0x00, 0x00, 0xe9, 0x6c, 0xff, 0xff, 
+0xff, 0x41, 0x89, 0xc0, 0xb9, 0x7d, 0x00, 0x00, 
+0x00, 0x31, 0xc0, 0xbf, 0x01, 0x00, 0x00, 0x00, 
+0x48, 0x8d, 0x15, 0xe1, 0x3a, 0x00, 0x00, 0x48, 
+0x8d, 0x35, 0xea, 0x3d, 0x00, 0x00, 0xe8, 0x55, 
+0x2b, 0x00, 0x00, 0xe9, 0x45, 0xff, 0xff, 0xff, 
+0x41, 0x89, 0xc0, 0xb9, 0x8e, 0x00, 0x00, 0x00, 
+0x31, 0xc0, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x48, 
+0x8d, 0x15, 0xba, 0x3a, 0x00, 0x00, 0x48, 0x8d, 
+0x35, 0x33, 0x3e, 0x00, 0x00, 0xe8, 0x2e, 0x2b, 
+0x00, 0x00, 0xe9, 0x1e, 0xff, 0xff, 0xff, 0x41, 
+0x89, 0xc0, 0xb9, 0xb9, 0x00, 0x00, 0x00, 0x31, 
+0xc0, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8d, 
+0x15, 0x93, 0x3a, 0x00, 0x00, 0x48, 0x8d, 0x35, 
+0x7c, 0x3e, 0x00, 0x00, 0xe8, 0x07, 0x2b, 0x00, 
+0x00, 0xe9, 0xf7, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0x85, 0xf6, 0x0f, 0x8e, 0xe9, 0x00, 0x00, 0x00, 
+0x41, 0x57, 0x48, 0x63, 0xf6, 0x41, 0x56, 0x48, 
+0xc1, 0xe6, 0x07, 0x4c, 0x8d, 0x35, 0x75, 0x3a, 
+0x00, 0x00, 0x41, 0x55, 0x41, 0x89, 0xd5, 0x41, 
+0x54, 0x44, 0x0f, 0xb6, 0xe2, 0x55, 0x48, 0x8d, 
+0x2c, 0x37, 0x53, 0x48, 0x89, 0xfb, 0x48, 0x83, 
+0xec, 0x18, 0xeb, 0x2a, 0x0f, 0x1f, 0x40, 0x00, 
+0x44, 0x8b, 0x3b, 0xe8, 0x08, 0x37, 0x00, 0x00, 
+0x48, 0x89, 0xda, 0x44, 0x89, 0xfe, 0x89, 0xc7, 
+0xe8, 0x63, 0x38, 0x00, 0x00, 0x85, 0xc0, 0x75, 
+0x4e, 0x48, 0x83, 0xeb, 0x80, 0x48, 0x39, 0xeb, 
+0x0f, 0x84, 0x82, 0x00, 0x00, 0x00, 0x8b, 0x13, 
+0x31, 0xc0, 0x44, 0x89, 0xe1, 0x4c, 0x89, 0xf6, 
+0xbf, 0x03, 0x00, 0x00, 0x00, 0xe8, 0x8e, 0x2a, 
+0x00, 0x00, 0x45, 0x84, 0xed, 0x75, 0xc1, 0x8b, 
+0x13, 0x89, 0x54, 0x24, 0x0c, 0xe8, 0xa6, 0x38, 
+0x00, 0x00, 0x49, 0x89, 0xc7, 0xe8, 0xbe, 0x36, 
+0x00, 0x00, 0x8b, 0x54, 0x24, 0x0c, 0x48, 0x89, 
+0xd9, 0x44, 0x89, 0xfe, 0x89, 0xc7, 0xe8, 0x4d, 
+0x39, 0x00, 0x00, 0x85, 0xc0, 0x74, 0xb2, 0x48, 
+0x83, 0xec, 0x08, 0x44, 0x8b, 0x4b, 0x08, 0x48, 
+0x8d, 0x15, 0xd2, 0x39, 0x00, 0x00, 0xb9, 0xe7, 
+0x00, 0x00, 0x00, 0x50, 0x44, 0x8b, 0x03, 0x31, 
+0xc0, 0x48, 0x8d, 0x35, 0xe8, 0x3d, 0x00, 0x00, 
+0xbf, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x36, 0x2a, 
+0x00, 0x00, 0x58, 0x5a, 0xb8, 0xff, 0xff, 0xff, 
+0xff, 0x48, 0x83, 0xc4, 0x18, 0x5b, 0x5d, 0x41, 
+0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 
+0x48, 0x83, 0xc4, 0x18, 0x31, 0xc0, 0x5b, 0x5d, 
+0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 
+0xc3, 0x31, 0xc0, 0xc3, 0x66, 0x66, 0x2e, 0x0f, 
+0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 
+0x55, 0x48, 0x89, 0xfd, 0x53, 0x89, 0xf3, 0x48, 
+0x83, 0xec, 0x08, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x8b, 0x45, 0x00, 0x39, 0xc3, 0x75, 0x59, 0x45, 
+0x31, 0xc9, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0x31, 
+0xf6, 0x89, 0xda, 0x48, 0x89, 0xef, 0xe8, 0x09, 
+0x38, 0x00, 0x00, 0x85, 0xc0, 0x79, 0xe1, 0x83, 
+0xf8, 0xf5, 0x74, 0xdc, 0x4c, 0x8d, 0x05, 0x70, 
+0x39, 0x00, 0x00, 0x41, 0xb9, 0x6b, 0x00, 0x00, 
+0x00, 0x31, 0xc0, 0xb9, 0x6b, 0x00, 0x00, 0x00, 
+0x4c, 0x89, 0xc2, 0x48, 0x8d, 0x35, 0x68, 0x39, 
+0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 0xe8, 
+0xa4, 0x29, 0x00, 0x00, 0x48, 0xc7, 0x04, 0x25, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0f, 0x0b, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x83, 0xc4, 0x08, 0x5b, 0x5d, 0xc3, 0x66, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x41, 0x56, 0x49, 0x89, 0xd0, 0x48, 0x89, 0xf1, 
+0x31, 0xc0, 0x41, 0x55, 0x41, 0x54, 0x49, 0x89, 
+0xfc, 0x55, 0x48, 0x89, 0xd5, 0x48, 0x89, 0xfa, 
+0xbf, 0x03, 0x00, 0x00, 0x00, 0x53, 0x48, 0x89, 
+0xf3, 0x48, 0x8d, 0x35, 0x2f, 0x39, 0x00, 0x00, 
+0xe8, 0x53, 0x29, 0x00, 0x00, 0x4c, 0x89, 0xe0, 
+0x48, 0x29, 0xd8, 0x48, 0x39, 0xe8, 0x72, 0x30, 
+0x48, 0x89, 0xd8, 0x4c, 0x29, 0xe0, 0x48, 0x39, 
+0xe8, 0x0f, 0x83, 0xe9, 0x00, 0x00, 0x00, 0x4c, 
+0x8d, 0xac, 0x2b, 0x00, 0xf0, 0xff, 0xff, 0x49, 
+0x39, 0xdc, 0x75, 0x1c, 0x0f, 0x1f, 0x40, 0x00, 
+0x31, 0xc0, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 
+0x41, 0x5e, 0xc3, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x49, 0x89, 0xdd, 0x49, 0x39, 0xdc, 0x74, 0xe8, 
+0x4d, 0x85, 0xed, 0x0f, 0x84, 0xc7, 0x00, 0x00, 
+0x00, 0x45, 0x31, 0xc9, 0x45, 0x31, 0xc0, 0x31, 
+0xd2, 0xb9, 0x22, 0x00, 0x00, 0x00, 0xbe, 0x00, 
+0x10, 0x00, 0x00, 0x4c, 0x89, 0xef, 0xe8, 0x89, 
+0x34, 0x00, 0x00, 0x49, 0x39, 0xc5, 0x0f, 0x85, 
+0xa9, 0x00, 0x00, 0x00, 0x45, 0x31, 0xc9, 0x45, 
+0x31, 0xc0, 0xb9, 0x22, 0x00, 0x00, 0x00, 0x31, 
+0xd2, 0x48, 0x89, 0xee, 0x31, 0xff, 0xe8, 0x69, 
+0x34, 0x00, 0x00, 0x49, 0x89, 0xc5, 0x48, 0x83, 
+0xf8, 0xff, 0x0f, 0x84, 0xda, 0x00, 0x00, 0x00, 
+0x49, 0x89, 0xc0, 0xb9, 0x03, 0x00, 0x00, 0x00, 
+0x48, 0x89, 0xea, 0x48, 0x89, 0xee, 0x4c, 0x89, 
+0xe7, 0xe8, 0x92, 0x34, 0x00, 0x00, 0x49, 0x89, 
+0xc6, 0x49, 0x39, 0xc5, 0x0f, 0x85, 0x8a, 0x00, 
+0x00, 0x00, 0x49, 0x89, 0xd8, 0xb9, 0x03, 0x00, 
+0x00, 0x00, 0x48, 0x89, 0xea, 0x48, 0x89, 0xee, 
+0x4c, 0x89, 0xf7, 0xe8, 0x70, 0x34, 0x00, 0x00, 
+0x48, 0x39, 0xc3, 0x0f, 0x84, 0x57, 0xff, 0xff, 
+0xff, 0x49, 0x89, 0xd9, 0x4d, 0x89, 0xf0, 0xb9, 
+0xd3, 0x01, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 
+0x00, 0x48, 0x8d, 0x15, 0xe8, 0x37, 0x00, 0x00, 
+0x48, 0x8d, 0x35, 0xe9, 0x3c, 0x00, 0x00, 0x31, 
+0xc0, 0xe8, 0x5a, 0x28, 0x00, 0x00, 0xb8, 0xff, 
+0xff, 0xff, 0xff, 0xe9, 0x2a, 0xff, 0xff, 0xff, 
+0x4d, 0x89, 0xe6, 0x49, 0x39, 0xdc, 0x75, 0xaa, 
+0xe9, 0x1b, 0xff, 0xff, 0xff, 0x0f, 0x1f, 0x00, 
+0x4d, 0x89, 0xe6, 0xeb, 0x9d, 0x49, 0x89, 0xc1, 
+0x4d, 0x89, 0xe8, 0xb9, 0xbb, 0x01, 0x00, 0x00, 
+0xbf, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x15, 
+0xa4, 0x37, 0x00, 0x00, 0x48, 0x8d, 0x35, 0x05, 
+0x3c, 0x00, 0x00, 0x31, 0xc0, 0xe8, 0x16, 0x28, 
+0x00, 0x00, 0xeb, 0xba, 0x48, 0x83, 0xec, 0x08, 
+0x4d, 0x89, 0xe9, 0x4d, 0x89, 0xe0, 0xb9, 0xca, 
+0x01, 0x00, 0x00, 0x50, 0x48, 0x8d, 0x15, 0x7d, 
+0x37, 0x00, 0x00, 0x31, 0xc0, 0x48, 0x8d, 0x35, 
+0x44, 0x3c, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 
+0x00, 0xe8, 0xea, 0x27, 0x00, 0x00, 0x58, 0x5a, 
+0xeb, 0x8c, 0x49, 0xc7, 0xc0, 0xff, 0xff, 0xff, 
+0xff, 0xb9, 0xc3, 0x01, 0x00, 0x00, 0x31, 0xc0, 
+0xbf, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x15, 
+0x4c, 0x37, 0x00, 0x00, 0x48, 0x8d, 0x35, 0xe5, 
+0x3b, 0x00, 0x00, 0xe8, 0xc0, 0x27, 0x00, 0x00, 
+0xe9, 0x61, 0xff, 0xff, 0xff, 0x66, 0x66, 0x2e, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x48, 0x83, 0xec, 0x08, 0xf0, 0xff, 0x0f, 0x45, 
+0x31, 0xc9, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0xba, 
+0xff, 0xff, 0xff, 0x7f, 0xbe, 0x01, 0x00, 0x00, 
+0x00, 0xe8, 0xc6, 0x35, 0x00, 0x00, 0x48, 0x85, 
+0xc0, 0x78, 0x0d, 0x48, 0x83, 0xc4, 0x08, 0xc3, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x4c, 0x8d, 0x05, 0x24, 0x37, 0x00, 0x00, 0x41, 
+0xb9, 0x46, 0x00, 0x00, 0x00, 0x31, 0xc0, 0xb9, 
+0x46, 0x00, 0x00, 0x00, 0x4c, 0x89, 0xc2, 0x48, 
+0x8d, 0x35, 0x1c, 0x37, 0x00, 0x00, 0xbf, 0x01, 
+0x00, 0x00, 0x00, 0xe8, 0x58, 0x27, 0x00, 0x00, 
+0x48, 0xc7, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0f, 0x0b, 0x66, 0x2e, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x53, 0x48, 0x89, 0xfb, 0x48, 0x83, 0xec, 0x10, 
+0x48, 0x8b, 0xbf, 0xb8, 0x8b, 0x00, 0x00, 0xe8, 
+0x84, 0x35, 0x00, 0x00, 0x80, 0xbb, 0xc0, 0x8b, 
+0x00, 0x00, 0x00, 0x74, 0x0a, 0x8b, 0xb3, 0xd0, 
+0x8b, 0x00, 0x00, 0x85, 0xf6, 0x75, 0x69, 0x8b, 
+0x8b, 0xd8, 0x8b, 0x00, 0x00, 0x44, 0x8b, 0x83, 
+0xdc, 0x8b, 0x00, 0x00, 0x31, 0xc0, 0xbf, 0x03, 
+0x00, 0x00, 0x00, 0x8b, 0x93, 0xd4, 0x8b, 0x00, 
+0x00, 0x48, 0x8d, 0x35, 0xe8, 0x3b, 0x00, 0x00, 
+0xe8, 0xf3, 0x26, 0x00, 0x00, 0x8b, 0x93, 0xd8, 
+0x8b, 0x00, 0x00, 0x31, 0xf6, 0x31, 0xff, 0xe8, 
+0xb8, 0x34, 0x00, 0x00, 0x8b, 0x83, 0xdc, 0x8b, 
+0x00, 0x00, 0x8b, 0xb3, 0xd4, 0x8b, 0x00, 0x00, 
+0x31, 0xff, 0x48, 0x8d, 0x54, 0x24, 0x0c, 0x89, 
+0x44, 0x24, 0x0c, 0xe8, 0xa8, 0x34, 0x00, 0x00, 
+0x48, 0x8d, 0xbb, 0xc8, 0x8a, 0x00, 0x00, 0xe8, 
+0x4c, 0x1d, 0x00, 0x00, 0xf7, 0xd8, 0x19, 0xc0, 
+0x48, 0x83, 0xc4, 0x10, 0x5b, 0xc3, 0x66, 0x90, 
+0x48, 0x8b, 0xbb, 0xc8, 0x8b, 0x00, 0x00, 0xe8, 
+0x5c, 0x35, 0x00, 0x00, 0x85, 0xc0, 0x74, 0x87, 
+0x41, 0x89, 0xc0, 0xb9, 0xfb, 0x00, 0x00, 0x00, 
+0x31, 0xc0, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x48, 
+0x8d, 0x15, 0x0a, 0x36, 0x00, 0x00, 0x48, 0x8d, 
+0x35, 0x3b, 0x3b, 0x00, 0x00, 0xe8, 0x7e, 0x26, 
+0x00, 0x00, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xeb, 
+0xbf, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x48, 0x83, 0xec, 0x18, 0x48, 0x8b, 0x05, 0x6d, 
+0x43, 0x00, 0x00, 0x8b, 0x56, 0x10, 0x8b, 0x40, 
+0x10, 0x83, 0xf8, 0x03, 0x0f, 0x84, 0xd6, 0x00, 
+0x00, 0x00, 0x8b, 0x46, 0x08, 0x48, 0x8d, 0x0d, 
+0x3b, 0x36, 0x00, 0x00, 0xa8, 0x01, 0x74, 0x68, 
+0x44, 0x8b, 0x46, 0x18, 0xbf, 0x03, 0x00, 0x00, 
+0x00, 0x31, 0xc0, 0x48, 0x8d, 0x35, 0x5b, 0x36, 
+0x00, 0x00, 0xe8, 0x31, 0x26, 0x00, 0x00, 0x45, 
+0x31, 0xc9, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0x48, 
+0x8b, 0x3d, 0x2a, 0x43, 0x00, 0x00, 0xba, 0xff, 
+0xff, 0xff, 0x7f, 0xbe, 0x01, 0x00, 0x00, 0x00, 
+0xc7, 0x47, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x48, 
+0x83, 0xc7, 0x0c, 0xe8, 0x3c, 0x34, 0x00, 0x00, 
+0x48, 0x85, 0xc0, 0x78, 0x43, 0xe8, 0x46, 0x32, 
+0x00, 0x00, 0xbe, 0x13, 0x00, 0x00, 0x00, 0x48, 
+0x89, 0xc7, 0xe8, 0xe1, 0x32, 0x00, 0x00, 0xbf, 
+0x01, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x18, 
+0xe9, 0x8f, 0x34, 0x00, 0x00, 0x0f, 0x1f, 0x00, 
+0xa8, 0x02, 0x48, 0x8d, 0x0d, 0xea, 0x35, 0x00, 
+0x00, 0x48, 0x8d, 0x05, 0xd0, 0x35, 0x00, 0x00, 
+0x48, 0x0f, 0x45, 0xc8, 0xeb, 0x82, 0x66, 0x2e, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x41, 0xb9, 0x38, 0x00, 0x00, 0x00, 0x4c, 0x8d, 
+0x05, 0x5e, 0x35, 0x00, 0x00, 0xb9, 0x38, 0x00, 
+0x00, 0x00, 0x4c, 0x89, 0xc2, 0x48, 0x8d, 0x35, 
+0x5e, 0x35, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 
+0x00, 0x31, 0xc0, 0xe8, 0x98, 0x25, 0x00, 0x00, 
+0x48, 0xc7, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0f, 0x0b, 0x66, 0x2e, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x89, 0x54, 0x24, 0x0c, 0xe8, 0xbf, 0x31, 0x00, 
+0x00, 0x8b, 0x54, 0x24, 0x0c, 0xbf, 0x04, 0x00, 
+0x00, 0x00, 0x48, 0x8d, 0x35, 0x7f, 0x3a, 0x00, 
+0x00, 0x41, 0x89, 0xd0, 0x89, 0xd1, 0x48, 0x89, 
+0xc2, 0x31, 0xc0, 0xe8, 0x58, 0x25, 0x00, 0x00, 
+0x48, 0x8b, 0x05, 0x59, 0x42, 0x00, 0x00, 0x48, 
+0x8d, 0x78, 0x0c, 0xf0, 0xff, 0x0f, 0x45, 0x31, 
+0xc9, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0xba, 0xff, 
+0xff, 0xff, 0x7f, 0xbe, 0x01, 0x00, 0x00, 0x00, 
+0xe8, 0x67, 0x33, 0x00, 0x00, 0x48, 0x85, 0xc0, 
+0x0f, 0x88, 0x8a, 0x00, 0x00, 0x00, 0xf0, 0xff, 
+0x0d, 0x1f, 0x42, 0x00, 0x00, 0x45, 0x31, 0xc9, 
+0x45, 0x31, 0xc0, 0x31, 0xc9, 0xba, 0xff, 0xff, 
+0xff, 0x7f, 0xbe, 0x01, 0x00, 0x00, 0x00, 0x48, 
+0x8d, 0x3d, 0x06, 0x42, 0x00, 0x00, 0xe8, 0x39, 
+0x33, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x78, 0x60, 
+0x48, 0x8b, 0x3d, 0x01, 0x42, 0x00, 0x00, 0x45, 
+0x31, 0xc9, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0xf3, 
+0x0f, 0x7e, 0x0d, 0x91, 0x41, 0x00, 0x00, 0xba, 
+0x01, 0x00, 0x00, 0x00, 0xbe, 0x01, 0x00, 0x00, 
+0x00, 0xf3, 0x0f, 0x7e, 0x07, 0xc7, 0x47, 0x14, 
+0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc7, 0x14, 
+0x66, 0x0f, 0xfe, 0xc1, 0x66, 0x0f, 0xd6, 0x47, 
+0xec, 0xe8, 0xf6, 0x32, 0x00, 0x00, 0x41, 0xb9, 
+0x88, 0x00, 0x00, 0x00, 0xb9, 0x88, 0x00, 0x00, 
+0x00, 0x4c, 0x8d, 0x05, 0x5b, 0x34, 0x00, 0x00, 
+0x48, 0x85, 0xc0, 0x0f, 0x88, 0xf9, 0xfe, 0xff, 
+0xff, 0x48, 0x83, 0xc4, 0x18, 0xc3, 0x66, 0x90, 
+0x41, 0xb9, 0x46, 0x00, 0x00, 0x00, 0x4c, 0x8d, 
+0x05, 0x3e, 0x34, 0x00, 0x00, 0xb9, 0x46, 0x00, 
+0x00, 0x00, 0xe9, 0xdb, 0xfe, 0xff, 0xff, 0x66, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x55, 0x48, 0x89, 0xe5, 0x41, 0x56, 0x41, 0x54, 
+0x53, 0x48, 0x89, 0xfb, 0x48, 0x83, 0xec, 0x18, 
+0xe8, 0x93, 0x32, 0x00, 0x00, 0x44, 0x8b, 0x8b, 
+0xc0, 0x8a, 0x00, 0x00, 0x41, 0x39, 0xc1, 0x0f, 
+0x84, 0xab, 0x00, 0x00, 0x00, 0x41, 0x89, 0xc0, 
+0xb9, 0x17, 0x01, 0x00, 0x00, 0xbf, 0x01, 0x00, 
+0x00, 0x00, 0x48, 0x8d, 0x05, 0xc7, 0x33, 0x00, 
+0x00, 0x48, 0x8d, 0x35, 0x88, 0x39, 0x00, 0x00, 
+0x49, 0x89, 0xc4, 0x48, 0x89, 0xc2, 0x31, 0xc0, 
+0xe8, 0x33, 0x24, 0x00, 0x00, 0xe8, 0x76, 0x30, 
+0x00, 0x00, 0xb9, 0x3b, 0x01, 0x00, 0x00, 0x4c, 
+0x89, 0xe2, 0x48, 0x8d, 0x35, 0xc7, 0x39, 0x00, 
+0x00, 0x49, 0x89, 0xc0, 0xbf, 0x01, 0x00, 0x00, 
+0x00, 0x31, 0xc0, 0xe8, 0x10, 0x24, 0x00, 0x00, 
+0x45, 0x31, 0xc9, 0x45, 0x31, 0xc0, 0x31, 0xc9, 
+0x48, 0x8b, 0x3d, 0x09, 0x41, 0x00, 0x00, 0xba, 
+0xff, 0xff, 0xff, 0x7f, 0xbe, 0x01, 0x00, 0x00, 
+0x00, 0xc7, 0x47, 0x0c, 0xff, 0xff, 0xff, 0xff, 
+0x48, 0x83, 0xc7, 0x0c, 0xe8, 0x1b, 0x32, 0x00, 
+0x00, 0x41, 0xb9, 0x38, 0x00, 0x00, 0x00, 0xb9, 
+0x38, 0x00, 0x00, 0x00, 0x4c, 0x8d, 0x05, 0x80, 
+0x33, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x88, 
+0x1b, 0x01, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 
+0x00, 0xe8, 0x6e, 0x32, 0x00, 0x00, 0x48, 0x8d, 
+0x65, 0xe8, 0x48, 0xc7, 0xc0, 0xff, 0xff, 0xff, 
+0xff, 0x5b, 0x41, 0x5c, 0x41, 0x5e, 0x5d, 0xc3, 
+0x31, 0xd2, 0x48, 0x8d, 0x75, 0xd8, 0xb9, 0x08, 
+0x00, 0x00, 0x00, 0xbf, 0x02, 0x00, 0x00, 0x00, 
+0x48, 0xc7, 0x45, 0xd8, 0xff, 0xff, 0xff, 0xff, 
+0xe8, 0x57, 0x2f, 0x00, 0x00, 0x85, 0xc0, 0x0f, 
+0x85, 0x03, 0x01, 0x00, 0x00, 0x48, 0x89, 0xdf, 
+0xe8, 0x43, 0xfc, 0xff, 0xff, 0x85, 0xc0, 0x74, 
+0x0f, 0x48, 0x8d, 0x05, 0xf8, 0x32, 0x00, 0x00, 
+0x49, 0x89, 0xc4, 0xe9, 0x3d, 0xff, 0xff, 0xff, 
+0x48, 0x8b, 0x83, 0xe0, 0x8b, 0x00, 0x00, 0x48, 
+0x8d, 0xb8, 0x28, 0x01, 0x00, 0x00, 0xe8, 0x7d, 
+0xf5, 0xff, 0xff, 0x48, 0x8d, 0x0d, 0xd6, 0x32, 
+0x00, 0x00, 0x49, 0x89, 0xcc, 0x85, 0xc0, 0x0f, 
+0x85, 0x18, 0xff, 0xff, 0xff, 0xe8, 0x6e, 0x31, 
+0x00, 0x00, 0x48, 0x8d, 0x35, 0x73, 0x33, 0x00, 
+0x00, 0xbf, 0x03, 0x00, 0x00, 0x00, 0x48, 0x89, 
+0xc2, 0x31, 0xc0, 0xe8, 0x30, 0x23, 0x00, 0x00, 
+0x48, 0x8b, 0x05, 0x31, 0x40, 0x00, 0x00, 0x48, 
+0x8d, 0x78, 0x0c, 0xf0, 0xff, 0x0f, 0x31, 0xc9, 
+0x45, 0x31, 0xc9, 0x45, 0x31, 0xc0, 0xba, 0xff, 
+0xff, 0xff, 0x7f, 0xbe, 0x01, 0x00, 0x00, 0x00, 
+0xe8, 0x3f, 0x31, 0x00, 0x00, 0x48, 0x8b, 0x0d, 
+0x0c, 0x40, 0x00, 0x00, 0x49, 0x89, 0xce, 0x4c, 
+0x8d, 0x61, 0x10, 0x48, 0x85, 0xc0, 0x0f, 0x88, 
+0x34, 0x01, 0x00, 0x00, 0x0f, 0x1f, 0x40, 0x00, 
+0x41, 0x8b, 0x46, 0x10, 0x83, 0xf8, 0x02, 0x0f, 
+0x85, 0x8b, 0x00, 0x00, 0x00, 0x45, 0x31, 0xc9, 
+0x45, 0x31, 0xc0, 0x31, 0xc9, 0x31, 0xf6, 0xba, 
+0x02, 0x00, 0x00, 0x00, 0x4c, 0x89, 0xe7, 0xe8, 
+0x00, 0x31, 0x00, 0x00, 0x85, 0xc0, 0x79, 0xd8, 
+0x83, 0xf8, 0xf5, 0x74, 0xd3, 0x41, 0xb9, 0x6b, 
+0x00, 0x00, 0x00, 0x4c, 0x8d, 0x05, 0x61, 0x32, 
+0x00, 0x00, 0xb9, 0x6b, 0x00, 0x00, 0x00, 0x4c, 
+0x89, 0xc2, 0x48, 0x8d, 0x35, 0x61, 0x32, 0x00, 
+0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x31, 0xc0, 
+0xe8, 0x9b, 0x22, 0x00, 0x00, 0x48, 0xc7, 0x04, 
+0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0f, 0x0b, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x41, 0x89, 0xc0, 0xb9, 0x1f, 0x01, 0x00, 0x00, 
+0xbf, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x05, 
+0xf4, 0x31, 0x00, 0x00, 0x48, 0x8d, 0x35, 0xe5, 
+0x37, 0x00, 0x00, 0x49, 0x89, 0xc4, 0x48, 0x89, 
+0xc2, 0x31, 0xc0, 0xe8, 0x60, 0x22, 0x00, 0x00, 
+0xe9, 0x28, 0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x00, 
+0x48, 0x8b, 0x05, 0x59, 0x3f, 0x00, 0x00, 0x8b, 
+0xb3, 0xf8, 0x8b, 0x00, 0x00, 0x31, 0xd2, 0x48, 
+0x8b, 0xbb, 0xf0, 0x8b, 0x00, 0x00, 0x8b, 0x40, 
+0x10, 0xe8, 0x3a, 0xf7, 0xff, 0xff, 0x48, 0x8d, 
+0x0d, 0xb3, 0x31, 0x00, 0x00, 0x49, 0x89, 0xcc, 
+0x85, 0xc0, 0x0f, 0x85, 0xf5, 0xfd, 0xff, 0xff, 
+0x48, 0x8b, 0x05, 0x29, 0x3f, 0x00, 0x00, 0x48, 
+0x8d, 0x78, 0x0c, 0xf0, 0xff, 0x0f, 0x31, 0xc9, 
+0x45, 0x31, 0xc9, 0x45, 0x31, 0xc0, 0xba, 0xff, 
+0xff, 0xff, 0x7f, 0xbe, 0x01, 0x00, 0x00, 0x00, 
+0xe8, 0x37, 0x30, 0x00, 0x00, 0x48, 0x8b, 0x0d, 
+0x04, 0x3f, 0x00, 0x00, 0x49, 0x89, 0xce, 0x4c, 
+0x8d, 0x61, 0x10, 0x48, 0x85, 0xc0, 0x78, 0x30, 
+0x41, 0x8b, 0x46, 0x10, 0x83, 0xf8, 0x03, 0x75, 
+0x47, 0x45, 0x31, 0xc9, 0x45, 0x31, 0xc0, 0x31, 
+0xc9, 0x31, 0xf6, 0xba, 0x03, 0x00, 0x00, 0x00, 
+0x4c, 0x89, 0xe7, 0xe8, 0x04, 0x30, 0x00, 0x00, 
+0x85, 0xc0, 0x79, 0xdc, 0x83, 0xf8, 0xf5, 0x74, 
+0xd7, 0xe9, 0xff, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0x41, 0xb9, 0x46, 0x00, 0x00, 0x00, 0x4c, 0x8d, 
+0x05, 0x5e, 0x31, 0x00, 0x00, 0xb9, 0x46, 0x00, 
+0x00, 0x00, 0xe9, 0xf8, 0xfe, 0xff, 0xff, 0x66, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x48, 0x8b, 0x05, 0xa1, 0x3e, 0x00, 0x00, 0x8b, 
+0x50, 0x10, 0x48, 0x8d, 0x78, 0x0c, 0xf0, 0xff, 
+0x48, 0x0c, 0xba, 0xff, 0xff, 0xff, 0x7f, 0x45, 
+0x31, 0xc9, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0xbe, 
+0x01, 0x00, 0x00, 0x00, 0xe8, 0xab, 0x2f, 0x00, 
+0x00, 0x48, 0x8b, 0x15, 0x78, 0x3e, 0x00, 0x00, 
+0x49, 0x89, 0xd6, 0x4c, 0x8d, 0x62, 0x10, 0x48, 
+0x85, 0xc0, 0x78, 0xa4, 0x0f, 0x1f, 0x40, 0x00, 
+0x41, 0x8b, 0x46, 0x10, 0x83, 0xf8, 0x04, 0x75, 
+0x27, 0x45, 0x31, 0xc9, 0x45, 0x31, 0xc0, 0x31, 
+0xc9, 0x31, 0xf6, 0xba, 0x04, 0x00, 0x00, 0x00, 
+0x4c, 0x89, 0xe7, 0xe8, 0x74, 0x2f, 0x00, 0x00, 
+0x85, 0xc0, 0x79, 0xdc, 0x83, 0xf8, 0xf5, 0x74, 
+0xd7, 0xe9, 0x6f, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0x48, 0x8b, 0x05, 0x31, 0x3e, 0x00, 0x00, 0x8b, 
+0x40, 0x10, 0xf0, 0xff, 0x0d, 0x1f, 0x3e, 0x00, 
+0x00, 0x45, 0x31, 0xc9, 0x45, 0x31, 0xc0, 0x31, 
+0xc9, 0xba, 0xff, 0xff, 0xff, 0x7f, 0xbe, 0x01, 
+0x00, 0x00, 0x00, 0x48, 0x8d, 0x3d, 0x06, 0x3e, 
+0x00, 0x00, 0xe8, 0x35, 0x2f, 0x00, 0x00, 0x48, 
+0x85, 0xc0, 0x0f, 0x88, 0x38, 0xff, 0xff, 0xff, 
+0x48, 0x81, 0xc3, 0x88, 0x80, 0x00, 0x00, 0x48, 
+0x89, 0xd8, 0x48, 0x89, 0xc4, 0xb8, 0x0f, 0x00, 
+0x00, 0x00, 0x0f, 0x05, 0xe9, 0x60, 0xfd, 0xff, 
+0xff, 0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x40, 0x00, 
+0x48, 0x8b, 0x3d, 0xb9, 0x3d, 0x00, 0x00, 0x8b, 
+0x35, 0xab, 0x3d, 0x00, 0x00, 0x48, 0x2b, 0x35, 
+0x9c, 0x3d, 0x00, 0x00, 0xe9, 0x63, 0x2c, 0x00, 
+0x00, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x55, 0x48, 0x89, 0xe5, 0x41, 0x57, 0x41, 0x56, 
+0x41, 0x55, 0x41, 0x54, 0x53, 0x48, 0x89, 0xfb, 
+0x48, 0x81, 0xec, 0xd8, 0x00, 0x00, 0x00, 0xe8, 
+0xdc, 0x2c, 0x00, 0x00, 0xb9, 0x08, 0x00, 0x00, 
+0x00, 0x31, 0xd2, 0x48, 0x8d, 0xb5, 0x70, 0xff, 
+0xff, 0xff, 0x41, 0x89, 0xc4, 0xbf, 0x11, 0x00, 
+0x00, 0x00, 0x48, 0x8b, 0x83, 0xa0, 0x00, 0x00, 
+0x00, 0x48, 0xc7, 0x45, 0x88, 0xff, 0xff, 0xff, 
+0xff, 0x48, 0xc7, 0x85, 0x78, 0xff, 0xff, 0xff, 
+0x04, 0x00, 0x00, 0x14, 0x48, 0x89, 0x05, 0x4d, 
+0x3d, 0x00, 0x00, 0x48, 0x8b, 0x83, 0xa8, 0x00, 
+0x00, 0x00, 0x89, 0x05, 0x38, 0x3d, 0x00, 0x00, 
+0x48, 0x8b, 0x83, 0xb0, 0x00, 0x00, 0x00, 0x48, 
+0x89, 0x05, 0x22, 0x3d, 0x00, 0x00, 0x48, 0x8b, 
+0x43, 0x40, 0x48, 0x89, 0x05, 0x3f, 0x3d, 0x00, 
+0x00, 0x48, 0x8d, 0x05, 0xc0, 0xf9, 0xff, 0xff, 
+0x48, 0x89, 0x85, 0x70, 0xff, 0xff, 0xff, 0x48, 
+0x8d, 0x05, 0x8a, 0x2b, 0x00, 0x00, 0x48, 0x89, 
+0x45, 0x80, 0xe8, 0xd5, 0x2b, 0x00, 0x00, 0x8b, 
+0x7b, 0x0c, 0xe8, 0x51, 0x1f, 0x00, 0x00, 0x8b, 
+0x7b, 0x10, 0xe8, 0x69, 0x1f, 0x00, 0x00, 0x8b, 
+0x83, 0xd8, 0x01, 0x00, 0x00, 0x44, 0x89, 0xe2, 
+0x48, 0x8d, 0x35, 0x3c, 0x30, 0x00, 0x00, 0xbf, 
+0x03, 0x00, 0x00, 0x00, 0x89, 0x05, 0xe6, 0x3c, 
+0x00, 0x00, 0x31, 0xc0, 0xe8, 0xe7, 0x1f, 0x00, 
+0x00, 0x48, 0x8b, 0xb3, 0x00, 0x04, 0x00, 0x00, 
+0x48, 0x8b, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x48, 
+0x8d, 0x3d, 0x32, 0x30, 0x00, 0x00, 0x48, 0x8b, 
+0x93, 0xb0, 0x04, 0x00, 0x00, 0x48, 0x29, 0xf1, 
+0xe8, 0xe3, 0x1b, 0x00, 0x00, 0x85, 0xc0, 0x74, 
+0x7f, 0x48, 0x8b, 0x3d, 0xc0, 0x3c, 0x00, 0x00, 
+0x45, 0x31, 0xc9, 0x45, 0x31, 0xc0, 0x31, 0xc9, 
+0xba, 0xff, 0xff, 0xff, 0x7f, 0xbe, 0x01, 0x00, 
+0x00, 0x00, 0xc7, 0x47, 0x0c, 0xff, 0xff, 0xff, 
+0xff, 0x48, 0x83, 0xc7, 0x0c, 0xe8, 0xca, 0x2d, 
+0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x88, 0x6d, 
+0x02, 0x00, 0x00, 0xe8, 0xd0, 0x2b, 0x00, 0x00, 
+0xb9, 0x00, 0x04, 0x00, 0x00, 0xbf, 0x01, 0x00, 
+0x00, 0x00, 0x48, 0x8d, 0x15, 0xf7, 0x2e, 0x00, 
+0x00, 0x49, 0x89, 0xc0, 0x48, 0x8d, 0x35, 0x8d, 
+0x39, 0x00, 0x00, 0x31, 0xc0, 0xe8, 0x66, 0x1f, 
+0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 0xe8, 
+0x08, 0x2e, 0x00, 0x00, 0x48, 0x8d, 0x65, 0xd8, 
+0x48, 0xc7, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x5b, 
+0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 
+0x5d, 0xc3, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x8b, 0x05, 0x29, 0x3c, 0x00, 0x00, 0x48, 
+0x8b, 0x73, 0x70, 0x44, 0x8b, 0x35, 0x16, 0x3c, 
+0x00, 0x00, 0x4c, 0x8b, 0x7b, 0x78, 0x48, 0x89, 
+0x85, 0x38, 0xff, 0xff, 0xff, 0x49, 0x89, 0xf5, 
+0x48, 0x39, 0xc6, 0x72, 0x19, 0x48, 0x89, 0xc6, 
+0x4c, 0x89, 0xe8, 0x48, 0x89, 0x85, 0x38, 0xff, 
+0xff, 0xff, 0x4c, 0x89, 0xf8, 0x49, 0x89, 0xf5, 
+0x4d, 0x89, 0xf7, 0x49, 0x89, 0xc6, 0x31, 0xff, 
+0xe8, 0xa7, 0x2a, 0x00, 0x00, 0x85, 0xc0, 0x0f, 
+0x85, 0x36, 0x0f, 0x00, 0x00, 0x48, 0x8b, 0xb5, 
+0x38, 0xff, 0xff, 0xff, 0x4d, 0x01, 0xfd, 0x4c, 
+0x89, 0xef, 0x4c, 0x29, 0xee, 0xe8, 0x8a, 0x2a, 
+0x00, 0x00, 0x85, 0xc0, 0x0f, 0x85, 0xe4, 0x0e, 
+0x00, 0x00, 0x48, 0x8b, 0xbd, 0x38, 0xff, 0xff, 
+0xff, 0x49, 0xbd, 0x00, 0xf0, 0xff, 0xff, 0xff, 
+0x7f, 0x00, 0x00, 0x4c, 0x89, 0xee, 0x4c, 0x01, 
+0xf7, 0x48, 0x29, 0xfe, 0x49, 0x89, 0xff, 0xe8, 
+0x60, 0x2a, 0x00, 0x00, 0x85, 0xc0, 0x0f, 0x85, 
+0x53, 0x0f, 0x00, 0x00, 0x8b, 0x53, 0x6c, 0x45, 
+0x31, 0xff, 0x49, 0x83, 0xed, 0x01, 0x4c, 0x8d, 
+0xb3, 0x00, 0x04, 0x00, 0x00, 0x85, 0xd2, 0x75, 
+0x17, 0xe9, 0x08, 0x04, 0x00, 0x00, 0x66, 0x90, 
+0x8b, 0x53, 0x6c, 0x49, 0x83, 0xc7, 0x01, 0x41, 
+0x39, 0xd7, 0x0f, 0x83, 0xa0, 0x01, 0x00, 0x00, 
+0x4b, 0x8d, 0x04, 0x7f, 0x48, 0xc1, 0xe0, 0x05, 
+0x48, 0x03, 0x43, 0x58, 0x48, 0x89, 0x85, 0x38, 
+0xff, 0xff, 0xff, 0x8b, 0x40, 0x40, 0xa8, 0x01, 
+0x74, 0xd9, 0xa9, 0x40, 0x02, 0x00, 0x00, 0x74, 
+0xd2, 0x48, 0x8b, 0xbd, 0x38, 0xff, 0xff, 0xff, 
+0x48, 0x8b, 0x47, 0x20, 0x49, 0x39, 0xc5, 0x72, 
+0xc2, 0x48, 0x8b, 0x77, 0x18, 0x48, 0x8b, 0x7f, 
+0x30, 0x48, 0x39, 0xf7, 0x0f, 0x82, 0x5e, 0x01, 
+0x00, 0x00, 0x48, 0x29, 0xf0, 0x48, 0x89, 0xc2, 
+0xe8, 0xb3, 0xf4, 0xff, 0xff, 0x85, 0xc0, 0x0f, 
+0x85, 0x6c, 0xfe, 0xff, 0xff, 0x48, 0x8b, 0xbd, 
+0x38, 0xff, 0xff, 0xff, 0xf6, 0x47, 0x40, 0x08, 
+0x74, 0x8e, 0x48, 0x8b, 0x8b, 0xb0, 0x04, 0x00, 
+0x00, 0x48, 0x8b, 0x95, 0x38, 0xff, 0xff, 0xff, 
+0x4c, 0x89, 0xf6, 0x48, 0x8d, 0x3d, 0x6e, 0x2e, 
+0x00, 0x00, 0xe8, 0xa1, 0x1a, 0x00, 0x00, 0x85, 
+0xc0, 0x0f, 0x84, 0x69, 0xff, 0xff, 0xff, 0xe9, 
+0x35, 0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x40, 0x00, 
+0x44, 0x8b, 0xa5, 0x28, 0xff, 0xff, 0xff, 0x85, 
+0xd2, 0x0f, 0x84, 0x57, 0x03, 0x00, 0x00, 0x45, 
+0x31, 0xed, 0xeb, 0x2d, 0x0f, 0x1f, 0x40, 0x00, 
+0x41, 0x8b, 0x57, 0x38, 0xf6, 0xc2, 0x02, 0x75, 
+0x10, 0x49, 0x8b, 0x7f, 0x18, 0x49, 0x8b, 0x77, 
+0x20, 0x48, 0x29, 0xfe, 0xe8, 0x63, 0x29, 0x00, 
+0x00, 0x8b, 0x53, 0x6c, 0x49, 0x83, 0xc5, 0x01, 
+0x41, 0x39, 0xd5, 0x0f, 0x83, 0xef, 0x02, 0x00, 
+0x00, 0x4b, 0x8d, 0x44, 0x6d, 0x00, 0x48, 0xc1, 
+0xe0, 0x05, 0x48, 0x03, 0x43, 0x58, 0x49, 0x89, 
+0xc7, 0x8b, 0x40, 0x40, 0xa8, 0x01, 0x74, 0xdc, 
+0xf6, 0xc4, 0x01, 0x74, 0xbb, 0x8b, 0x53, 0x38, 
+0x49, 0x8b, 0x4f, 0x30, 0x48, 0x8b, 0x43, 0x30, 
+0x85, 0xd2, 0x7e, 0xac, 0x48, 0x8d, 0x14, 0x52, 
+0x48, 0xc1, 0xe2, 0x04, 0x48, 0x01, 0xc2, 0xeb, 
+0x10, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x48, 0x83, 0xc0, 0x30, 0x48, 0x39, 0xd0, 0x74, 
+0x8f, 0x48, 0x3b, 0x08, 0x75, 0xf2, 0x44, 0x39, 
+0x60, 0x20, 0x75, 0x84, 0x49, 0x8b, 0x57, 0x18, 
+0x48, 0x39, 0x50, 0x08, 0x0f, 0x85, 0x76, 0xff, 
+0xff, 0xff, 0xc7, 0x40, 0x28, 0x01, 0x00, 0x00, 
+0x00, 0x45, 0x31, 0xc9, 0x45, 0x31, 0xc0, 0x31, 
+0xc9, 0x48, 0x8d, 0x78, 0x28, 0xba, 0xff, 0xff, 
+0xff, 0x7f, 0xbe, 0x01, 0x00, 0x00, 0x00, 0xe8, 
+0x60, 0x2b, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 
+0x89, 0x4b, 0xff, 0xff, 0xff, 0x0f, 0x1f, 0x00, 
+0x41, 0xb9, 0x38, 0x00, 0x00, 0x00, 0x4c, 0x8d, 
+0x05, 0xbe, 0x2c, 0x00, 0x00, 0xb9, 0x38, 0x00, 
+0x00, 0x00, 0x4c, 0x89, 0xc2, 0x48, 0x8d, 0x35, 
+0xbe, 0x2c, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 
+0x00, 0x31, 0xc0, 0xe8, 0xf8, 0x1c, 0x00, 0x00, 
+0x48, 0xc7, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0f, 0x0b, 0x66, 0x2e, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x83, 0xea, 0x01, 0x41, 0x89, 0xd7, 0x0f, 0x88, 
+0xbe, 0x00, 0x00, 0x00, 0x89, 0xd0, 0x4c, 0x8d, 
+0xb3, 0x00, 0x04, 0x00, 0x00, 0x44, 0x89, 0xa5, 
+0x38, 0xff, 0xff, 0xff, 0x49, 0x89, 0xdc, 0x4c, 
+0x8d, 0x04, 0x40, 0x4c, 0x89, 0xf3, 0x49, 0xc1, 
+0xe0, 0x05, 0x4d, 0x89, 0xc6, 0xeb, 0x13, 0x90, 
+0x41, 0x83, 0xef, 0x01, 0x49, 0x83, 0xee, 0x60, 
+0x41, 0x83, 0xff, 0xff, 0x0f, 0x84, 0x7e, 0x00, 
+0x00, 0x00, 0x4d, 0x8b, 0x6c, 0x24, 0x58, 0x4d, 
+0x01, 0xf5, 0x41, 0x8b, 0x45, 0x40, 0xa8, 0x01, 
+0x74, 0xde, 0xa9, 0x40, 0x02, 0x00, 0x00, 0x74, 
+0xd7, 0x48, 0xb8, 0x00, 0xf0, 0xff, 0xff, 0xff, 
+0x7f, 0x00, 0x00, 0x49, 0x8b, 0x75, 0x18, 0x48, 
+0x39, 0xf0, 0x72, 0xc4, 0x49, 0x8b, 0x7d, 0x30, 
+0x48, 0x39, 0xfe, 0x72, 0x4b, 0x49, 0x8b, 0x55, 
+0x20, 0x48, 0x29, 0xf2, 0xe8, 0xdf, 0xf2, 0xff, 
+0xff, 0x85, 0xc0, 0x0f, 0x85, 0x98, 0xfc, 0xff, 
+0xff, 0x41, 0xf6, 0x45, 0x40, 0x08, 0x74, 0xa0, 
+0x49, 0x8b, 0x8c, 0x24, 0xb0, 0x04, 0x00, 0x00, 
+0x4c, 0x89, 0xea, 0x48, 0x89, 0xde, 0x48, 0x8d, 
+0x3d, 0xaf, 0x2c, 0x00, 0x00, 0xe8, 0xd6, 0x18, 
+0x00, 0x00, 0x85, 0xc0, 0x0f, 0x85, 0x6f, 0xfc, 
+0xff, 0xff, 0x41, 0x83, 0xef, 0x01, 0x49, 0x83, 
+0xee, 0x60, 0x41, 0x83, 0xff, 0xff, 0x75, 0x82, 
+0x4c, 0x89, 0xe3, 0x44, 0x8b, 0xa5, 0x38, 0xff, 
+0xff, 0xff, 0x44, 0x8b, 0x7b, 0x6c, 0x45, 0x85, 
+0xff, 0x0f, 0x84, 0x7f, 0x01, 0x00, 0x00, 0x44, 
+0x89, 0xa5, 0x28, 0xff, 0xff, 0xff, 0x45, 0x31, 
+0xf6, 0x4c, 0x8d, 0x2d, 0x79, 0x2c, 0x00, 0x00, 
+0xe9, 0xc4, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x00, 
+0x45, 0x89, 0xd4, 0x41, 0x83, 0xcc, 0x10, 0xf6, 
+0xc4, 0x01, 0x0f, 0x84, 0x08, 0x01, 0x00, 0x00, 
+0x48, 0x83, 0xfa, 0xff, 0x74, 0x14, 0x45, 0x89, 
+0xd1, 0x41, 0x83, 0xe1, 0xdf, 0x41, 0x83, 0xc9, 
+0x10, 0x45, 0x89, 0xcc, 0x41, 0x83, 0xe2, 0x01, 
+0x75, 0x04, 0x41, 0x83, 0xc8, 0x02, 0x48, 0x83, 
+0xec, 0x08, 0x45, 0x89, 0xe1, 0xbf, 0x04, 0x00, 
+0x00, 0x00, 0x45, 0x89, 0xc7, 0x48, 0x8b, 0x85, 
+0x38, 0xff, 0xff, 0xff, 0x48, 0x8b, 0x48, 0x20, 
+0x52, 0x31, 0xc0, 0x48, 0x89, 0xf2, 0x4c, 0x89, 
+0xee, 0xe8, 0x9a, 0x1b, 0x00, 0x00, 0x48, 0x8b, 
+0x85, 0x38, 0xff, 0xff, 0xff, 0x49, 0x63, 0xd7, 
+0x49, 0x63, 0xcc, 0x48, 0x8b, 0x78, 0x18, 0x48, 
+0x8b, 0x70, 0x20, 0x49, 0x89, 0xc4, 0x4c, 0x8b, 
+0x48, 0x28, 0x4c, 0x8b, 0x40, 0x48, 0x48, 0x89, 
+0xb5, 0x30, 0xff, 0xff, 0xff, 0x48, 0x29, 0xfe, 
+0xe8, 0x07, 0x27, 0x00, 0x00, 0x49, 0x8b, 0x7c, 
+0x24, 0x48, 0x49, 0x89, 0xc7, 0x58, 0x5a, 0x48, 
+0x83, 0xff, 0xff, 0x74, 0x05, 0xe8, 0xe2, 0x26, 
+0x00, 0x00, 0x4c, 0x89, 0xf8, 0x48, 0x8b, 0x95, 
+0x38, 0xff, 0xff, 0xff, 0x4c, 0x8b, 0x42, 0x18, 
+0x49, 0x39, 0xc0, 0x0f, 0x85, 0xaa, 0x07, 0x00, 
+0x00, 0x8b, 0x53, 0x6c, 0x49, 0x83, 0xc6, 0x01, 
+0x41, 0x39, 0xd6, 0x0f, 0x83, 0x3f, 0xfd, 0xff, 
+0xff, 0x4b, 0x8d, 0x0c, 0x76, 0x48, 0xc1, 0xe1, 
+0x05, 0x48, 0x03, 0x4b, 0x58, 0x8b, 0x41, 0x40, 
+0x48, 0x89, 0x8d, 0x38, 0xff, 0xff, 0xff, 0xa8, 
+0x01, 0x74, 0xd6, 0xa9, 0x40, 0x02, 0x00, 0x00, 
+0x75, 0xcf, 0x48, 0x8b, 0x51, 0x48, 0x44, 0x8b, 
+0x41, 0x38, 0x44, 0x8b, 0x51, 0x3c, 0x48, 0x8b, 
+0x71, 0x18, 0x89, 0xd7, 0xf6, 0xc4, 0x04, 0x0f, 
+0x84, 0x03, 0xff, 0xff, 0xff, 0x44, 0x89, 0xc2, 
+0xd1, 0xea, 0x83, 0xf2, 0x01, 0x83, 0xe2, 0x01, 
+0xc1, 0xe2, 0x0c, 0xe8, 0xec, 0x26, 0x00, 0x00, 
+0xeb, 0x8b, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x83, 0xfa, 0xff, 0x0f, 0x85, 0x02, 0xff, 
+0xff, 0xff, 0xe9, 0x03, 0xff, 0xff, 0xff, 0x66, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x85, 0xd2, 0x74, 0x32, 0x45, 0x31, 0xed, 0x4f, 
+0x8d, 0x64, 0x6d, 0x00, 0x49, 0xc1, 0xe4, 0x05, 
+0x4c, 0x03, 0x63, 0x58, 0x45, 0x8b, 0x74, 0x24, 
+0x50, 0x45, 0x85, 0xf6, 0x74, 0x0e, 0x49, 0x8b, 
+0x44, 0x24, 0x58, 0x48, 0x85, 0xc0, 0x0f, 0x85, 
+0x84, 0x06, 0x00, 0x00, 0x49, 0x83, 0xc5, 0x01, 
+0x44, 0x3b, 0x6b, 0x6c, 0x72, 0xd1, 0x8b, 0x83, 
+0xf8, 0x03, 0x00, 0x00, 0x85, 0xc0, 0x0f, 0x88, 
+0x1f, 0x01, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0x05, 
+0x34, 0x37, 0x00, 0x00, 0x31, 0xff, 0x48, 0xc7, 
+0x85, 0x60, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
+0x00, 0x0f, 0x29, 0x85, 0x50, 0xff, 0xff, 0xff, 
+0xe8, 0xa3, 0x29, 0x00, 0x00, 0x89, 0x85, 0x28, 
+0xff, 0xff, 0xff, 0x49, 0x89, 0xc6, 0x85, 0xc0, 
+0x0f, 0x88, 0x9f, 0x10, 0x00, 0x00, 0x4c, 0x8d, 
+0xbd, 0x50, 0xff, 0xff, 0xff, 0x8b, 0xbd, 0x28, 
+0xff, 0xff, 0xff, 0xbe, 0x3f, 0xaa, 0x18, 0xc0, 
+0x41, 0x89, 0xc5, 0x4c, 0x89, 0xfa, 0xe8, 0x01, 
+0x26, 0x00, 0x00, 0x85, 0xc0, 0x0f, 0x85, 0x7a, 
+0x0a, 0x00, 0x00, 0x44, 0x8b, 0x4b, 0x6c, 0x45, 
+0x31, 0xff, 0x4c, 0x8d, 0x65, 0x90, 0x66, 0x0f, 
+0xef, 0xc9, 0x45, 0x85, 0xc9, 0x74, 0x74, 0x90, 
+0x4b, 0x8d, 0x34, 0x7f, 0x0f, 0x29, 0x4d, 0x90, 
+0x48, 0xc1, 0xe6, 0x05, 0x48, 0x03, 0x73, 0x58, 
+0x0f, 0x29, 0x4d, 0xa0, 0x48, 0x8b, 0x56, 0x18, 
+0x48, 0x8b, 0x46, 0x20, 0x48, 0x89, 0xb5, 0x30, 
+0xff, 0xff, 0xff, 0x48, 0xc7, 0x45, 0xa0, 0x01, 
+0x00, 0x00, 0x00, 0x48, 0x89, 0x85, 0x38, 0xff, 
+0xff, 0xff, 0x48, 0x29, 0xd0, 0x66, 0x48, 0x0f, 
+0x6e, 0xc2, 0x66, 0x48, 0x0f, 0x6e, 0xd0, 0x66, 
+0x0f, 0x6c, 0xc2, 0x0f, 0x29, 0x45, 0x90, 0xf6, 
+0x46, 0x41, 0x10, 0x74, 0x1c, 0x4c, 0x89, 0xe2, 
+0xbe, 0x00, 0xaa, 0x20, 0xc0, 0x44, 0x89, 0xef, 
+0xe8, 0x87, 0x25, 0x00, 0x00, 0x66, 0x0f, 0xef, 
+0xc9, 0x85, 0xc0, 0x0f, 0x85, 0x05, 0x09, 0x00, 
+0x00, 0x49, 0x83, 0xc7, 0x01, 0x44, 0x3b, 0x7b, 
+0x6c, 0x72, 0x8d, 0x44, 0x89, 0x75, 0x90, 0x8b, 
+0xbb, 0xf8, 0x03, 0x00, 0x00, 0x45, 0x31, 0xc9, 
+0x4c, 0x89, 0xe1, 0x41, 0xb8, 0x01, 0x00, 0x00, 
+0x00, 0x31, 0xd2, 0x31, 0xf6, 0xe8, 0xbe, 0x20, 
+0x00, 0x00, 0x41, 0x89, 0xc0, 0x85, 0xc0, 0x0f, 
+0x85, 0x05, 0x0a, 0x00, 0x00, 0x8b, 0xbd, 0x28, 
+0xff, 0xff, 0xff, 0xe8, 0xf4, 0x24, 0x00, 0x00, 
+0x8b, 0xbb, 0xf8, 0x03, 0x00, 0x00, 0xe8, 0xe9, 
+0x24, 0x00, 0x00, 0x48, 0x8d, 0xb3, 0xcc, 0x03, 
+0x00, 0x00, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0x31, 
+0xd2, 0xbf, 0x0f, 0x00, 0x00, 0x00, 0xe8, 0x31, 
+0x27, 0x00, 0x00, 0x48, 0x89, 0x85, 0x38, 0xff, 
+0xff, 0xff, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x60, 
+0x08, 0x00, 0x00, 0x45, 0x31, 0xc0, 0x31, 0xc9, 
+0xbe, 0x01, 0x00, 0x00, 0x00, 0xbf, 0x23, 0x00, 
+0x00, 0x00, 0x48, 0x8b, 0x93, 0xf8, 0x01, 0x00, 
+0x00, 0xe8, 0x06, 0x27, 0x00, 0x00, 0x49, 0x89, 
+0xc7, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x06, 0x08, 
+0x00, 0x00, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0xbe, 
+0x02, 0x00, 0x00, 0x00, 0xbf, 0x23, 0x00, 0x00, 
+0x00, 0x48, 0x8b, 0x93, 0x00, 0x02, 0x00, 0x00, 
+0xe8, 0xdf, 0x26, 0x00, 0x00, 0x49, 0x89, 0xc6, 
+0x48, 0x85, 0xc0, 0x0f, 0x85, 0xac, 0x07, 0x00, 
+0x00, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0xbe, 0x03, 
+0x00, 0x00, 0x00, 0xbf, 0x23, 0x00, 0x00, 0x00, 
+0x48, 0x8b, 0x93, 0x08, 0x02, 0x00, 0x00, 0xe8, 
+0xb8, 0x26, 0x00, 0x00, 0x49, 0x89, 0xc5, 0x48, 
+0x85, 0xc0, 0x0f, 0x85, 0x52, 0x07, 0x00, 0x00, 
+0x45, 0x31, 0xc0, 0x31, 0xc9, 0xbe, 0x04, 0x00, 
+0x00, 0x00, 0xbf, 0x23, 0x00, 0x00, 0x00, 0x48, 
+0x8b, 0x93, 0x10, 0x02, 0x00, 0x00, 0xe8, 0x91, 
+0x26, 0x00, 0x00, 0x48, 0x89, 0x85, 0x30, 0xff, 
+0xff, 0xff, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0xf4, 
+0x06, 0x00, 0x00, 0x45, 0x31, 0xc0, 0x31, 0xc9, 
+0xbe, 0x05, 0x00, 0x00, 0x00, 0xbf, 0x23, 0x00, 
+0x00, 0x00, 0x48, 0x8b, 0x93, 0x18, 0x02, 0x00, 
+0x00, 0xe8, 0x66, 0x26, 0x00, 0x00, 0x48, 0x89, 
+0x85, 0x28, 0xff, 0xff, 0xff, 0x48, 0x85, 0xc0, 
+0x0f, 0x85, 0x96, 0x06, 0x00, 0x00, 0x45, 0x31, 
+0xc0, 0x31, 0xc9, 0xbe, 0x06, 0x00, 0x00, 0x00, 
+0xbf, 0x23, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x93, 
+0x20, 0x02, 0x00, 0x00, 0xe8, 0x3b, 0x26, 0x00, 
+0x00, 0x48, 0x89, 0x85, 0x20, 0xff, 0xff, 0xff, 
+0x48, 0x85, 0xc0, 0x0f, 0x85, 0x38, 0x06, 0x00, 
+0x00, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0xbe, 0x07, 
+0x00, 0x00, 0x00, 0xbf, 0x23, 0x00, 0x00, 0x00, 
+0x48, 0x8b, 0x93, 0x28, 0x02, 0x00, 0x00, 0xe8, 
+0x10, 0x26, 0x00, 0x00, 0x48, 0x89, 0x85, 0x18, 
+0xff, 0xff, 0xff, 0x48, 0x85, 0xc0, 0x0f, 0x85, 
+0xda, 0x05, 0x00, 0x00, 0x45, 0x31, 0xc0, 0x31, 
+0xc9, 0xbe, 0x08, 0x00, 0x00, 0x00, 0xbf, 0x23, 
+0x00, 0x00, 0x00, 0x48, 0x8b, 0x93, 0x30, 0x02, 
+0x00, 0x00, 0xe8, 0xe5, 0x25, 0x00, 0x00, 0x48, 
+0x89, 0x85, 0x10, 0xff, 0xff, 0xff, 0x48, 0x85, 
+0xc0, 0x0f, 0x85, 0x7c, 0x05, 0x00, 0x00, 0x45, 
+0x31, 0xc0, 0x31, 0xc9, 0xbe, 0x09, 0x00, 0x00, 
+0x00, 0xbf, 0x23, 0x00, 0x00, 0x00, 0x48, 0x8b, 
+0x93, 0x38, 0x02, 0x00, 0x00, 0xe8, 0xba, 0x25, 
+0x00, 0x00, 0x48, 0x89, 0x85, 0x08, 0xff, 0xff, 
+0xff, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x1e, 0x05, 
+0x00, 0x00, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0xbe, 
+0x0a, 0x00, 0x00, 0x00, 0xbf, 0x23, 0x00, 0x00, 
+0x00, 0x48, 0x8b, 0x93, 0x40, 0x02, 0x00, 0x00, 
+0xe8, 0x8f, 0x25, 0x00, 0x00, 0x49, 0x89, 0xc1, 
+0x48, 0x85, 0xc0, 0x0f, 0x85, 0xb9, 0x04, 0x00, 
+0x00, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0xbe, 0x0b, 
+0x00, 0x00, 0x00, 0xbf, 0x23, 0x00, 0x00, 0x00, 
+0x48, 0x8b, 0x93, 0x48, 0x02, 0x00, 0x00, 0x4c, 
+0x89, 0x8d, 0x00, 0xff, 0xff, 0xff, 0xe8, 0x61, 
+0x25, 0x00, 0x00, 0x4c, 0x8b, 0x8d, 0x00, 0xff, 
+0xff, 0xff, 0x4c, 0x8d, 0x9b, 0x68, 0x02, 0x00, 
+0x00, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0xf0, 0x03, 
+0x00, 0x00, 0x48, 0x8b, 0x85, 0x38, 0xff, 0xff, 
+0xff, 0x45, 0x31, 0xc0, 0xbe, 0x0c, 0x00, 0x00, 
+0x00, 0xbf, 0x23, 0x00, 0x00, 0x00, 0x48, 0x8b, 
+0x95, 0x30, 0xff, 0xff, 0xff, 0x8b, 0x8b, 0xc8, 
+0x03, 0x00, 0x00, 0x4c, 0x09, 0xf8, 0x4c, 0x09, 
+0xf0, 0x4c, 0x09, 0xe8, 0x48, 0x09, 0xc2, 0x48, 
+0x8b, 0x85, 0x28, 0xff, 0xff, 0xff, 0x48, 0x09, 
+0xd0, 0x48, 0x8b, 0x95, 0x20, 0xff, 0xff, 0xff, 
+0x48, 0x09, 0xc2, 0x48, 0x8b, 0x85, 0x18, 0xff, 
+0xff, 0xff, 0x48, 0x09, 0xd0, 0x48, 0x8b, 0x95, 
+0x10, 0xff, 0xff, 0xff, 0x48, 0x09, 0xc2, 0x48, 
+0x8b, 0x85, 0x08, 0xff, 0xff, 0xff, 0x48, 0x09, 
+0xd0, 0x4c, 0x89, 0xda, 0x4c, 0x09, 0xc8, 0x49, 
+0x89, 0xc7, 0xe8, 0xdd, 0x24, 0x00, 0x00, 0x48, 
+0x85, 0xc0, 0x0f, 0x85, 0xc5, 0x0b, 0x00, 0x00, 
+0x4c, 0x89, 0xf8, 0x4d, 0x85, 0xff, 0x0f, 0x85, 
+0x1d, 0xf7, 0xff, 0xff, 0x44, 0x8b, 0x63, 0x08, 
+0x48, 0x8d, 0x35, 0x6f, 0x27, 0x00, 0x00, 0xbf, 
+0x03, 0x00, 0x00, 0x00, 0xe8, 0xc7, 0x16, 0x00, 
+0x00, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0xbe, 0x0d, 
+0x00, 0x00, 0x00, 0x49, 0x63, 0xd4, 0xbf, 0x23, 
+0x00, 0x00, 0x00, 0xe8, 0x9c, 0x24, 0x00, 0x00, 
+0x49, 0x89, 0xc7, 0x48, 0x85, 0xc0, 0x0f, 0x85, 
+0x53, 0x06, 0x00, 0x00, 0x44, 0x89, 0xe7, 0xe8, 
+0x28, 0x22, 0x00, 0x00, 0x48, 0x8b, 0x03, 0x48, 
+0x89, 0xc7, 0x48, 0x89, 0x85, 0x28, 0xff, 0xff, 
+0xff, 0xe8, 0x4a, 0xef, 0xff, 0xff, 0x41, 0x89, 
+0xc7, 0x85, 0xc0, 0x0f, 0x85, 0xc0, 0xf6, 0xff, 
+0xff, 0x8b, 0x83, 0xf4, 0x03, 0x00, 0x00, 0x83, 
+0x7b, 0x14, 0x01, 0x41, 0x89, 0xc6, 0x0f, 0x8e, 
+0x1b, 0x01, 0x00, 0x00, 0xbe, 0x02, 0x00, 0x00, 
+0x00, 0x89, 0xc7, 0x4c, 0x8b, 0x6b, 0x28, 0xe8, 
+0x64, 0x23, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 
+0x85, 0x09, 0x0b, 0x00, 0x00, 0x8b, 0x73, 0x14, 
+0x48, 0x8d, 0x85, 0x50, 0xff, 0xff, 0xff, 0x49, 
+0x81, 0xc5, 0xc0, 0x8a, 0x00, 0x00, 0x48, 0x89, 
+0x85, 0x30, 0xff, 0xff, 0xff, 0x85, 0xf6, 0x0f, 
+0x8e, 0xc2, 0x00, 0x00, 0x00, 0x44, 0x89, 0xb5, 
+0x38, 0xff, 0xff, 0xff, 0x48, 0x8b, 0x13, 0x41, 
+0x8b, 0x45, 0x00, 0x3b, 0x82, 0xc0, 0x8a, 0x00, 
+0x00, 0x0f, 0x84, 0x8c, 0x00, 0x00, 0x00, 0x48, 
+0x8b, 0x8d, 0x30, 0xff, 0xff, 0xff, 0x4c, 0x8d, 
+0x65, 0x90, 0x8d, 0x50, 0xff, 0xbe, 0x10, 0x00, 
+0x00, 0x00, 0x4c, 0x89, 0xe7, 0x4d, 0x8d, 0xb5, 
+0xbf, 0xf5, 0xff, 0xff, 0xe8, 0x67, 0x15, 0x00, 
+0x00, 0x48, 0x8b, 0xb5, 0x50, 0xff, 0xff, 0xff, 
+0x8b, 0xbd, 0x38, 0xff, 0xff, 0xff, 0x49, 0x83, 
+0xe6, 0xf8, 0x48, 0x63, 0xd0, 0xe8, 0x5a, 0x21, 
+0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x88, 0x61, 
+0x0a, 0x00, 0x00, 0x48, 0x8d, 0x8d, 0x48, 0xff, 
+0xff, 0xff, 0x4d, 0x8d, 0x85, 0x40, 0x75, 0xff, 
+0xff, 0x4c, 0x89, 0xf6, 0x48, 0x83, 0xee, 0x10, 
+0x4c, 0x89, 0xc7, 0x48, 0x89, 0x7e, 0x08, 0x48, 
+0x8b, 0x7b, 0x20, 0x48, 0x89, 0x3e, 0x48, 0xc7, 
+0xc7, 0x00, 0x0d, 0x05, 0x00, 0x48, 0x89, 0xca, 
+0x4d, 0x89, 0xea, 0xb8, 0x38, 0x00, 0x00, 0x00, 
+0x0f, 0x05, 0x48, 0x85, 0xc0, 0x74, 0x05, 0x49, 
+0x89, 0xc6, 0xeb, 0x07, 0x48, 0x31, 0xed, 0x58, 
+0x5f, 0xff, 0xd0, 0x41, 0x83, 0xc7, 0x01, 0x49, 
+0x81, 0xc5, 0x00, 0x8c, 0x00, 0x00, 0x44, 0x39, 
+0x7b, 0x14, 0x0f, 0x8f, 0x4c, 0xff, 0xff, 0xff, 
+0x44, 0x8b, 0xb5, 0x38, 0xff, 0xff, 0xff, 0xbe, 
+0x08, 0x00, 0x00, 0x00, 0x44, 0x89, 0xf7, 0xe8, 
+0x6c, 0x22, 0x00, 0x00, 0x49, 0x89, 0xc0, 0x48, 
+0x85, 0xc0, 0x0f, 0x85, 0x89, 0x0b, 0x00, 0x00, 
+0x44, 0x8b, 0xb3, 0xf4, 0x03, 0x00, 0x00, 0x44, 
+0x89, 0xf7, 0x45, 0x31, 0xed, 0x4c, 0x8d, 0x65, 
+0x90, 0xe8, 0xce, 0x20, 0x00, 0x00, 0x8b, 0x8b, 
+0xdc, 0x03, 0x00, 0x00, 0x85, 0xc9, 0x7e, 0x2e, 
+0x4c, 0x89, 0xe8, 0x44, 0x89, 0xef, 0x4c, 0x89, 
+0xe6, 0x49, 0x83, 0xc5, 0x01, 0x48, 0xc1, 0xe0, 
+0x04, 0x48, 0x03, 0x83, 0xe0, 0x03, 0x00, 0x00, 
+0xf3, 0x0f, 0x6f, 0x18, 0x0f, 0x29, 0x5d, 0x90, 
+0xe8, 0x17, 0x23, 0x00, 0x00, 0x44, 0x39, 0xab, 
+0xdc, 0x03, 0x00, 0x00, 0x7f, 0xd2, 0x8b, 0x93, 
+0x18, 0x01, 0x00, 0x00, 0x85, 0xd2, 0x0f, 0x8e, 
+0xd3, 0x05, 0x00, 0x00, 0x31, 0xd2, 0x48, 0x8b, 
+0x83, 0x20, 0x01, 0x00, 0x00, 0x4c, 0x8d, 0xbd, 
+0x50, 0xff, 0xff, 0xff, 0x4c, 0x8d, 0x65, 0x90, 
+0x48, 0x89, 0x95, 0x38, 0xff, 0xff, 0xff, 0x48, 
+0x8b, 0x95, 0x38, 0xff, 0xff, 0xff, 0x4c, 0x8d, 
+0x34, 0xd2, 0x49, 0xc1, 0xe6, 0x03, 0x4a, 0x8d, 
+0x14, 0x30, 0x8b, 0x4a, 0x10, 0x89, 0x4d, 0x9c, 
+0x8b, 0x4a, 0x0c, 0x89, 0x4d, 0x98, 0x48, 0x8b, 
+0x52, 0x18, 0x48, 0x89, 0x55, 0x90, 0xeb, 0x40, 
+0x48, 0x8b, 0x83, 0x20, 0x01, 0x00, 0x00, 0x48, 
+0x8b, 0xbd, 0x50, 0xff, 0xff, 0xff, 0x4a, 0x3b, 
+0x3c, 0x30, 0x0f, 0x84, 0x5c, 0x05, 0x00, 0x00, 
+0xe8, 0x3b, 0x23, 0x00, 0x00, 0x49, 0x89, 0xc5, 
+0x85, 0xc0, 0x0f, 0x88, 0xf2, 0x07, 0x00, 0x00, 
+0x48, 0x8b, 0x83, 0x20, 0x01, 0x00, 0x00, 0x4a, 
+0x8b, 0x14, 0x30, 0x48, 0x39, 0x95, 0x50, 0xff, 
+0xff, 0xff, 0x0f, 0x8f, 0x0b, 0x08, 0x00, 0x00, 
+0x42, 0x8b, 0x7c, 0x30, 0x08, 0x4c, 0x89, 0xfa, 
+0x4c, 0x89, 0xe6, 0xe8, 0xd8, 0x22, 0x00, 0x00, 
+0x49, 0x89, 0xc5, 0x85, 0xc0, 0x79, 0xa9, 0x48, 
+0x8b, 0x85, 0x38, 0xff, 0xff, 0xff, 0x4c, 0x8d, 
+0x25, 0xd3, 0x23, 0x00, 0x00, 0xb9, 0xe8, 0x01, 
+0x00, 0x00, 0x48, 0x8d, 0x35, 0x97, 0x2c, 0x00, 
+0x00, 0x4c, 0x89, 0xe2, 0xbf, 0x01, 0x00, 0x00, 
+0x00, 0x41, 0x89, 0xc0, 0x31, 0xc0, 0xe8, 0x35, 
+0x14, 0x00, 0x00, 0x4d, 0x63, 0xc5, 0xb9, 0xa8, 
+0x03, 0x00, 0x00, 0x4c, 0x89, 0xe2, 0xbf, 0x01, 
+0x00, 0x00, 0x00, 0x31, 0xc0, 0x48, 0x8d, 0x35, 
+0x1c, 0x2d, 0x00, 0x00, 0xe8, 0x17, 0x14, 0x00, 
+0x00, 0xe9, 0x53, 0xf4, 0xff, 0xff, 0x66, 0x90, 
+0x45, 0x31, 0xf6, 0xeb, 0x1c, 0x0f, 0x1f, 0x00, 
+0x4c, 0x89, 0xf0, 0x48, 0x83, 0xc0, 0x01, 0x49, 
+0x89, 0xc6, 0x48, 0x83, 0xf8, 0x40, 0x0f, 0x84, 
+0x60, 0xf9, 0xff, 0xff, 0x49, 0x8b, 0x44, 0x24, 
+0x58, 0x4c, 0x0f, 0xa3, 0xf0, 0x73, 0xe1, 0x49, 
+0x8b, 0x7c, 0x24, 0x18, 0x49, 0x8b, 0x74, 0x24, 
+0x20, 0x44, 0x89, 0xf2, 0x48, 0x29, 0xfe, 0xe8, 
+0xd4, 0x1f, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x74, 
+0xc7, 0x4c, 0x89, 0xf3, 0x4d, 0x8b, 0x44, 0x24, 
+0x18, 0x4d, 0x8b, 0x4c, 0x24, 0x20, 0x50, 0x53, 
+0xb9, 0x27, 0x03, 0x00, 0x00, 0x48, 0x8d, 0x15, 
+0x34, 0x23, 0x00, 0x00, 0x31, 0xc0, 0x4d, 0x29, 
+0xc1, 0x48, 0x8d, 0x35, 0xf0, 0x29, 0x00, 0x00, 
+0xbf, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x9e, 0x13, 
+0x00, 0x00, 0x41, 0x5a, 0x41, 0x5b, 0xe9, 0xd6, 
+0xf3, 0xff, 0xff, 0x49, 0x89, 0xc1, 0xb9, 0xf6, 
+0x02, 0x00, 0x00, 0x31, 0xc0, 0xbf, 0x01, 0x00, 
+0x00, 0x00, 0x48, 0x8d, 0x15, 0xff, 0x22, 0x00, 
+0x00, 0x48, 0x8d, 0x35, 0x88, 0x29, 0x00, 0x00, 
+0xe8, 0x73, 0x13, 0x00, 0x00, 0xe9, 0xaf, 0xf3, 
+0xff, 0xff, 0x4c, 0x8d, 0x15, 0xcf, 0x2a, 0x00, 
+0x00, 0x4c, 0x8d, 0x25, 0xe0, 0x22, 0x00, 0x00, 
+0x49, 0x89, 0xc1, 0x41, 0xb8, 0x46, 0x03, 0x00, 
+0x00, 0x4c, 0x89, 0xd6, 0x31, 0xc0, 0xb9, 0x46, 
+0x03, 0x00, 0x00, 0x4c, 0x89, 0xe2, 0xbf, 0x01, 
+0x00, 0x00, 0x00, 0x4c, 0x89, 0x95, 0x38, 0xff, 
+0xff, 0xff, 0x4c, 0x89, 0x9d, 0x30, 0xff, 0xff, 
+0xff, 0xe8, 0x32, 0x13, 0x00, 0x00, 0x8b, 0x8b, 
+0xc8, 0x03, 0x00, 0x00, 0x45, 0x31, 0xc0, 0x48, 
+0x8b, 0x95, 0x30, 0xff, 0xff, 0xff, 0xbe, 0x0c, 
+0x00, 0x00, 0x00, 0xbf, 0x23, 0x00, 0x00, 0x00, 
+0xe8, 0xff, 0x20, 0x00, 0x00, 0x4c, 0x8b, 0x95, 
+0x38, 0xff, 0xff, 0xff, 0x48, 0x85, 0xc0, 0x0f, 
+0x84, 0x44, 0xf3, 0xff, 0xff, 0x49, 0x89, 0xc1, 
+0x41, 0xb8, 0x47, 0x03, 0x00, 0x00, 0xb9, 0x47, 
+0x03, 0x00, 0x00, 0x31, 0xc0, 0x4c, 0x89, 0xe2, 
+0x4c, 0x89, 0xd6, 0xbf, 0x01, 0x00, 0x00, 0x00, 
+0xe8, 0xe3, 0x12, 0x00, 0x00, 0xe9, 0x1f, 0xf3, 
+0xff, 0xff, 0x41, 0xb8, 0x45, 0x03, 0x00, 0x00, 
+0xb9, 0x45, 0x03, 0x00, 0x00, 0xbf, 0x01, 0x00, 
+0x00, 0x00, 0x48, 0x89, 0x85, 0x00, 0xff, 0xff, 
+0xff, 0x4c, 0x8d, 0x15, 0x28, 0x2a, 0x00, 0x00, 
+0x4c, 0x8d, 0x25, 0x39, 0x22, 0x00, 0x00, 0x31, 
+0xc0, 0x4c, 0x89, 0xe2, 0x4c, 0x89, 0xd6, 0xe8, 
+0xac, 0x12, 0x00, 0x00, 0x4c, 0x8b, 0x8d, 0x00, 
+0xff, 0xff, 0xff, 0xe9, 0x09, 0xfb, 0xff, 0xff, 
+0x4c, 0x8d, 0x25, 0x19, 0x22, 0x00, 0x00, 0x4c, 
+0x8d, 0x15, 0xfa, 0x29, 0x00, 0x00, 0x49, 0x89, 
+0xc1, 0x41, 0xb8, 0x44, 0x03, 0x00, 0x00, 0xb9, 
+0x44, 0x03, 0x00, 0x00, 0x4c, 0x89, 0xe2, 0x4c, 
+0x89, 0xd6, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x31, 
+0xc0, 0xe8, 0x72, 0x12, 0x00, 0x00, 0xe9, 0xaf, 
+0xfa, 0xff, 0xff, 0x4c, 0x8d, 0x25, 0xe6, 0x21, 
+0x00, 0x00, 0x4c, 0x8d, 0x15, 0xc7, 0x29, 0x00, 
+0x00, 0x49, 0x89, 0xc1, 0x41, 0xb8, 0x43, 0x03, 
+0x00, 0x00, 0xb9, 0x43, 0x03, 0x00, 0x00, 0x4c, 
+0x89, 0xe2, 0x4c, 0x89, 0xd6, 0xbf, 0x01, 0x00, 
+0x00, 0x00, 0x31, 0xc0, 0xe8, 0x3f, 0x12, 0x00, 
+0x00, 0xe9, 0x51, 0xfa, 0xff, 0xff, 0x4c, 0x8d, 
+0x25, 0xb3, 0x21, 0x00, 0x00, 0x4c, 0x8d, 0x15, 
+0x94, 0x29, 0x00, 0x00, 0x49, 0x89, 0xc1, 0x41, 
+0xb8, 0x42, 0x03, 0x00, 0x00, 0xb9, 0x42, 0x03, 
+0x00, 0x00, 0x4c, 0x89, 0xe2, 0x4c, 0x89, 0xd6, 
+0xbf, 0x01, 0x00, 0x00, 0x00, 0x31, 0xc0, 0xe8, 
+0x0c, 0x12, 0x00, 0x00, 0xe9, 0xf3, 0xf9, 0xff, 
+0xff, 0x4c, 0x8d, 0x25, 0x80, 0x21, 0x00, 0x00, 
+0x4c, 0x8d, 0x15, 0x61, 0x29, 0x00, 0x00, 0x49, 
+0x89, 0xc1, 0x41, 0xb8, 0x41, 0x03, 0x00, 0x00, 
+0xb9, 0x41, 0x03, 0x00, 0x00, 0x4c, 0x89, 0xe2, 
+0x4c, 0x89, 0xd6, 0xbf, 0x01, 0x00, 0x00, 0x00, 
+0x31, 0xc0, 0xe8, 0xd9, 0x11, 0x00, 0x00, 0xe9, 
+0x95, 0xf9, 0xff, 0xff, 0x4c, 0x8d, 0x25, 0x4d, 
+0x21, 0x00, 0x00, 0x4c, 0x8d, 0x15, 0x2e, 0x29, 
+0x00, 0x00, 0x49, 0x89, 0xc1, 0x41, 0xb8, 0x40, 
+0x03, 0x00, 0x00, 0xb9, 0x40, 0x03, 0x00, 0x00, 
+0x4c, 0x89, 0xe2, 0x4c, 0x89, 0xd6, 0xbf, 0x01, 
+0x00, 0x00, 0x00, 0x31, 0xc0, 0xe8, 0xa6, 0x11, 
+0x00, 0x00, 0xe9, 0x37, 0xf9, 0xff, 0xff, 0x4c, 
+0x8d, 0x25, 0x1a, 0x21, 0x00, 0x00, 0x4c, 0x8d, 
+0x15, 0xfb, 0x28, 0x00, 0x00, 0x49, 0x89, 0xc1, 
+0x41, 0xb8, 0x3f, 0x03, 0x00, 0x00, 0xb9, 0x3f, 
+0x03, 0x00, 0x00, 0x4c, 0x89, 0xe2, 0x4c, 0x89, 
+0xd6, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x31, 0xc0, 
+0xe8, 0x73, 0x11, 0x00, 0x00, 0xe9, 0xd9, 0xf8, 
+0xff, 0xff, 0x4c, 0x8d, 0x25, 0xe7, 0x20, 0x00, 
+0x00, 0x4c, 0x8d, 0x15, 0xc8, 0x28, 0x00, 0x00, 
+0x49, 0x89, 0xc1, 0x41, 0xb8, 0x3e, 0x03, 0x00, 
+0x00, 0xb9, 0x3e, 0x03, 0x00, 0x00, 0x4c, 0x89, 
+0xe2, 0x4c, 0x89, 0xd6, 0xbf, 0x01, 0x00, 0x00, 
+0x00, 0x31, 0xc0, 0xe8, 0x40, 0x11, 0x00, 0x00, 
+0xe9, 0x7b, 0xf8, 0xff, 0xff, 0x4c, 0x8d, 0x25, 
+0xb4, 0x20, 0x00, 0x00, 0x4c, 0x8d, 0x15, 0x95, 
+0x28, 0x00, 0x00, 0x49, 0x89, 0xc1, 0x41, 0xb8, 
+0x3d, 0x03, 0x00, 0x00, 0xb9, 0x3d, 0x03, 0x00, 
+0x00, 0x4c, 0x89, 0xe2, 0x4c, 0x89, 0xd6, 0xbf, 
+0x01, 0x00, 0x00, 0x00, 0x31, 0xc0, 0xe8, 0x0d, 
+0x11, 0x00, 0x00, 0xe9, 0x21, 0xf8, 0xff, 0xff, 
+0x4c, 0x8d, 0x25, 0x81, 0x20, 0x00, 0x00, 0x4c, 
+0x8d, 0x15, 0x62, 0x28, 0x00, 0x00, 0x49, 0x89, 
+0xc1, 0x41, 0xb8, 0x3c, 0x03, 0x00, 0x00, 0xb9, 
+0x3c, 0x03, 0x00, 0x00, 0x4c, 0x89, 0xe2, 0x4c, 
+0x89, 0xd6, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x31, 
+0xc0, 0xe8, 0xda, 0x10, 0x00, 0x00, 0xe9, 0xc7, 
+0xf7, 0xff, 0xff, 0x4c, 0x8d, 0x25, 0x4e, 0x20, 
+0x00, 0x00, 0x4c, 0x8d, 0x15, 0x2f, 0x28, 0x00, 
+0x00, 0x49, 0x89, 0xc1, 0x41, 0xb8, 0x3a, 0x03, 
+0x00, 0x00, 0xb9, 0x3a, 0x03, 0x00, 0x00, 0x4c, 
+0x89, 0xe2, 0x4c, 0x89, 0xd6, 0xbf, 0x01, 0x00, 
+0x00, 0x00, 0x31, 0xc0, 0xe8, 0xa7, 0x10, 0x00, 
+0x00, 0xe9, 0x6d, 0xf7, 0xff, 0xff, 0x48, 0x8b, 
+0x95, 0x30, 0xff, 0xff, 0xff, 0x48, 0x83, 0xec, 
+0x08, 0xb9, 0x38, 0x02, 0x00, 0x00, 0x48, 0x8d, 
+0x35, 0x73, 0x27, 0x00, 0x00, 0xbf, 0x01, 0x00, 
+0x00, 0x00, 0x4c, 0x8b, 0x42, 0x18, 0x4c, 0x8b, 
+0x4a, 0x20, 0x50, 0x48, 0x8d, 0x15, 0xf6, 0x1f, 
+0x00, 0x00, 0x31, 0xc0, 0xe8, 0x6f, 0x10, 0x00, 
+0x00, 0x8b, 0xbd, 0x28, 0xff, 0xff, 0xff, 0xe8, 
+0xf0, 0x1b, 0x00, 0x00, 0x8b, 0xbb, 0xf8, 0x03, 
+0x00, 0x00, 0xe8, 0xe5, 0x1b, 0x00, 0x00, 0x5f, 
+0x41, 0x58, 0xe9, 0x92, 0xf0, 0xff, 0xff, 0x4c, 
+0x8d, 0x2d, 0xca, 0x1f, 0x00, 0x00, 0x49, 0x89, 
+0xc1, 0x31, 0xc0, 0x41, 0xb8, 0x46, 0x01, 0x00, 
+0x00, 0xb9, 0x46, 0x01, 0x00, 0x00, 0x4c, 0x89, 
+0xea, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8d, 
+0x35, 0x93, 0x27, 0x00, 0x00, 0xe8, 0x26, 0x10, 
+0x00, 0x00, 0x45, 0x85, 0xff, 0x0f, 0x84, 0x79, 
+0xf9, 0xff, 0xff, 0x45, 0x89, 0xf8, 0xb9, 0x48, 
+0x01, 0x00, 0x00, 0x4c, 0x89, 0xea, 0xbf, 0x01, 
+0x00, 0x00, 0x00, 0x48, 0x8d, 0x35, 0x9e, 0x27, 
+0x00, 0x00, 0x31, 0xc0, 0xe8, 0xff, 0x0f, 0x00, 
+0x00, 0x44, 0x89, 0xe7, 0xe8, 0x83, 0x1b, 0x00, 
+0x00, 0xe9, 0x33, 0xf0, 0xff, 0xff, 0x48, 0x83, 
+0xec, 0x08, 0x4d, 0x89, 0xe8, 0xb9, 0x73, 0x02, 
+0x00, 0x00, 0x50, 0x4c, 0x8b, 0x8d, 0x38, 0xff, 
+0xff, 0xff, 0x48, 0x8d, 0x35, 0xb7, 0x25, 0x00, 
+0x00, 0x48, 0x8d, 0x15, 0x50, 0x1f, 0x00, 0x00, 
+0xbf, 0x01, 0x00, 0x00, 0x00, 0x31, 0xc0, 0xe8, 
+0xc4, 0x0f, 0x00, 0x00, 0x59, 0x5e, 0xe9, 0xfe, 
+0xef, 0xff, 0xff, 0x48, 0x83, 0xec, 0x08, 0x4d, 
+0x89, 0xe9, 0x45, 0x31, 0xc0, 0xb9, 0x6d, 0x02, 
+0x00, 0x00, 0x50, 0xeb, 0xcd, 0x41, 0x89, 0xc0, 
+0xb9, 0x27, 0x02, 0x00, 0x00, 0x48, 0x8d, 0x15, 
+0x1c, 0x1f, 0x00, 0x00, 0x48, 0x8d, 0x35, 0x45, 
+0x26, 0x00, 0x00, 0x31, 0xc0, 0xbf, 0x01, 0x00, 
+0x00, 0x00, 0xe8, 0x89, 0x0f, 0x00, 0x00, 0x8b, 
+0xbd, 0x28, 0xff, 0xff, 0xff, 0xe8, 0x0a, 0x1b, 
+0x00, 0x00, 0x8b, 0xbb, 0xf8, 0x03, 0x00, 0x00, 
+0xe8, 0xff, 0x1a, 0x00, 0x00, 0xe9, 0xaf, 0xef, 
+0xff, 0xff, 0xb9, 0x40, 0x02, 0x00, 0x00, 0x48, 
+0x8d, 0x15, 0xe2, 0x1e, 0x00, 0x00, 0x48, 0x8d, 
+0x35, 0x83, 0x26, 0x00, 0x00, 0xeb, 0xc4, 0x48, 
+0x83, 0xec, 0x08, 0x4d, 0x89, 0xe9, 0x4d, 0x89, 
+0xf8, 0xb9, 0x79, 0x02, 0x00, 0x00, 0x50, 0xe9, 
+0x66, 0xff, 0xff, 0xff, 0x48, 0x83, 0x85, 0x38, 
+0xff, 0xff, 0xff, 0x01, 0x48, 0x8b, 0x95, 0x38, 
+0xff, 0xff, 0xff, 0x39, 0x93, 0x18, 0x01, 0x00, 
+0x00, 0x0f, 0x8f, 0x48, 0xfa, 0xff, 0xff, 0xe8, 
+0x6c, 0x1b, 0x00, 0x00, 0x48, 0x8d, 0x35, 0x51, 
+0x1f, 0x00, 0x00, 0xbf, 0x03, 0x00, 0x00, 0x00, 
+0x48, 0x89, 0xc2, 0x31, 0xc0, 0xe8, 0x0e, 0x0f, 
+0x00, 0x00, 0x8b, 0x43, 0x18, 0x89, 0x05, 0x01, 
+0x2c, 0x00, 0x00, 0x48, 0x8b, 0x05, 0x06, 0x2c, 
+0x00, 0x00, 0x48, 0x8d, 0x78, 0x0c, 0xf0, 0xff, 
+0x0f, 0x45, 0x31, 0xc9, 0x45, 0x31, 0xc0, 0x31, 
+0xc9, 0xba, 0xff, 0xff, 0xff, 0x7f, 0xbe, 0x01, 
+0x00, 0x00, 0x00, 0xe8, 0x14, 0x1d, 0x00, 0x00, 
+0x4c, 0x8b, 0x25, 0xe1, 0x2b, 0x00, 0x00, 0x4d, 
+0x8d, 0x6c, 0x24, 0x10, 0x48, 0x85, 0xc0, 0x0f, 
+0x88, 0xbb, 0x03, 0x00, 0x00, 0x41, 0x8b, 0x44, 
+0x24, 0x10, 0x83, 0xf8, 0x02, 0x75, 0x37, 0x45, 
+0x31, 0xc9, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0x31, 
+0xf6, 0xba, 0x02, 0x00, 0x00, 0x00, 0x4c, 0x89, 
+0xef, 0xe8, 0xde, 0x1c, 0x00, 0x00, 0x85, 0xc0, 
+0x79, 0xdb, 0x83, 0xf8, 0xf5, 0x74, 0xd6, 0x41, 
+0xb9, 0x6b, 0x00, 0x00, 0x00, 0x4c, 0x8d, 0x05, 
+0x3f, 0x1e, 0x00, 0x00, 0xb9, 0x6b, 0x00, 0x00, 
+0x00, 0xe9, 0x7c, 0xf1, 0xff, 0xff, 0x48, 0x8b, 
+0x05, 0x8b, 0x2b, 0x00, 0x00, 0x4c, 0x8d, 0x25, 
+0x78, 0x2b, 0x00, 0x00, 0x8b, 0x40, 0x10, 0x41, 
+0x8b, 0x14, 0x24, 0x85, 0xd2, 0x7e, 0x32, 0x45, 
+0x31, 0xc9, 0x45, 0x31, 0xc0, 0x31, 0xc9, 0x31, 
+0xf6, 0x4c, 0x89, 0xe7, 0xe8, 0x93, 0x1c, 0x00, 
+0x00, 0x85, 0xc0, 0x79, 0xe2, 0x83, 0xf8, 0xf5, 
+0x74, 0xdd, 0x41, 0xb9, 0x5c, 0x00, 0x00, 0x00, 
+0x4c, 0x8d, 0x05, 0xf4, 0x1d, 0x00, 0x00, 0xb9, 
+0x5c, 0x00, 0x00, 0x00, 0xe9, 0x31, 0xf1, 0xff, 
+0xff, 0x48, 0x8d, 0x75, 0x90, 0xb9, 0x08, 0x00, 
+0x00, 0x00, 0x31, 0xd2, 0xbf, 0x02, 0x00, 0x00, 
+0x00, 0x48, 0xc7, 0x45, 0x90, 0xff, 0xff, 0xff, 
+0xff, 0xe8, 0xe6, 0x19, 0x00, 0x00, 0x49, 0x89, 
+0xc0, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x7e, 0x02, 
+0x00, 0x00, 0x31, 0xd2, 0xbf, 0x11, 0x00, 0x00, 
+0x00, 0xb9, 0x08, 0x00, 0x00, 0x00, 0x48, 0x8d, 
+0xb3, 0x80, 0x00, 0x00, 0x00, 0xe8, 0xba, 0x19, 
+0x00, 0x00, 0x8b, 0x73, 0x68, 0x48, 0x8b, 0x7b, 
+0x60, 0xba, 0x01, 0x00, 0x00, 0x00, 0xe8, 0xed, 
+0xe2, 0xff, 0xff, 0x85, 0xc0, 0x0f, 0x85, 0x26, 
+0xee, 0xff, 0xff, 0x48, 0x8b, 0x03, 0x31, 0xd2, 
+0x8b, 0xb0, 0xf8, 0x8b, 0x00, 0x00, 0x48, 0x8b, 
+0xb8, 0xf0, 0x8b, 0x00, 0x00, 0xe8, 0xce, 0xe2, 
+0xff, 0xff, 0x85, 0xc0, 0x0f, 0x85, 0x07, 0xee, 
+0xff, 0xff, 0x48, 0x8b, 0x05, 0xc7, 0x2a, 0x00, 
+0x00, 0x48, 0x8d, 0x78, 0x0c, 0xe8, 0x06, 0xe6, 
+0xff, 0xff, 0x48, 0x8b, 0x05, 0xb7, 0x2a, 0x00, 
+0x00, 0xbe, 0x03, 0x00, 0x00, 0x00, 0x48, 0x8d, 
+0x78, 0x10, 0xe8, 0xa1, 0xe3, 0xff, 0xff, 0x48, 
+0x8b, 0x05, 0xa2, 0x2a, 0x00, 0x00, 0x83, 0xbb, 
+0xf0, 0x03, 0x00, 0x00, 0x00, 0x8b, 0x40, 0x10, 
+0x0f, 0x8e, 0x4b, 0x01, 0x00, 0x00, 0x48, 0x8d, 
+0x85, 0x48, 0xff, 0xff, 0xff, 0x45, 0x31, 0xe4, 
+0x4c, 0x8d, 0xbd, 0x50, 0xff, 0xff, 0xff, 0x48, 
+0x89, 0x85, 0x30, 0xff, 0xff, 0xff, 0x4c, 0x8d, 
+0x35, 0xcb, 0x26, 0x00, 0x00, 0x4c, 0x8d, 0x2d, 
+0x16, 0x1e, 0x00, 0x00, 0xeb, 0x41, 0x41, 0xb8, 
+0x04, 0x00, 0x00, 0x00, 0xba, 0x02, 0x00, 0x00, 
+0x00, 0xbe, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8b, 
+0x85, 0x38, 0xff, 0xff, 0xff, 0x48, 0x8b, 0x8d, 
+0x30, 0xff, 0xff, 0xff, 0x8b, 0x38, 0xe8, 0xf1, 
+0x19, 0x00, 0x00, 0x49, 0x89, 0xc0, 0x85, 0xc0, 
+0x0f, 0x88, 0x39, 0x02, 0x00, 0x00, 0x49, 0x83, 
+0xc4, 0x01, 0x44, 0x39, 0xa3, 0xf0, 0x03, 0x00, 
+0x00, 0x0f, 0x8e, 0xe2, 0x00, 0x00, 0x00, 0x48, 
+0x8b, 0x83, 0xe8, 0x03, 0x00, 0x00, 0x4c, 0x89, 
+0xf6, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x4a, 0x8d, 
+0x04, 0xe0, 0x0f, 0xb6, 0x48, 0x04, 0x48, 0x89, 
+0x85, 0x38, 0xff, 0xff, 0xff, 0x89, 0x8d, 0x48, 
+0xff, 0xff, 0xff, 0x8b, 0x10, 0x31, 0xc0, 0xe8, 
+0xf4, 0x0c, 0x00, 0x00, 0x48, 0x8b, 0x85, 0x38, 
+0xff, 0xff, 0xff, 0x41, 0xb8, 0x04, 0x00, 0x00, 
+0x00, 0x4c, 0x89, 0xf9, 0xba, 0x13, 0x00, 0x00, 
+0x00, 0xbe, 0x06, 0x00, 0x00, 0x00, 0x8b, 0x38, 
+0xc7, 0x85, 0x50, 0xff, 0xff, 0xff, 0x00, 0x00, 
+0x00, 0x00, 0xe8, 0x7d, 0x19, 0x00, 0x00, 0x49, 
+0x89, 0xc0, 0x85, 0xc0, 0x0f, 0x89, 0x5c, 0xff, 
+0xff, 0xff, 0xb9, 0x44, 0x00, 0x00, 0x00, 0x4c, 
+0x89, 0xea, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x31, 
+0xc0, 0x48, 0x8d, 0x35, 0x38, 0x26, 0x00, 0x00, 
+0xe8, 0xa3, 0x0c, 0x00, 0x00, 0xe9, 0x3c, 0xff, 
+0xff, 0xff, 0x4c, 0x8b, 0x85, 0x50, 0xff, 0xff, 
+0xff, 0x4c, 0x8d, 0x25, 0x10, 0x1c, 0x00, 0x00, 
+0x31, 0xc0, 0xb9, 0xf1, 0x01, 0x00, 0x00, 0x4c, 
+0x89, 0xe2, 0x48, 0x8d, 0x35, 0xff, 0x24, 0x00, 
+0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x75, 
+0x0c, 0x00, 0x00, 0x4d, 0x63, 0xc5, 0xe9, 0x3b, 
+0xf8, 0xff, 0xff, 0x4c, 0x8d, 0x25, 0xe6, 0x1b, 
+0x00, 0x00, 0xb9, 0xf6, 0x01, 0x00, 0x00, 0x48, 
+0x8d, 0x35, 0x12, 0x25, 0x00, 0x00, 0x31, 0xc0, 
+0x4c, 0x89, 0xe2, 0xbf, 0x01, 0x00, 0x00, 0x00, 
+0xe8, 0x4b, 0x0c, 0x00, 0x00, 0x49, 0xc7, 0xc0, 
+0xff, 0xff, 0xff, 0xff, 0xe9, 0x0d, 0xf8, 0xff, 
+0xff, 0x48, 0x8d, 0xbb, 0x28, 0x01, 0x00, 0x00, 
+0x4c, 0x8d, 0x2d, 0x31, 0x29, 0x00, 0x00, 0xe8, 
+0x4c, 0xde, 0xff, 0xff, 0x45, 0x31, 0xc9, 0x45, 
+0x31, 0xc0, 0x31, 0xc9, 0x41, 0x89, 0xc4, 0x8b, 
+0x43, 0x14, 0xba, 0xff, 0xff, 0xff, 0x7f, 0xbe, 
+0x01, 0x00, 0x00, 0x00, 0x4c, 0x89, 0xef, 0x89, 
+0x05, 0x0b, 0x29, 0x00, 0x00, 0xe8, 0x3a, 0x1a, 
+0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x88, 0xdd, 
+0xee, 0xff, 0xff, 0x48, 0x8b, 0x05, 0xfe, 0x28, 
+0x00, 0x00, 0x48, 0x8d, 0x78, 0x0c, 0xe8, 0x3d, 
+0xe4, 0xff, 0xff, 0x48, 0x8b, 0x05, 0xee, 0x28, 
+0x00, 0x00, 0xbe, 0x04, 0x00, 0x00, 0x00, 0x48, 
+0x8d, 0x78, 0x10, 0xe8, 0xd8, 0xe1, 0xff, 0xff, 
+0x48, 0x8b, 0x05, 0xd9, 0x28, 0x00, 0x00, 0x8b, 
+0x40, 0x10, 0x45, 0x85, 0xe4, 0x0f, 0x85, 0xdf, 
+0x01, 0x00, 0x00, 0x41, 0x8b, 0x55, 0x00, 0x83, 
+0xfa, 0x01, 0x0f, 0x8e, 0xe3, 0x00, 0x00, 0x00, 
+0x45, 0x31, 0xc9, 0x45, 0x31, 0xc0, 0x31, 0xc9, 
+0x31, 0xf6, 0x4c, 0x89, 0xef, 0xe8, 0xda, 0x19, 
+0x00, 0x00, 0x85, 0xc0, 0x79, 0xdd, 0x83, 0xf8, 
+0xf5, 0x74, 0xd8, 0xe9, 0x42, 0xfd, 0xff, 0xff, 
+0xb9, 0xb7, 0x03, 0x00, 0x00, 0x48, 0x8d, 0x15, 
+0x0c, 0x1b, 0x00, 0x00, 0x48, 0x8d, 0x35, 0xb5, 
+0x24, 0x00, 0x00, 0x31, 0xc0, 0xbf, 0x01, 0x00, 
+0x00, 0x00, 0xe8, 0x79, 0x0b, 0x00, 0x00, 0xe9, 
+0xb5, 0xeb, 0xff, 0xff, 0x49, 0x89, 0xc0, 0x4d, 
+0x89, 0xe1, 0xb9, 0x8c, 0x03, 0x00, 0x00, 0xbf, 
+0x01, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x15, 0xdd, 
+0x1a, 0x00, 0x00, 0x48, 0x8d, 0x35, 0x46, 0x23, 
+0x00, 0x00, 0x31, 0xc0, 0xe8, 0x4f, 0x0b, 0x00, 
+0x00, 0xe9, 0x8b, 0xeb, 0xff, 0xff, 0x45, 0x89, 
+0xf0, 0xb9, 0x7d, 0x03, 0x00, 0x00, 0xbf, 0x01, 
+0x00, 0x00, 0x00, 0x31, 0xc0, 0x48, 0x8d, 0x15, 
+0xb4, 0x1a, 0x00, 0x00, 0x48, 0x8d, 0x35, 0xf5, 
+0x22, 0x00, 0x00, 0xe8, 0x28, 0x0b, 0x00, 0x00, 
+0xe9, 0x64, 0xeb, 0xff, 0xff, 0x4c, 0x8d, 0x25, 
+0x9c, 0x1a, 0x00, 0x00, 0x4c, 0x8d, 0x15, 0x7d, 
+0x22, 0x00, 0x00, 0xe9, 0x0d, 0xf8, 0xff, 0xff, 
+0x41, 0xb9, 0x46, 0x00, 0x00, 0x00, 0x4c, 0x8d, 
+0x05, 0xae, 0x1a, 0x00, 0x00, 0xb9, 0x46, 0x00, 
+0x00, 0x00, 0xe9, 0xeb, 0xed, 0xff, 0xff, 0xb9, 
+0x83, 0x01, 0x00, 0x00, 0x48, 0x8d, 0x15, 0x6d, 
+0x1a, 0x00, 0x00, 0x48, 0x8d, 0x35, 0xbe, 0x24, 
+0x00, 0x00, 0x31, 0xc0, 0xbf, 0x01, 0x00, 0x00, 
+0x00, 0xe8, 0xda, 0x0a, 0x00, 0x00, 0xe9, 0xa3, 
+0xfd, 0xff, 0xff, 0x83, 0xcf, 0xff, 0xe8, 0x0d, 
+0x0a, 0x00, 0x00, 0x48, 0x83, 0xbb, 0xb8, 0x00, 
+0x00, 0x00, 0x00, 0x75, 0x0a, 0x48, 0x83, 0xbb, 
+0xc0, 0x00, 0x00, 0x00, 0x00, 0x74, 0x10, 0x48, 
+0x8d, 0xb3, 0xb8, 0x00, 0x00, 0x00, 0x31, 0xd2, 
+0x31, 0xff, 0xe8, 0xe5, 0x16, 0x00, 0x00, 0x48, 
+0x83, 0xbb, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x75, 
+0x0a, 0x48, 0x83, 0xbb, 0xe0, 0x00, 0x00, 0x00, 
+0x00, 0x74, 0x13, 0x48, 0x8d, 0xb3, 0xd8, 0x00, 
+0x00, 0x00, 0x31, 0xd2, 0xbf, 0x01, 0x00, 0x00, 
+0x00, 0xe8, 0xbe, 0x16, 0x00, 0x00, 0x48, 0x83, 
+0xbb, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x75, 0x0a, 
+0x48, 0x83, 0xbb, 0x00, 0x01, 0x00, 0x00, 0x00, 
+0x74, 0x13, 0x48, 0x8d, 0xb3, 0xf8, 0x00, 0x00, 
+0x00, 0x31, 0xd2, 0xbf, 0x02, 0x00, 0x00, 0x00, 
+0xe8, 0x97, 0x16, 0x00, 0x00, 0x45, 0x31, 0xe4, 
+0x83, 0xbb, 0x18, 0x01, 0x00, 0x00, 0x00, 0x7e, 
+0x2c, 0x48, 0x8b, 0x83, 0x20, 0x01, 0x00, 0x00, 
+0x4b, 0x8d, 0x14, 0xe4, 0x31, 0xc9, 0x31, 0xf6, 
+0x49, 0x83, 0xc4, 0x01, 0x48, 0x8d, 0x04, 0xd0, 
+0x48, 0x8b, 0x38, 0x48, 0x8d, 0x50, 0x20, 0xe8, 
+0xa8, 0x18, 0x00, 0x00, 0x44, 0x39, 0xa3, 0x18, 
+0x01, 0x00, 0x00, 0x7f, 0xd4, 0x48, 0x8b, 0x7b, 
+0x40, 0xbe, 0x00, 0x10, 0x00, 0x00, 0xe8, 0xc1, 
+0x15, 0x00, 0x00, 0x48, 0x8b, 0x73, 0x50, 0x48, 
+0x8b, 0x7b, 0x48, 0xe8, 0xb4, 0x15, 0x00, 0x00, 
+0x48, 0x8b, 0x85, 0x28, 0xff, 0xff, 0xff, 0x48, 
+0x05, 0x88, 0x80, 0x00, 0x00, 0x48, 0x89, 0xc3, 
+0x48, 0x89, 0xd8, 0x48, 0x89, 0xc4, 0xb8, 0x0f, 
+0x00, 0x00, 0x00, 0x0f, 0x05, 0xe9, 0x27, 0xea, 
+0xff, 0xff, 0x41, 0xb9, 0xd6, 0x03, 0x00, 0x00, 
+0x4c, 0x8d, 0x05, 0x59, 0x19, 0x00, 0x00, 0xb9, 
+0xd6, 0x03, 0x00, 0x00, 0xe9, 0xc1, 0xec, 0xff, 
+0xff, 0xb9, 0x9c, 0x03, 0x00, 0x00, 0x48, 0x8d, 
+0x15, 0x43, 0x19, 0x00, 0x00, 0x48, 0x8d, 0x35, 
+0xdc, 0x21, 0x00, 0x00, 0x31, 0xc0, 0xbf, 0x01, 
+0x00, 0x00, 0x00, 0xe8, 0xb0, 0x09, 0x00, 0x00, 
+0xe9, 0xec, 0xe9, 0xff, 0xff, 0x41, 0x89, 0xc0, 
+0xb9, 0x21, 0x02, 0x00, 0x00, 0x31, 0xc0, 0xbf, 
+0x01, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x15, 0x15, 
+0x19, 0x00, 0x00, 0x48, 0x8d, 0x35, 0x0e, 0x20, 
+0x00, 0x00, 0xe8, 0x89, 0x09, 0x00, 0x00, 0x8b, 
+0xbb, 0xf8, 0x03, 0x00, 0x00, 0xe8, 0x0a, 0x15, 
+0x00, 0x00, 0xe9, 0xba, 0xe9, 0xff, 0xff, 0x66, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x53, 0x48, 0x8b, 0xb7, 0xc0, 0x00, 0x00, 0x00, 
+0x48, 0x89, 0xfb, 0xbf, 0x02, 0x10, 0x00, 0x00, 
+0xe8, 0x53, 0x17, 0x00, 0x00, 0x48, 0x85, 0xc0, 
+0x75, 0x1e, 0x48, 0x8b, 0xb3, 0xc8, 0x00, 0x00, 
+0x00, 0xbf, 0x01, 0x10, 0x00, 0x00, 0xe8, 0x3d, 
+0x17, 0x00, 0x00, 0x48, 0x85, 0xc0, 0x75, 0x25, 
+0x31, 0xc0, 0x5b, 0xc3, 0x0f, 0x1f, 0x40, 0x00, 
+0x48, 0x89, 0xc2, 0x48, 0x8d, 0x35, 0xf2, 0x19, 
+0x00, 0x00, 0xbf, 0x03, 0x00, 0x00, 0x00, 0x31, 
+0xc0, 0xe8, 0x22, 0x09, 0x00, 0x00, 0xb8, 0xff, 
+0xff, 0xff, 0xff, 0x5b, 0xc3, 0x48, 0x89, 0xc2, 
+0x48, 0x8d, 0x35, 0xe6, 0x19, 0x00, 0x00, 0xbf, 
+0x03, 0x00, 0x00, 0x00, 0x31, 0xc0, 0xe8, 0x05, 
+0x09, 0x00, 0x00, 0xeb, 0xe1, 0x0f, 0x1f, 0x00, 
+0x48, 0xb8, 0x00, 0x00, 0xff, 0xe0, 0xcc, 0xcc, 
+0xcc, 0xcc, 0x41, 0x57, 0x45, 0x31, 0xff, 0x41, 
+0x56, 0x49, 0x89, 0xfe, 0x41, 0x55, 0x4c, 0x8d, 
+0x2d, 0x2b, 0x23, 0x00, 0x00, 0x41, 0x54, 0x49, 
+0x89, 0xf4, 0x55, 0x48, 0x8d, 0x6a, 0x30, 0x53, 
+0x48, 0x8d, 0x59, 0x30, 0x48, 0x83, 0xec, 0x18, 
+0x48, 0xc7, 0x04, 0x24, 0x48, 0xb8, 0x00, 0x00, 
+0x48, 0x89, 0x44, 0x24, 0x08, 0x48, 0x8b, 0x0b, 
+0x48, 0x83, 0xf9, 0xff, 0x74, 0x72, 0x48, 0x83, 
+0xec, 0x08, 0x4c, 0x89, 0xee, 0x31, 0xc0, 0x4d, 
+0x89, 0xf0, 0x41, 0x57, 0x4c, 0x8b, 0x4d, 0x00, 
+0x4c, 0x89, 0xe2, 0xbf, 0x04, 0x00, 0x00, 0x00, 
+0xe8, 0x9b, 0x08, 0x00, 0x00, 0x48, 0x8b, 0x45, 
+0x00, 0x48, 0x8b, 0x3b, 0x48, 0x8d, 0x74, 0x24, 
+0x10, 0xb9, 0x04, 0x00, 0x00, 0x00, 0x4c, 0x01, 
+0xf0, 0x4c, 0x01, 0xe7, 0x48, 0x89, 0x44, 0x24, 
+0x12, 0xf3, 0xa5, 0xb9, 0x10, 0x00, 0x00, 0x00, 
+0x83, 0xe1, 0x03, 0x74, 0x02, 0xf3, 0xa4, 0x58, 
+0x5a, 0x41, 0x83, 0xc7, 0x01, 0x48, 0x83, 0xc5, 
+0x28, 0x48, 0x83, 0xc3, 0x28, 0x41, 0x83, 0xff, 
+0x04, 0x75, 0x9a, 0x48, 0x83, 0xc4, 0x18, 0x31, 
+0xc0, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 
+0x5e, 0x41, 0x5f, 0xc3, 0x0f, 0x1f, 0x40, 0x00, 
+0x80, 0x7b, 0xe0, 0x00, 0x74, 0xd3, 0xeb, 0x86, 
+0x48, 0xb8, 0x7f, 0x45, 0x4c, 0x46, 0x02, 0x01, 
+0x01, 0x00, 0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 
+0x41, 0x54, 0x55, 0x48, 0x89, 0xd5, 0x31, 0xd2, 
+0x53, 0x48, 0x89, 0xfb, 0x48, 0x8d, 0x3d, 0x19, 
+0x19, 0x00, 0x00, 0x66, 0x48, 0x0f, 0x6e, 0xc7, 
+0x48, 0x8d, 0x3d, 0x2f, 0x19, 0x00, 0x00, 0x4c, 
+0x8d, 0x24, 0x33, 0x4c, 0x89, 0xe1, 0x48, 0x8d, 
+0x35, 0x42, 0x19, 0x00, 0x00, 0x48, 0x83, 0xec, 
+0x38, 0x48, 0x89, 0x04, 0x24, 0x48, 0x8d, 0x05, 
+0x04, 0x19, 0x00, 0x00, 0x4c, 0x8d, 0x6c, 0x24, 
+0x10, 0x66, 0x48, 0x0f, 0x6e, 0xc8, 0x48, 0x8d, 
+0x05, 0x16, 0x19, 0x00, 0x00, 0x48, 0x89, 0x54, 
+0x24, 0x08, 0x48, 0x89, 0xda, 0x66, 0x0f, 0x6c, 
+0xc1, 0x66, 0x48, 0x0f, 0x6e, 0xd0, 0x31, 0xc0, 
+0x0f, 0x29, 0x44, 0x24, 0x10, 0x66, 0x48, 0x0f, 
+0x6e, 0xc7, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x66, 
+0x0f, 0x6c, 0xc2, 0x0f, 0x29, 0x44, 0x24, 0x20, 
+0xe8, 0xb3, 0x07, 0x00, 0x00, 0x48, 0x89, 0xda, 
+0x48, 0x89, 0xe0, 0xeb, 0x10, 0x0f, 0x1f, 0x00, 
+0x48, 0x83, 0xc0, 0x01, 0x48, 0x83, 0xc2, 0x01, 
+0x4c, 0x39, 0xe8, 0x74, 0x2b, 0x0f, 0xb6, 0x3a, 
+0x40, 0x38, 0x38, 0x74, 0xeb, 0x48, 0x8d, 0x35, 
+0x64, 0x22, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 
+0x00, 0x31, 0xc0, 0xe8, 0x80, 0x07, 0x00, 0x00, 
+0xb8, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x27, 0x03, 
+0x00, 0x00, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x8b, 0x43, 0x20, 0x0f, 0xb7, 0x53, 0x38, 
+0x48, 0x01, 0xd8, 0x66, 0x85, 0xd2, 0x0f, 0x84, 
+0x44, 0x03, 0x00, 0x00, 0x49, 0x39, 0xc4, 0x72, 
+0xd7, 0x48, 0x39, 0xd8, 0x72, 0xd2, 0x48, 0x8d, 
+0x0c, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x48, 0x29, 
+0xd1, 0x48, 0x8d, 0x14, 0xc8, 0xeb, 0x18, 0x90, 
+0x48, 0x83, 0xc0, 0x38, 0x48, 0x39, 0xc2, 0x0f, 
+0x84, 0x1b, 0x03, 0x00, 0x00, 0x49, 0x39, 0xc4, 
+0x72, 0xae, 0x48, 0x39, 0xd8, 0x72, 0xa9, 0x83, 
+0x38, 0x01, 0x75, 0xe4, 0x4c, 0x8b, 0x70, 0x10, 
+0x49, 0x83, 0xfe, 0xff, 0x0f, 0x84, 0xfe, 0x02, 
+0x00, 0x00, 0x31, 0xc0, 0x4c, 0x89, 0xf2, 0xbf, 
+0x04, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x35, 0x5e, 
+0x18, 0x00, 0x00, 0xe8, 0x00, 0x07, 0x00, 0x00, 
+0x0f, 0xb7, 0x43, 0x3e, 0x66, 0x85, 0xc0, 0x0f, 
+0x84, 0xb3, 0x02, 0x00, 0x00, 0x48, 0x8b, 0x53, 
+0x28, 0x48, 0xc1, 0xe0, 0x06, 0x48, 0x01, 0xda, 
+0x48, 0x01, 0xd0, 0x49, 0x39, 0xc4, 0x0f, 0x82, 
+0x5c, 0xff, 0xff, 0xff, 0x48, 0x39, 0xd8, 0x0f, 
+0x82, 0x53, 0xff, 0xff, 0xff, 0x4c, 0x8b, 0x40, 
+0x18, 0x0f, 0xb7, 0x43, 0x3c, 0x66, 0x85, 0xc0, 
+0x0f, 0x84, 0xc2, 0x02, 0x00, 0x00, 0x49, 0x39, 
+0xd4, 0x0f, 0x82, 0x39, 0xff, 0xff, 0xff, 0x48, 
+0x39, 0xda, 0x0f, 0x82, 0x30, 0xff, 0xff, 0xff, 
+0x48, 0xc1, 0xe0, 0x06, 0x45, 0x31, 0xd2, 0x45, 
+0x31, 0xdb, 0x45, 0x31, 0xc9, 0x48, 0x8d, 0x3c, 
+0x02, 0xeb, 0x32, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x83, 0xf9, 0x03, 0x0f, 0x84, 0x9f, 0x01, 0x00, 
+0x00, 0x83, 0xf9, 0x01, 0x0f, 0x84, 0xce, 0x01, 
+0x00, 0x00, 0x48, 0x83, 0xc2, 0x40, 0x48, 0x39, 
+0xd7, 0x74, 0x65, 0x49, 0x39, 0xd4, 0x0f, 0x82, 
+0xf4, 0xfe, 0xff, 0xff, 0x48, 0x39, 0xda, 0x0f, 
+0x82, 0xeb, 0xfe, 0xff, 0xff, 0x8b, 0x02, 0x4c, 
+0x01, 0xc0, 0x48, 0x01, 0xd8, 0x49, 0x39, 0xc4, 
+0x0f, 0x82, 0xda, 0xfe, 0xff, 0xff, 0x48, 0x39, 
+0xd8, 0x0f, 0x82, 0xd1, 0xfe, 0xff, 0xff, 0x8b, 
+0x4a, 0x04, 0x83, 0xf9, 0x0b, 0x75, 0xb1, 0x48, 
+0x8d, 0x0d, 0x28, 0x17, 0x00, 0x00, 0x66, 0x90, 
+0x48, 0x83, 0xc1, 0x01, 0x48, 0x83, 0xc0, 0x01, 
+0x0f, 0xb6, 0x70, 0xff, 0x40, 0x3a, 0x71, 0xff, 
+0x75, 0xa8, 0x40, 0x84, 0xf6, 0x75, 0xe9, 0x49, 
+0x89, 0xd1, 0x48, 0x83, 0xc2, 0x40, 0x48, 0x39, 
+0xd7, 0x75, 0xa0, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x4d, 0x85, 0xc9, 0x0f, 0x94, 0xc0, 0x4d, 0x85, 
+0xdb, 0x0f, 0x94, 0xc2, 0x08, 0xd0, 0x0f, 0x85, 
+0x04, 0x02, 0x00, 0x00, 0x4d, 0x85, 0xd2, 0x0f, 
+0x84, 0xfb, 0x01, 0x00, 0x00, 0x4d, 0x8b, 0x43, 
+0x18, 0x49, 0x01, 0xd8, 0x4d, 0x39, 0xc4, 0x0f, 
+0x82, 0x6b, 0xfe, 0xff, 0xff, 0x49, 0x39, 0xd8, 
+0x0f, 0x82, 0x62, 0xfe, 0xff, 0xff, 0x4d, 0x39, 
+0xcc, 0x0f, 0x82, 0x59, 0xfe, 0xff, 0xff, 0x49, 
+0x39, 0xd9, 0x0f, 0x82, 0x50, 0xfe, 0xff, 0xff, 
+0x4d, 0x39, 0xd4, 0x0f, 0x82, 0x47, 0xfe, 0xff, 
+0xff, 0x49, 0x39, 0xda, 0x0f, 0x82, 0x3e, 0xfe, 
+0xff, 0xff, 0x48, 0xba, 0xab, 0xaa, 0xaa, 0xaa, 
+0xaa, 0xaa, 0xaa, 0xaa, 0x48, 0x89, 0xd0, 0x49, 
+0xf7, 0x61, 0x20, 0x49, 0x8b, 0x41, 0x18, 0x48, 
+0x01, 0xd8, 0x48, 0xc1, 0xea, 0x04, 0x49, 0x89, 
+0xc1, 0x85, 0xd2, 0x0f, 0x84, 0x46, 0x01, 0x00, 
+0x00, 0x48, 0x39, 0xd8, 0x0f, 0x82, 0x0e, 0xfe, 
+0xff, 0xff, 0x49, 0x39, 0xc4, 0x0f, 0x82, 0x05, 
+0xfe, 0xff, 0xff, 0x89, 0xd2, 0x41, 0xbb, 0x08, 
+0x00, 0x00, 0x00, 0x48, 0x8d, 0x04, 0x52, 0x4d, 
+0x8d, 0x14, 0xc1, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x41, 0x0f, 0xb6, 0x41, 0x04, 0x89, 0xc2, 0xc0, 
+0xea, 0x04, 0x80, 0xfa, 0x01, 0x75, 0x51, 0x83, 
+0xe0, 0x0f, 0x3c, 0x02, 0x75, 0x4a, 0x41, 0x8b, 
+0x09, 0x4c, 0x01, 0xc1, 0x49, 0x39, 0xcc, 0x0f, 
+0x82, 0xcb, 0xfd, 0xff, 0xff, 0x48, 0x39, 0xd9, 
+0x0f, 0x82, 0xc2, 0xfd, 0xff, 0xff, 0x45, 0x31, 
+0xff, 0x4b, 0x8b, 0x74, 0xfd, 0x00, 0x31, 0xc0, 
+0xeb, 0x12, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x83, 0xc0, 0x01, 0x84, 0xd2, 0x0f, 0x84, 
+0x9c, 0x00, 0x00, 0x00, 0x0f, 0xb6, 0x14, 0x01, 
+0x3a, 0x14, 0x06, 0x74, 0xeb, 0x49, 0x83, 0xc7, 
+0x01, 0x49, 0x83, 0xff, 0x04, 0x75, 0xd2, 0x90, 
+0x49, 0x83, 0xc1, 0x18, 0x4d, 0x39, 0xca, 0x0f, 
+0x84, 0xb2, 0x00, 0x00, 0x00, 0x4d, 0x39, 0xcc, 
+0x0f, 0x82, 0x7a, 0xfd, 0xff, 0xff, 0x49, 0x39, 
+0xd9, 0x73, 0x85, 0xe9, 0x70, 0xfd, 0xff, 0xff, 
+0x48, 0x8d, 0x0d, 0xd7, 0x15, 0x00, 0x00, 0x66, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x48, 0x83, 0xc1, 0x01, 0x48, 0x83, 0xc0, 0x01, 
+0x0f, 0xb6, 0x70, 0xff, 0x40, 0x3a, 0x71, 0xff, 
+0x0f, 0x85, 0x44, 0xfe, 0xff, 0xff, 0x40, 0x84, 
+0xf6, 0x75, 0xe5, 0x49, 0x89, 0xd3, 0xe9, 0x37, 
+0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x8d, 0x0d, 0xa7, 0x15, 0x00, 0x00, 0x90, 
+0x48, 0x83, 0xc1, 0x01, 0x48, 0x83, 0xc0, 0x01, 
+0x0f, 0xb6, 0x70, 0xff, 0x40, 0x3a, 0x71, 0xff, 
+0x0f, 0x85, 0x14, 0xfe, 0xff, 0xff, 0x40, 0x84, 
+0xf6, 0x75, 0xe5, 0x49, 0x89, 0xd2, 0xe9, 0x07, 
+0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x4b, 0x8d, 0x04, 0xbf, 0x45, 0x89, 0xff, 0x44, 
+0x89, 0xd9, 0x4a, 0x8b, 0x74, 0xfc, 0x10, 0x48, 
+0x8d, 0x7c, 0xc5, 0x10, 0xf3, 0xa5, 0xb9, 0x20, 
+0x00, 0x00, 0x00, 0x83, 0xe1, 0x03, 0x74, 0x02, 
+0xf3, 0xa4, 0x49, 0x8b, 0x41, 0x08, 0x4b, 0x8d, 
+0x14, 0xbf, 0x4c, 0x29, 0xf0, 0x48, 0x89, 0x44, 
+0xd5, 0x30, 0xe9, 0x41, 0xff, 0xff, 0xff, 0x31, 
+0xc0, 0x48, 0x83, 0xc4, 0x38, 0x5b, 0x5d, 0x41, 
+0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 
+0xb9, 0x92, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x15, 
+0xc2, 0x15, 0x00, 0x00, 0x48, 0x8d, 0x35, 0xa5, 
+0x1e, 0x00, 0x00, 0x31, 0xc0, 0xbf, 0x01, 0x00, 
+0x00, 0x00, 0xe8, 0x21, 0x04, 0x00, 0x00, 0xe9, 
+0x9c, 0xfc, 0xff, 0xff, 0x0f, 0x1f, 0x40, 0x00, 
+0x48, 0x8d, 0x35, 0x82, 0x15, 0x00, 0x00, 0xbf, 
+0x04, 0x00, 0x00, 0x00, 0x31, 0xc0, 0xe8, 0x05, 
+0x04, 0x00, 0x00, 0xe9, 0x80, 0xfc, 0xff, 0xff, 
+0x48, 0x8d, 0x35, 0xa9, 0x1e, 0x00, 0x00, 0xbf, 
+0x04, 0x00, 0x00, 0x00, 0x31, 0xc0, 0xe8, 0xed, 
+0x03, 0x00, 0x00, 0xe9, 0x68, 0xfc, 0xff, 0xff, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x41, 0x54, 0x49, 0x89, 0xd0, 0x49, 0x89, 0xcc, 
+0x31, 0xc0, 0x55, 0x48, 0x89, 0xf1, 0x48, 0x89, 
+0xf5, 0x48, 0x8d, 0x35, 0x6a, 0x15, 0x00, 0x00, 
+0x53, 0x48, 0x89, 0xd3, 0x48, 0x89, 0xfa, 0xbf, 
+0x04, 0x00, 0x00, 0x00, 0xe8, 0xb7, 0x03, 0x00, 
+0x00, 0x49, 0x89, 0xd8, 0xb9, 0x03, 0x00, 0x00, 
+0x00, 0x4c, 0x89, 0xe2, 0x4c, 0x89, 0xe6, 0x48, 
+0x89, 0xef, 0xe8, 0x89, 0x0f, 0x00, 0x00, 0x48, 
+0x39, 0xc3, 0x75, 0x07, 0x31, 0xc0, 0x5b, 0x5d, 
+0x41, 0x5c, 0xc3, 0x48, 0x83, 0xec, 0x08, 0x49, 
+0x89, 0xd9, 0x49, 0x89, 0xe8, 0xb9, 0xee, 0x00, 
+0x00, 0x00, 0x50, 0x48, 0x8d, 0x15, 0x0c, 0x15, 
+0x00, 0x00, 0x31, 0xc0, 0x48, 0x8d, 0x35, 0x75, 
+0x1e, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 
+0xe8, 0x6b, 0x03, 0x00, 0x00, 0x58, 0xb8, 0xff, 
+0xff, 0xff, 0xff, 0x5a, 0xeb, 0xc8, 0x66, 0x90, 
+0x41, 0x57, 0x66, 0x0f, 0xef, 0xd2, 0x66, 0x0f, 
+0x76, 0xc0, 0x41, 0x56, 0x49, 0x89, 0xfe, 0x41, 
+0x55, 0x41, 0x54, 0x49, 0x89, 0xd4, 0x55, 0x48, 
+0x89, 0xcd, 0x53, 0x48, 0x89, 0xf3, 0x48, 0x81, 
+0xec, 0xe8, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x7a, 
+0x18, 0x4c, 0x8b, 0x6a, 0x20, 0x4c, 0x8d, 0x7c, 
+0x24, 0x30, 0x0f, 0x29, 0x14, 0x24, 0x49, 0x29, 
+0xfd, 0x4c, 0x89, 0xfa, 0x48, 0xc7, 0x44, 0x24, 
+0x20, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x89, 0xee, 
+0x48, 0xc7, 0x44, 0x24, 0x60, 0xff, 0xff, 0xff, 
+0xff, 0x48, 0xc7, 0x84, 0x24, 0x88, 0x00, 0x00, 
+0x00, 0xff, 0xff, 0xff, 0xff, 0x48, 0xc7, 0x84, 
+0x24, 0xb0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 
+0xff, 0x48, 0xc7, 0x84, 0x24, 0xd8, 0x00, 0x00, 
+0x00, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x29, 0x44, 
+0x24, 0x30, 0x0f, 0x29, 0x54, 0x24, 0x10, 0x0f, 
+0x29, 0x54, 0x24, 0x40, 0x0f, 0x29, 0x54, 0x24, 
+0x50, 0x0f, 0x11, 0x54, 0x24, 0x68, 0x0f, 0x11, 
+0x54, 0x24, 0x78, 0x0f, 0x29, 0x94, 0x24, 0x90, 
+0x00, 0x00, 0x00, 0x0f, 0x29, 0x94, 0x24, 0xa0, 
+0x00, 0x00, 0x00, 0x0f, 0x11, 0x94, 0x24, 0xb8, 
+0x00, 0x00, 0x00, 0x0f, 0x11, 0x94, 0x24, 0xc8, 
+0x00, 0x00, 0x00, 0xe8, 0x68, 0xfa, 0xff, 0xff, 
+0x85, 0xc0, 0x0f, 0x85, 0x10, 0x01, 0x00, 0x00, 
+0x48, 0x8b, 0x43, 0x08, 0x48, 0x2b, 0x03, 0x49, 
+0x39, 0xc5, 0x75, 0x64, 0xb8, 0x30, 0x00, 0x00, 
+0x00, 0x48, 0x8b, 0x0c, 0x03, 0x49, 0x39, 0x0c, 
+0x07, 0x75, 0x55, 0x48, 0x83, 0xc0, 0x28, 0x48, 
+0x3d, 0xd0, 0x00, 0x00, 0x00, 0x75, 0xea, 0x48, 
+0x8d, 0x35, 0x4a, 0x1e, 0x00, 0x00, 0xbf, 0x03, 
+0x00, 0x00, 0x00, 0x31, 0xc0, 0xe8, 0x66, 0x02, 
+0x00, 0x00, 0x49, 0x8b, 0x7c, 0x24, 0x18, 0x4c, 
+0x89, 0xee, 0xe8, 0x05, 0x0e, 0x00, 0x00, 0x48, 
+0x85, 0xc0, 0x0f, 0x85, 0xc8, 0x00, 0x00, 0x00, 
+0x49, 0x8b, 0x54, 0x24, 0x18, 0x4c, 0x89, 0xe9, 
+0x48, 0x89, 0xee, 0x4c, 0x89, 0xf7, 0xe8, 0x5d, 
+0xfe, 0xff, 0xff, 0x41, 0x89, 0xc5, 0xeb, 0x74, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x48, 0x8d, 0x35, 0x91, 0x1d, 0x00, 0x00, 0xbf, 
+0x03, 0x00, 0x00, 0x00, 0x31, 0xc0, 0xe8, 0x1d, 
+0x02, 0x00, 0x00, 0x49, 0x8b, 0x74, 0x24, 0x18, 
+0x4c, 0x89, 0xf9, 0x48, 0x89, 0xda, 0x48, 0x89, 
+0xef, 0xe8, 0x0a, 0xf9, 0xff, 0xff, 0x41, 0x89, 
+0xc5, 0x85, 0xc0, 0x75, 0x54, 0x48, 0x8b, 0x73, 
+0x08, 0xba, 0x02, 0x00, 0x00, 0x00, 0x48, 0x2b, 
+0x33, 0x48, 0x89, 0xef, 0xe8, 0x93, 0x0d, 0x00, 
+0x00, 0x49, 0x8b, 0x44, 0x24, 0x18, 0x48, 0x89, 
+0xef, 0x48, 0xba, 0x63, 0x72, 0x69, 0x75, 0x76, 
+0x64, 0x73, 0x6f, 0x48, 0x89, 0x55, 0x00, 0xba, 
+0x05, 0x00, 0x00, 0x00, 0x48, 0x89, 0x45, 0x08, 
+0x48, 0x8b, 0x73, 0x08, 0x48, 0x2b, 0x33, 0xe8, 
+0x68, 0x0d, 0x00, 0x00, 0x48, 0x81, 0xc4, 0xe8, 
+0x00, 0x00, 0x00, 0x44, 0x89, 0xe8, 0x5b, 0x5d, 
+0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 
+0xc3, 0xb9, 0x28, 0x01, 0x00, 0x00, 0x48, 0x8d, 
+0x15, 0x31, 0x13, 0x00, 0x00, 0x48, 0x8d, 0x35, 
+0x3c, 0x1d, 0x00, 0x00, 0x31, 0xc0, 0xbf, 0x01, 
+0x00, 0x00, 0x00, 0xe8, 0x90, 0x01, 0x00, 0x00, 
+0x41, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xc4, 
+0x4d, 0x89, 0xf0, 0xb9, 0x17, 0x01, 0x00, 0x00, 
+0xbf, 0x01, 0x00, 0x00, 0x00, 0x31, 0xc0, 0x48, 
+0x8d, 0x15, 0x00, 0x13, 0x00, 0x00, 0x48, 0x8d, 
+0x35, 0xa3, 0x1c, 0x00, 0x00, 0xe8, 0x66, 0x01, 
+0x00, 0x00, 0xeb, 0xd4, 0x0f, 0x1f, 0x40, 0x00, 
+0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x48, 0x83, 
+0xec, 0x08, 0x0f, 0xb6, 0x07, 0x44, 0x8b, 0x25, 
+0x1c, 0x1e, 0x00, 0x00, 0x84, 0xc0, 0x74, 0x78, 
+0x48, 0x89, 0xfd, 0x48, 0x89, 0xf3, 0xeb, 0x0c, 
+0x0f, 0xb6, 0x45, 0x01, 0x48, 0x83, 0xc5, 0x01, 
+0x84, 0xc0, 0x74, 0x64, 0x48, 0x8b, 0x53, 0x48, 
+0x88, 0x02, 0x48, 0x8b, 0x53, 0x48, 0x48, 0x8d, 
+0x42, 0x01, 0x48, 0x89, 0x43, 0x48, 0x48, 0x29, 
+0xd8, 0x48, 0x83, 0xf8, 0x45, 0x7e, 0xd9, 0xc6, 
+0x42, 0x01, 0x3e, 0x48, 0x8b, 0x43, 0x48, 0x4c, 
+0x8d, 0x6b, 0x05, 0xc6, 0x40, 0x01, 0x0a, 0x48, 
+0x8b, 0x43, 0x48, 0x48, 0x8d, 0x50, 0x02, 0x48, 
+0x89, 0x53, 0x48, 0x4c, 0x39, 0xea, 0x74, 0xb8, 
+0x8b, 0x3d, 0x56, 0x10, 0x00, 0x00, 0x48, 0x29, 
+0xda, 0x48, 0x89, 0xde, 0x48, 0x83, 0xc5, 0x01, 
+0xe8, 0x5f, 0x0c, 0x00, 0x00, 0x44, 0x89, 0x23, 
+0xc6, 0x43, 0x04, 0x20, 0x4c, 0x89, 0x6b, 0x48, 
+0x0f, 0xb6, 0x45, 0x00, 0x84, 0xc0, 0x75, 0x9c, 
+0x48, 0x83, 0xc4, 0x08, 0x5b, 0x5d, 0x41, 0x5c, 
+0x41, 0x5d, 0xc3, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x53, 0x89, 0xfb, 0x8b, 0x3d, 0x1b, 0x10, 0x00, 
+0x00, 0xe8, 0x3e, 0x0c, 0x00, 0x00, 0x89, 0x1d, 
+0x10, 0x10, 0x00, 0x00, 0x5b, 0xc3, 0x66, 0x2e, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x89, 0x3d, 0xfa, 0x0f, 0x00, 0x00, 0xc3, 0x66, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x49, 0x89, 0xca, 0x48, 0x63, 0xce, 0x49, 0x89, 
+0xf8, 0x89, 0xf0, 0x48, 0x8d, 0x7c, 0x0f, 0xff, 
+0x85, 0xd2, 0x78, 0x6c, 0x41, 0xbb, 0x00, 0x00, 
+0x00, 0x00, 0x74, 0x54, 0x41, 0xb9, 0xcd, 0xcc, 
+0xcc, 0xcc, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x89, 0xd1, 0x49, 0x0f, 0xaf, 0xc9, 0x48, 0xc1, 
+0xe9, 0x23, 0x8d, 0x34, 0x89, 0x01, 0xf6, 0x29, 
+0xf2, 0x48, 0x89, 0xfe, 0x48, 0x8d, 0x7f, 0xff, 
+0x83, 0xc2, 0x30, 0x88, 0x57, 0x01, 0x89, 0xca, 
+0x85, 0xc9, 0x75, 0xdc, 0x45, 0x85, 0xdb, 0x75, 
+0x0f, 0x49, 0x89, 0x32, 0x4c, 0x29, 0xc6, 0x29, 
+0xf0, 0xc3, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x89, 0xfe, 0xc6, 0x07, 0x2d, 0x49, 0x89, 
+0x32, 0x4c, 0x29, 0xc6, 0x29, 0xf0, 0xc3, 0x90, 
+0x48, 0x89, 0xfe, 0xc6, 0x07, 0x30, 0x49, 0x89, 
+0x32, 0x4c, 0x29, 0xc6, 0x29, 0xf0, 0xc3, 0x90, 
+0xf7, 0xda, 0x41, 0xbb, 0x01, 0x00, 0x00, 0x00, 
+0xeb, 0x92, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x48, 0x81, 
+0xec, 0xc8, 0x00, 0x00, 0x00, 0x39, 0x3d, 0x4d, 
+0x0f, 0x00, 0x00, 0x48, 0x89, 0x94, 0x24, 0xa0, 
+0x00, 0x00, 0x00, 0x48, 0x89, 0x8c, 0x24, 0xa8, 
+0x00, 0x00, 0x00, 0x4c, 0x89, 0x84, 0x24, 0xb0, 
+0x00, 0x00, 0x00, 0x4c, 0x89, 0x8c, 0x24, 0xb8, 
+0x00, 0x00, 0x00, 0x73, 0x13, 0x48, 0x81, 0xc4, 
+0xc8, 0x00, 0x00, 0x00, 0x5b, 0x5d, 0x41, 0x5c, 
+0x41, 0x5d, 0xc3, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x8d, 0x6c, 0x24, 0x45, 0xc6, 0x44, 0x24, 
+0x44, 0x20, 0x48, 0x8d, 0x84, 0x24, 0xf0, 0x00, 
+0x00, 0x00, 0x44, 0x8b, 0x25, 0x6f, 0x1c, 0x00, 
+0x00, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0x8d, 
+0x84, 0x24, 0x90, 0x00, 0x00, 0x00, 0x48, 0x8d, 
+0x5c, 0x24, 0x40, 0x48, 0x89, 0x44, 0x24, 0x38, 
+0x0f, 0xb6, 0x06, 0x44, 0x89, 0x64, 0x24, 0x40, 
+0x48, 0x89, 0xac, 0x24, 0x88, 0x00, 0x00, 0x00, 
+0xc7, 0x44, 0x24, 0x28, 0x10, 0x00, 0x00, 0x00, 
+0x84, 0xc0, 0x75, 0x3d, 0xeb, 0x78, 0x66, 0x2e, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0f, 0xb6, 0x46, 0x01, 0x3c, 0x6c, 0x0f, 0x84, 
+0x94, 0x00, 0x00, 0x00, 0x3c, 0x73, 0x0f, 0x84, 
+0x4c, 0x01, 0x00, 0x00, 0x3c, 0x78, 0x0f, 0x84, 
+0x14, 0x04, 0x00, 0x00, 0x3c, 0x64, 0x0f, 0x84, 
+0xc4, 0x03, 0x00, 0x00, 0x41, 0x0f, 0xb6, 0x45, 
+0x01, 0x49, 0x8d, 0x75, 0x01, 0x84, 0xc0, 0x74, 
+0x3d, 0x4c, 0x8d, 0x6e, 0x01, 0x3c, 0x25, 0x74, 
+0xc7, 0x48, 0x8b, 0x94, 0x24, 0x88, 0x00, 0x00, 
+0x00, 0x88, 0x02, 0x48, 0x8b, 0x94, 0x24, 0x88, 
+0x00, 0x00, 0x00, 0x48, 0x8d, 0x42, 0x01, 0x48, 
+0x89, 0x84, 0x24, 0x88, 0x00, 0x00, 0x00, 0x48, 
+0x29, 0xd8, 0x48, 0x83, 0xf8, 0x45, 0x0f, 0x8f, 
+0x2c, 0x01, 0x00, 0x00, 0x4c, 0x89, 0xee, 0x0f, 
+0xb6, 0x06, 0x84, 0xc0, 0x75, 0xc3, 0x48, 0x8b, 
+0x94, 0x24, 0x88, 0x00, 0x00, 0x00, 0x48, 0x39, 
+0xea, 0x0f, 0x84, 0x16, 0xff, 0xff, 0xff, 0x8b, 
+0x3d, 0x3f, 0x0e, 0x00, 0x00, 0x48, 0x29, 0xda, 
+0x48, 0x89, 0xde, 0xe8, 0x4c, 0x0a, 0x00, 0x00, 
+0x48, 0x81, 0xc4, 0xc8, 0x00, 0x00, 0x00, 0x5b, 
+0x5d, 0x41, 0x5c, 0x41, 0x5d, 0xc3, 0x66, 0x90, 
+0x0f, 0xb6, 0x46, 0x02, 0x4c, 0x8d, 0x6e, 0x02, 
+0x3c, 0x6c, 0x75, 0x08, 0x0f, 0xb6, 0x46, 0x03, 
+0x4c, 0x8d, 0x6e, 0x03, 0x3c, 0x73, 0x0f, 0x84, 
+0xa4, 0x00, 0x00, 0x00, 0x3c, 0x78, 0x0f, 0x84, 
+0x3c, 0x01, 0x00, 0x00, 0x3c, 0x64, 0x0f, 0x85, 
+0x58, 0xff, 0xff, 0xff, 0x8b, 0x44, 0x24, 0x28, 
+0x83, 0xf8, 0x2f, 0x0f, 0x87, 0xb7, 0x04, 0x00, 
+0x00, 0x89, 0xc2, 0x48, 0x03, 0x54, 0x24, 0x38, 
+0x83, 0xc0, 0x08, 0xc6, 0x44, 0x24, 0x25, 0x00, 
+0x48, 0x8b, 0x0a, 0x89, 0x44, 0x24, 0x28, 0x48, 
+0x85, 0xc9, 0x0f, 0x88, 0xb7, 0x04, 0x00, 0x00, 
+0x41, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x84, 
+0xbc, 0x04, 0x00, 0x00, 0x48, 0xbf, 0xcd, 0xcc, 
+0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x48, 0x8d, 
+0x74, 0x24, 0x24, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x89, 0xc8, 0x48, 0xf7, 0xe7, 0x48, 0xc1, 
+0xea, 0x03, 0x48, 0x8d, 0x04, 0x92, 0x48, 0x01, 
+0xc0, 0x48, 0x29, 0xc1, 0x48, 0x89, 0xf0, 0x48, 
+0x8d, 0x76, 0xff, 0x83, 0xc1, 0x30, 0x88, 0x4e, 
+0x01, 0x48, 0x89, 0xd1, 0x48, 0x85, 0xd2, 0x75, 
+0xd7, 0x45, 0x85, 0xc0, 0x74, 0x06, 0xc6, 0x06, 
+0x2d, 0x48, 0x89, 0xf0, 0x48, 0x89, 0xde, 0x48, 
+0x89, 0xc7, 0xe8, 0xa9, 0xfc, 0xff, 0xff, 0xe9, 
+0xc8, 0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x40, 0x00, 
+0x8b, 0x44, 0x24, 0x28, 0x83, 0xf8, 0x2f, 0x77, 
+0x7f, 0x89, 0xc2, 0x83, 0xc0, 0x08, 0x48, 0x03, 
+0x54, 0x24, 0x38, 0x89, 0x44, 0x24, 0x28, 0x48, 
+0x8b, 0x3a, 0x48, 0x89, 0xde, 0xe8, 0x7e, 0xfc, 
+0xff, 0xff, 0xe9, 0x9d, 0xfe, 0xff, 0xff, 0x66, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xc6, 0x42, 0x01, 0x3e, 0x48, 0x8b, 0x84, 0x24, 
+0x88, 0x00, 0x00, 0x00, 0xc6, 0x40, 0x01, 0x0a, 
+0x48, 0x8b, 0x84, 0x24, 0x88, 0x00, 0x00, 0x00, 
+0x48, 0x8d, 0x50, 0x02, 0x48, 0x89, 0x94, 0x24, 
+0x88, 0x00, 0x00, 0x00, 0x48, 0x39, 0xea, 0x0f, 
+0x84, 0xa7, 0xfe, 0xff, 0xff, 0x8b, 0x3d, 0x01, 
+0x0d, 0x00, 0x00, 0x48, 0x29, 0xda, 0x48, 0x89, 
+0xde, 0xe8, 0x0e, 0x09, 0x00, 0x00, 0x44, 0x89, 
+0x64, 0x24, 0x40, 0xc6, 0x44, 0x24, 0x44, 0x20, 
+0x48, 0x89, 0xac, 0x24, 0x88, 0x00, 0x00, 0x00, 
+0xe9, 0x7f, 0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x00, 
+0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0x8d, 0x42, 
+0x08, 0x48, 0x89, 0x44, 0x24, 0x30, 0xe9, 0x7c, 
+0xff, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x8b, 0x44, 0x24, 0x28, 0x83, 0xf8, 0x2f, 0x0f, 
+0x87, 0x6b, 0x03, 0x00, 0x00, 0x89, 0xc2, 0x83, 
+0xc0, 0x08, 0x48, 0x03, 0x54, 0x24, 0x38, 0x89, 
+0x44, 0x24, 0x28, 0x48, 0x8b, 0x12, 0x31, 0xff, 
+0x48, 0x8d, 0x74, 0x24, 0x1f, 0xc6, 0x44, 0x24, 
+0x22, 0x00, 0x48, 0x8d, 0x05, 0xec, 0x0e, 0x00, 
+0x00, 0x48, 0x89, 0xd1, 0x83, 0xe1, 0x0f, 0x0f, 
+0xb6, 0x0c, 0x08, 0x88, 0x4c, 0x24, 0x21, 0x48, 
+0x89, 0xd1, 0x48, 0xc1, 0xe9, 0x04, 0x83, 0xe1, 
+0x0f, 0x0f, 0xb6, 0x0c, 0x08, 0x80, 0xf9, 0x30, 
+0x88, 0x4c, 0x24, 0x20, 0x48, 0x89, 0xd1, 0x40, 
+0x0f, 0x94, 0xc7, 0x48, 0xc1, 0xe9, 0x08, 0x83, 
+0xe1, 0x0f, 0x48, 0x8d, 0x7c, 0x3c, 0x20, 0x0f, 
+0xb6, 0x0c, 0x08, 0x80, 0xf9, 0x30, 0x88, 0x4c, 
+0x24, 0x1f, 0x48, 0x89, 0xd1, 0x48, 0x0f, 0x45, 
+0xfe, 0x48, 0xc1, 0xe9, 0x0c, 0x48, 0x8d, 0x74, 
+0x24, 0x1e, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 
+0x08, 0x80, 0xf9, 0x30, 0x88, 0x4c, 0x24, 0x1e, 
+0x48, 0x89, 0xd1, 0x48, 0x0f, 0x45, 0xfe, 0x48, 
+0xc1, 0xe9, 0x10, 0x48, 0x8d, 0x74, 0x24, 0x1d, 
+0x83, 0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 0x08, 0x80, 
+0xf9, 0x30, 0x88, 0x4c, 0x24, 0x1d, 0x48, 0x89, 
+0xd1, 0x48, 0x0f, 0x45, 0xfe, 0x48, 0xc1, 0xe9, 
+0x14, 0x48, 0x8d, 0x74, 0x24, 0x1c, 0x83, 0xe1, 
+0x0f, 0x0f, 0xb6, 0x0c, 0x08, 0x80, 0xf9, 0x30, 
+0x88, 0x4c, 0x24, 0x1c, 0x48, 0x89, 0xd1, 0x48, 
+0x0f, 0x45, 0xfe, 0x48, 0xc1, 0xe9, 0x18, 0x48, 
+0x8d, 0x74, 0x24, 0x1b, 0x83, 0xe1, 0x0f, 0x0f, 
+0xb6, 0x0c, 0x08, 0x80, 0xf9, 0x30, 0x88, 0x4c, 
+0x24, 0x1b, 0x89, 0xd1, 0x48, 0x0f, 0x45, 0xfe, 
+0xc1, 0xe9, 0x1c, 0x48, 0x8d, 0x74, 0x24, 0x1a, 
+0x0f, 0xb6, 0x0c, 0x08, 0x80, 0xf9, 0x30, 0x88, 
+0x4c, 0x24, 0x1a, 0x48, 0x89, 0xd1, 0x48, 0x0f, 
+0x45, 0xfe, 0x48, 0xc1, 0xe9, 0x20, 0x48, 0x8d, 
+0x74, 0x24, 0x19, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 
+0x0c, 0x08, 0x80, 0xf9, 0x30, 0x88, 0x4c, 0x24, 
+0x19, 0x48, 0x89, 0xd1, 0x48, 0x0f, 0x45, 0xfe, 
+0x48, 0xc1, 0xe9, 0x24, 0x48, 0x8d, 0x74, 0x24, 
+0x18, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 0x08, 
+0x80, 0xf9, 0x30, 0x88, 0x4c, 0x24, 0x18, 0x48, 
+0x89, 0xd1, 0x48, 0x0f, 0x45, 0xfe, 0x48, 0xc1, 
+0xe9, 0x28, 0x48, 0x8d, 0x74, 0x24, 0x17, 0x83, 
+0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 0x08, 0x80, 0xf9, 
+0x30, 0x88, 0x4c, 0x24, 0x17, 0x48, 0x89, 0xd1, 
+0x48, 0x0f, 0x45, 0xfe, 0x48, 0xc1, 0xe9, 0x2c, 
+0x48, 0x8d, 0x74, 0x24, 0x16, 0x83, 0xe1, 0x0f, 
+0x0f, 0xb6, 0x0c, 0x08, 0x80, 0xf9, 0x30, 0x88, 
+0x4c, 0x24, 0x16, 0x48, 0x89, 0xd1, 0x48, 0x0f, 
+0x45, 0xfe, 0x48, 0xc1, 0xe9, 0x30, 0x48, 0x8d, 
+0x74, 0x24, 0x15, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 
+0x0c, 0x08, 0x80, 0xf9, 0x30, 0x88, 0x4c, 0x24, 
+0x15, 0x48, 0x89, 0xd1, 0x48, 0x0f, 0x45, 0xfe, 
+0x48, 0xc1, 0xe9, 0x34, 0x48, 0x8d, 0x74, 0x24, 
+0x14, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 0x08, 
+0x80, 0xf9, 0x30, 0x88, 0x4c, 0x24, 0x14, 0x48, 
+0x89, 0xd1, 0x48, 0x0f, 0x45, 0xfe, 0x48, 0xc1, 
+0xe9, 0x38, 0x48, 0x8d, 0x74, 0x24, 0x13, 0x83, 
+0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 0x08, 0x80, 0xf9, 
+0x30, 0x88, 0x4c, 0x24, 0x13, 0x48, 0x0f, 0x45, 
+0xfe, 0x48, 0xc1, 0xea, 0x3c, 0xe9, 0x31, 0x01, 
+0x00, 0x00, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x8b, 0x44, 0x24, 0x28, 0x83, 0xf8, 0x2f, 0x0f, 
+0x87, 0x6b, 0x01, 0x00, 0x00, 0x89, 0xc2, 0x83, 
+0xc0, 0x08, 0x48, 0x03, 0x54, 0x24, 0x38, 0x89, 
+0x44, 0x24, 0x28, 0x8b, 0x12, 0x48, 0x8d, 0x7c, 
+0x24, 0x10, 0x48, 0x8d, 0x4c, 0x24, 0x08, 0xbe, 
+0x0b, 0x00, 0x00, 0x00, 0xc6, 0x44, 0x24, 0x1b, 
+0x00, 0xe8, 0xb2, 0xfa, 0xff, 0xff, 0x48, 0x8b, 
+0x7c, 0x24, 0x08, 0x48, 0x89, 0xde, 0xe8, 0xd5, 
+0xf9, 0xff, 0xff, 0xe9, 0xf4, 0xfb, 0xff, 0xff, 
+0x8b, 0x44, 0x24, 0x28, 0x83, 0xf8, 0x2f, 0x0f, 
+0x87, 0x0b, 0x01, 0x00, 0x00, 0x89, 0xc2, 0x83, 
+0xc0, 0x08, 0x48, 0x03, 0x54, 0x24, 0x38, 0x89, 
+0x44, 0x24, 0x28, 0x8b, 0x12, 0x48, 0x8d, 0x05, 
+0xc9, 0x0c, 0x00, 0x00, 0x31, 0xff, 0x48, 0x8d, 
+0x74, 0x24, 0x17, 0xc6, 0x44, 0x24, 0x1a, 0x00, 
+0x89, 0xd1, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 
+0x08, 0x88, 0x4c, 0x24, 0x19, 0x89, 0xd1, 0xc1, 
+0xe9, 0x04, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 
+0x08, 0x80, 0xf9, 0x30, 0x88, 0x4c, 0x24, 0x18, 
+0x89, 0xd1, 0x40, 0x0f, 0x94, 0xc7, 0xc1, 0xe9, 
+0x08, 0x83, 0xe1, 0x0f, 0x48, 0x8d, 0x7c, 0x3c, 
+0x18, 0x0f, 0xb6, 0x0c, 0x08, 0x80, 0xf9, 0x30, 
+0x88, 0x4c, 0x24, 0x17, 0x89, 0xd1, 0x48, 0x0f, 
+0x45, 0xfe, 0xc1, 0xe9, 0x0c, 0x48, 0x8d, 0x74, 
+0x24, 0x16, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 
+0x08, 0x80, 0xf9, 0x30, 0x88, 0x4c, 0x24, 0x16, 
+0x89, 0xd1, 0x48, 0x0f, 0x45, 0xfe, 0xc1, 0xe9, 
+0x10, 0x48, 0x8d, 0x74, 0x24, 0x15, 0x83, 0xe1, 
+0x0f, 0x0f, 0xb6, 0x0c, 0x08, 0x80, 0xf9, 0x30, 
+0x88, 0x4c, 0x24, 0x15, 0x89, 0xd1, 0x48, 0x0f, 
+0x45, 0xfe, 0xc1, 0xe9, 0x14, 0x48, 0x8d, 0x74, 
+0x24, 0x14, 0x83, 0xe1, 0x0f, 0x0f, 0xb6, 0x0c, 
+0x08, 0x80, 0xf9, 0x30, 0x88, 0x4c, 0x24, 0x14, 
+0x89, 0xd1, 0x48, 0x0f, 0x45, 0xfe, 0xc1, 0xe9, 
+0x18, 0x48, 0x8d, 0x74, 0x24, 0x13, 0x83, 0xe1, 
+0x0f, 0x0f, 0xb6, 0x0c, 0x08, 0x88, 0x4c, 0x24, 
+0x13, 0x80, 0xf9, 0x30, 0x48, 0x0f, 0x45, 0xfe, 
+0xc1, 0xea, 0x1c, 0x0f, 0xb6, 0x04, 0x10, 0x48, 
+0x8d, 0x54, 0x24, 0x12, 0x48, 0x89, 0xde, 0x3c, 
+0x30, 0x88, 0x44, 0x24, 0x12, 0x0f, 0xb7, 0x05, 
+0x08, 0x17, 0x00, 0x00, 0x48, 0x0f, 0x45, 0xfa, 
+0x66, 0x89, 0x47, 0xfe, 0x48, 0x83, 0xef, 0x02, 
+0xe8, 0xc3, 0xf8, 0xff, 0xff, 0xe9, 0xe2, 0xfa, 
+0xff, 0xff, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0x8d, 0x42, 
+0x08, 0x48, 0x89, 0x44, 0x24, 0x30, 0xe9, 0xf0, 
+0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0x8d, 0x42, 
+0x08, 0x48, 0x89, 0x44, 0x24, 0x30, 0xe9, 0x90, 
+0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x8b, 0x54, 0x24, 0x30, 0x48, 0x8d, 0x42, 
+0x08, 0x48, 0x89, 0x44, 0x24, 0x30, 0xe9, 0x90, 
+0xfc, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x48, 0x8b, 0x54, 0x24, 0x30, 0xc6, 0x44, 0x24, 
+0x25, 0x00, 0x48, 0x8b, 0x0a, 0x48, 0x8d, 0x42, 
+0x08, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0x85, 
+0xc9, 0x0f, 0x89, 0x49, 0xfb, 0xff, 0xff, 0x48, 
+0xf7, 0xd9, 0x41, 0xb8, 0x01, 0x00, 0x00, 0x00, 
+0xe9, 0x47, 0xfb, 0xff, 0xff, 0x0f, 0x1f, 0x00, 
+0xc6, 0x44, 0x24, 0x24, 0x30, 0x48, 0x8d, 0x44, 
+0x24, 0x24, 0xe9, 0x7d, 0xfb, 0xff, 0xff, 0x90, 
+0x41, 0x54, 0x31, 0xd2, 0xbe, 0x00, 0x00, 0x01, 
+0x00, 0x55, 0x53, 0x48, 0x89, 0xfb, 0xe8, 0x01, 
+0x05, 0x00, 0x00, 0x48, 0x89, 0xc5, 0x41, 0x89, 
+0xc4, 0x85, 0xc0, 0x78, 0x2b, 0xbe, 0x02, 0x00, 
+0x00, 0x00, 0x48, 0x89, 0xdf, 0xe8, 0x82, 0x07, 
+0x00, 0x00, 0x85, 0xc0, 0x75, 0x42, 0x48, 0x89, 
+0xdf, 0xe8, 0x7a, 0x06, 0x00, 0x00, 0x85, 0xc0, 
+0x75, 0x6f, 0x44, 0x89, 0xe0, 0x5b, 0x5d, 0x41, 
+0x5c, 0xc3, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0x41, 0x89, 0xc1, 0x49, 0x89, 0xd8, 0xb9, 0x15, 
+0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 
+0x48, 0x8d, 0x15, 0xff, 0x0a, 0x00, 0x00, 0x48, 
+0x8d, 0x35, 0x3a, 0x15, 0x00, 0x00, 0x31, 0xc0, 
+0xe8, 0x23, 0xf9, 0xff, 0xff, 0xeb, 0xae, 0x90, 
+0x41, 0x89, 0xc1, 0x49, 0x89, 0xd8, 0xb9, 0x19, 
+0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 
+0x48, 0x8d, 0x15, 0xd7, 0x0a, 0x00, 0x00, 0x48, 
+0x8d, 0x35, 0x42, 0x15, 0x00, 0x00, 0x31, 0xc0, 
+0xe8, 0xfb, 0xf8, 0xff, 0xff, 0x85, 0xed, 0x78, 
+0x08, 0x44, 0x89, 0xe7, 0xe8, 0x7b, 0x04, 0x00, 
+0x00, 0x41, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xeb, 
+0x91, 0x41, 0x89, 0xc1, 0x49, 0x89, 0xd8, 0xb9, 
+0x1f, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 
+0x00, 0x48, 0x8d, 0x15, 0x9e, 0x0a, 0x00, 0x00, 
+0x48, 0x8d, 0x35, 0x39, 0x15, 0x00, 0x00, 0x31, 
+0xc0, 0xe8, 0xc2, 0xf8, 0xff, 0xff, 0xeb, 0xc5, 
+0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 
+0x55, 0x53, 0x48, 0x81, 0xec, 0x38, 0x1c, 0x00, 
+0x00, 0x41, 0x80, 0xf9, 0x01, 0x48, 0x19, 0xc0, 
+0x89, 0x54, 0x24, 0x48, 0x4c, 0x8d, 0x9c, 0x24, 
+0x88, 0x04, 0x00, 0x00, 0x48, 0x8d, 0x94, 0x24, 
+0x88, 0x00, 0x00, 0x00, 0x48, 0x25, 0x61, 0xe8, 
+0xff, 0xff, 0x89, 0x7c, 0x24, 0x28, 0x48, 0x05, 
+0xa0, 0x17, 0x00, 0x00, 0x48, 0x89, 0x4c, 0x24, 
+0x08, 0x48, 0x89, 0x84, 0x24, 0x80, 0x00, 0x00, 
+0x00, 0x48, 0x8d, 0x44, 0x24, 0x78, 0x48, 0x89, 
+0x44, 0x24, 0x50, 0x48, 0x8b, 0x05, 0x16, 0x15, 
+0x00, 0x00, 0x4c, 0x89, 0x5c, 0x24, 0x78, 0x48, 
+0xc7, 0x44, 0x24, 0x58, 0x01, 0x00, 0x00, 0x00, 
+0x48, 0x89, 0x74, 0x24, 0x40, 0x48, 0x89, 0x54, 
+0x24, 0x60, 0x48, 0xc7, 0x84, 0x24, 0x88, 0x00, 
+0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x48, 0x89, 
+0x84, 0x24, 0x90, 0x00, 0x00, 0x00, 0x45, 0x85, 
+0xc0, 0x0f, 0x8e, 0x9a, 0x01, 0x00, 0x00, 0x44, 
+0x89, 0x44, 0x24, 0x10, 0x45, 0x31, 0xff, 0x4c, 
+0x8d, 0x6c, 0x24, 0x38, 0x45, 0x89, 0xcc, 0x48, 
+0x8d, 0x84, 0x24, 0x98, 0x00, 0x00, 0x00, 0x4c, 
+0x89, 0x5c, 0x24, 0x20, 0x48, 0x89, 0x44, 0x24, 
+0x18, 0x44, 0x8b, 0x44, 0x24, 0x10, 0xb8, 0xfc, 
+0x00, 0x00, 0x00, 0x48, 0x8b, 0x4c, 0x24, 0x08, 
+0x48, 0x8b, 0x7c, 0x24, 0x18, 0x45, 0x29, 0xf8, 
+0x41, 0x39, 0xc0, 0x44, 0x0f, 0x4f, 0xc0, 0x41, 
+0x8d, 0x40, 0x04, 0x48, 0x98, 0x48, 0xc1, 0xe0, 
+0x02, 0x48, 0x89, 0x44, 0x24, 0x68, 0x48, 0x89, 
+0x02, 0x49, 0x63, 0xd7, 0x42, 0x8d, 0x04, 0x85, 
+0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x1c, 0x91, 
+0x44, 0x89, 0xc1, 0x81, 0xe1, 0xff, 0xff, 0xff, 
+0x3f, 0x48, 0x89, 0xde, 0xf3, 0xa5, 0x89, 0xc1, 
+0x83, 0xe1, 0x03, 0x74, 0x02, 0xf3, 0xa4, 0x45, 
+0x84, 0xe4, 0x75, 0x44, 0x8b, 0x7c, 0x24, 0x28, 
+0x31, 0xd2, 0x48, 0x8d, 0x74, 0x24, 0x40, 0x44, 
+0x89, 0x44, 0x24, 0x14, 0xe8, 0x23, 0x04, 0x00, 
+0x00, 0x44, 0x8b, 0x44, 0x24, 0x14, 0x85, 0xc0, 
+0x89, 0xc2, 0x0f, 0x8e, 0xd6, 0x00, 0x00, 0x00, 
+0x45, 0x01, 0xc7, 0x44, 0x39, 0x7c, 0x24, 0x10, 
+0x0f, 0x8e, 0xeb, 0x00, 0x00, 0x00, 0x48, 0x8b, 
+0x54, 0x24, 0x60, 0xe9, 0x69, 0xff, 0xff, 0xff, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x48, 0x8b, 0x4c, 0x24, 0x08, 0x49, 0x63, 0xc0, 
+0x44, 0x89, 0x44, 0x24, 0x14, 0x48, 0x01, 0xd0, 
+0x44, 0x89, 0x7c, 0x24, 0x2c, 0x48, 0x8b, 0x6c, 
+0x24, 0x20, 0x4c, 0x8d, 0x34, 0x81, 0xeb, 0x3f, 
+0x48, 0x8d, 0x54, 0x24, 0x30, 0xbe, 0x11, 0x00, 
+0x00, 0x00, 0x44, 0x89, 0xff, 0xe8, 0x3a, 0x04, 
+0x00, 0x00, 0x48, 0x85, 0xc0, 0x0f, 0x85, 0x85, 
+0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 0x24, 0x30, 
+0x48, 0x83, 0xc3, 0x04, 0x48, 0x83, 0xc5, 0x18, 
+0x48, 0x89, 0x45, 0xec, 0x8b, 0x44, 0x24, 0x38, 
+0x89, 0x45, 0xf8, 0x8b, 0x44, 0x24, 0x3c, 0x89, 
+0x45, 0xfc, 0x49, 0x39, 0xde, 0x74, 0x48, 0x44, 
+0x8b, 0x3b, 0x31, 0xd2, 0xbe, 0x01, 0x00, 0x00, 
+0x00, 0x44, 0x89, 0xff, 0xe8, 0xfb, 0x03, 0x00, 
+0x00, 0x85, 0xc0, 0x78, 0x4b, 0x88, 0x45, 0x00, 
+0x4c, 0x89, 0xea, 0xbe, 0x10, 0x00, 0x00, 0x00, 
+0x44, 0x89, 0xff, 0xe8, 0xe4, 0x03, 0x00, 0x00, 
+0x48, 0x85, 0xc0, 0x75, 0x33, 0x8b, 0x44, 0x24, 
+0x3c, 0x85, 0xc0, 0x75, 0x8b, 0x31, 0xc0, 0x48, 
+0x83, 0xc3, 0x04, 0x48, 0x83, 0xc5, 0x18, 0x89, 
+0x45, 0xfc, 0x49, 0x39, 0xde, 0x75, 0xb8, 0x44, 
+0x8b, 0x44, 0x24, 0x14, 0x44, 0x8b, 0x7c, 0x24, 
+0x2c, 0xe9, 0x06, 0xff, 0xff, 0xff, 0x75, 0x0d, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xba, 0xff, 0xff, 0xff, 0xff, 0x48, 0x81, 0xc4, 
+0x38, 0x1c, 0x00, 0x00, 0x89, 0xd0, 0x5b, 0x5d, 
+0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 
+0xc3, 0x31, 0xd2, 0xeb, 0xe8, 0x0f, 0x1f, 0x00, 
+0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 
+0x55, 0x48, 0x89, 0xcd, 0x53, 0x48, 0x81, 0xec, 
+0x08, 0x1c, 0x00, 0x00, 0x48, 0x83, 0xf9, 0x01, 
+0x48, 0x8d, 0x84, 0x24, 0x58, 0x04, 0x00, 0x00, 
+0x48, 0x8d, 0x4c, 0x24, 0x58, 0x48, 0xc7, 0x44, 
+0x24, 0x28, 0x01, 0x00, 0x00, 0x00, 0x48, 0x89, 
+0x44, 0x24, 0x08, 0x48, 0x89, 0x44, 0x24, 0x48, 
+0x48, 0x19, 0xc0, 0x48, 0x25, 0x61, 0xe8, 0xff, 
+0xff, 0xc7, 0x44, 0x24, 0x18, 0x00, 0x00, 0x00, 
+0x00, 0x48, 0x05, 0xa0, 0x17, 0x00, 0x00, 0x48, 
+0x89, 0x4c, 0x24, 0x30, 0x48, 0x89, 0x44, 0x24, 
+0x50, 0x48, 0x8d, 0x44, 0x24, 0x48, 0x48, 0x89, 
+0x44, 0x24, 0x20, 0x48, 0x8b, 0x05, 0xd6, 0x12, 
+0x00, 0x00, 0x48, 0xc7, 0x44, 0x24, 0x10, 0x00, 
+0x00, 0x00, 0x00, 0x48, 0xc7, 0x44, 0x24, 0x58, 
+0x00, 0x04, 0x00, 0x00, 0x48, 0x89, 0x44, 0x24, 
+0x60, 0x85, 0xd2, 0x0f, 0x8e, 0x47, 0x01, 0x00, 
+0x00, 0x48, 0x8d, 0x44, 0x24, 0x68, 0x41, 0x89, 
+0xfd, 0x49, 0x89, 0xf6, 0x89, 0xd3, 0x48, 0x89, 
+0x04, 0x24, 0x45, 0x31, 0xe4, 0x4c, 0x8d, 0x7c, 
+0x24, 0x10, 0x89, 0xd8, 0xba, 0xfc, 0x00, 0x00, 
+0x00, 0x4c, 0x89, 0xfe, 0x44, 0x89, 0xef, 0x44, 
+0x29, 0xe0, 0x39, 0xd0, 0x0f, 0x4f, 0xc2, 0x31, 
+0xd2, 0x83, 0xc0, 0x04, 0x48, 0x98, 0x48, 0xc1, 
+0xe0, 0x02, 0x48, 0x89, 0x44, 0x24, 0x38, 0x48, 
+0x89, 0x01, 0xe8, 0x51, 0x02, 0x00, 0x00, 0x89, 
+0xc2, 0x85, 0xc0, 0x0f, 0x8e, 0xff, 0x00, 0x00, 
+0x00, 0x48, 0x83, 0x7c, 0x24, 0x38, 0x0f, 0x0f, 
+0x86, 0xdb, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x44, 
+0x24, 0x30, 0x48, 0x85, 0xc0, 0x0f, 0x84, 0xcd, 
+0x00, 0x00, 0x00, 0x83, 0x78, 0x0c, 0x01, 0x0f, 
+0x85, 0xc3, 0x00, 0x00, 0x00, 0xf6, 0x44, 0x24, 
+0x40, 0x08, 0x0f, 0x85, 0xe0, 0x00, 0x00, 0x00, 
+0x48, 0x8b, 0x00, 0x48, 0x83, 0xe8, 0x10, 0x48, 
+0xc1, 0xe8, 0x02, 0x3d, 0xfc, 0x00, 0x00, 0x00, 
+0x0f, 0x8f, 0x8a, 0x00, 0x00, 0x00, 0x85, 0xc0, 
+0x7e, 0x66, 0x4d, 0x63, 0xcc, 0x89, 0xc1, 0x48, 
+0x8b, 0x34, 0x24, 0x8d, 0x14, 0x85, 0x00, 0x00, 
+0x00, 0x00, 0x81, 0xe1, 0xff, 0xff, 0xff, 0x3f, 
+0x4b, 0x8d, 0x3c, 0x8e, 0xf3, 0xa5, 0x89, 0xd1, 
+0x83, 0xe1, 0x03, 0x74, 0x02, 0xf3, 0xa4, 0x48, 
+0x85, 0xed, 0x74, 0x24, 0x8d, 0x14, 0x40, 0x4b, 
+0x8d, 0x34, 0x49, 0xc1, 0xe2, 0x03, 0x48, 0x8d, 
+0x7c, 0xf5, 0x00, 0x48, 0x8b, 0x74, 0x24, 0x08, 
+0x89, 0xd1, 0xc1, 0xe9, 0x02, 0xf3, 0xa5, 0x89, 
+0xd1, 0x83, 0xe1, 0x03, 0x74, 0x02, 0xf3, 0xa4, 
+0x41, 0x01, 0xc4, 0x44, 0x39, 0xe3, 0x7e, 0x58, 
+0x48, 0x8b, 0x4c, 0x24, 0x30, 0xe9, 0x20, 0xff, 
+0xff, 0xff, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0xba, 0xff, 0xff, 0xff, 0xff, 0x48, 0x81, 0xc4, 
+0x08, 0x1c, 0x00, 0x00, 0x89, 0xd0, 0x5b, 0x5d, 
+0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 
+0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 
+0x48, 0xc7, 0x04, 0x25, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0f, 0x0b, 0x66, 0x2e, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xba, 0xea, 0xff, 0xff, 0xff, 0xeb, 0xc6, 0x66, 
+0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x31, 0xd2, 0xeb, 0xb9, 0x0f, 0x1f, 0x40, 0x00, 
+0xb8, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x44, 0xd0, 
+0xeb, 0xab, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 
+0xba, 0xe9, 0xff, 0xff, 0xff, 0xeb, 0x9e, 0x90, 
+0x49, 0x89, 0xca, 0x0f, 0x05, 0xc3, 0x66, 0x90, 
+0x48, 0xc7, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x0f, 
+0x05, 0x0f, 0x1f, 0x00, 0xb8, 0x00, 0x00, 0x00, 
+0x00, 0xeb, 0xe5, 0x90, 0xb8, 0x01, 0x00, 0x00, 
+0x00, 0xeb, 0xdd, 0x90, 0xb8, 0x02, 0x00, 0x00, 
+0x00, 0xeb, 0xd5, 0x90, 0xb8, 0x03, 0x00, 0x00, 
+0x00, 0xeb, 0xcd, 0x90, 0xb8, 0x08, 0x00, 0x00, 
+0x00, 0xeb, 0xc5, 0x90, 0xb8, 0x09, 0x00, 0x00, 
+0x00, 0xeb, 0xbd, 0x90, 0xb8, 0x0a, 0x00, 0x00, 
+0x00, 0xeb, 0xb5, 0x90, 0xb8, 0x0b, 0x00, 0x00, 
+0x00, 0xeb, 0xad, 0x90, 0xb8, 0x0c, 0x00, 0x00, 
+0x00, 0xeb, 0xa5, 0x90, 0xb8, 0x0d, 0x00, 0x00, 
+0x00, 0xeb, 0x9d, 0x90, 0xb8, 0x0e, 0x00, 0x00, 
+0x00, 0xeb, 0x95, 0x90, 0xb8, 0x0f, 0x00, 0x00, 
+0x00, 0xeb, 0x8d, 0x90, 0xb8, 0x10, 0x00, 0x00, 
+0x00, 0xeb, 0x85, 0x90, 0xb8, 0x11, 0x00, 0x00, 
+0x00, 0xe9, 0x7a, 0xff, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x19, 0x00, 0x00, 0x00, 0xe9, 0x6e, 0xff, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x1b, 0x00, 0x00, 
+0x00, 0xe9, 0x62, 0xff, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x1c, 0x00, 0x00, 0x00, 0xe9, 0x56, 0xff, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x1e, 0x00, 0x00, 
+0x00, 0xe9, 0x4a, 0xff, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x22, 0x00, 0x00, 0x00, 0xe9, 0x3e, 0xff, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x23, 0x00, 0x00, 
+0x00, 0xe9, 0x32, 0xff, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x24, 0x00, 0x00, 0x00, 0xe9, 0x26, 0xff, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x26, 0x00, 0x00, 
+0x00, 0xe9, 0x1a, 0xff, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x27, 0x00, 0x00, 0x00, 0xe9, 0x0e, 0xff, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x29, 0x00, 0x00, 
+0x00, 0xe9, 0x02, 0xff, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x2a, 0x00, 0x00, 0x00, 0xe9, 0xf6, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x2c, 0x00, 0x00, 
+0x00, 0xe9, 0xea, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x2d, 0x00, 0x00, 0x00, 0xe9, 0xde, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x2e, 0x00, 0x00, 
+0x00, 0xe9, 0xd2, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x2f, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x30, 0x00, 0x00, 
+0x00, 0xe9, 0xba, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x31, 0x00, 0x00, 0x00, 0xe9, 0xae, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x36, 0x00, 0x00, 
+0x00, 0xe9, 0xa2, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x37, 0x00, 0x00, 0x00, 0xe9, 0x96, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x38, 0x00, 0x00, 
+0x00, 0xe9, 0x8a, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x3c, 0x00, 0x00, 0x00, 0xe9, 0x7e, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x3d, 0x00, 0x00, 
+0x00, 0xe9, 0x72, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x3e, 0x00, 0x00, 0x00, 0xe9, 0x66, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x48, 0x00, 0x00, 
+0x00, 0xe9, 0x5a, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x49, 0x00, 0x00, 0x00, 0xe9, 0x4e, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x53, 0x00, 0x00, 
+0x00, 0xe9, 0x42, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x54, 0x00, 0x00, 0x00, 0xe9, 0x36, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x57, 0x00, 0x00, 
+0x00, 0xe9, 0x2a, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x59, 0x00, 0x00, 0x00, 0xe9, 0x1e, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x5f, 0x00, 0x00, 
+0x00, 0xe9, 0x12, 0xfe, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x73, 0x00, 0x00, 0x00, 0xe9, 0x06, 0xfe, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x75, 0x00, 0x00, 
+0x00, 0xe9, 0xfa, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x77, 0x00, 0x00, 0x00, 0xe9, 0xee, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x79, 0x00, 0x00, 
+0x00, 0xe9, 0xe2, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x7a, 0x00, 0x00, 0x00, 0xe9, 0xd6, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x7b, 0x00, 0x00, 
+0x00, 0xe9, 0xca, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x7c, 0x00, 0x00, 0x00, 0xe9, 0xbe, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x7e, 0x00, 0x00, 
+0x00, 0xe9, 0xb2, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x81, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x83, 0x00, 0x00, 
+0x00, 0xe9, 0x9a, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x87, 0x00, 0x00, 0x00, 0xe9, 0x8e, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x8d, 0x00, 0x00, 
+0x00, 0xe9, 0x82, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x90, 0x00, 0x00, 0x00, 0xe9, 0x76, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x9d, 0x00, 0x00, 
+0x00, 0xe9, 0x6a, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x9e, 0x00, 0x00, 0x00, 0xe9, 0x5e, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xa0, 0x00, 0x00, 
+0x00, 0xe9, 0x52, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0xa5, 0x00, 0x00, 0x00, 0xe9, 0x46, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xa6, 0x00, 0x00, 
+0x00, 0xe9, 0x3a, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0xba, 0x00, 0x00, 0x00, 0xe9, 0x2e, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xca, 0x00, 0x00, 
+0x00, 0xe9, 0x22, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0xcd, 0x00, 0x00, 0x00, 0xe9, 0x16, 0xfd, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xd3, 0x00, 0x00, 
+0x00, 0xe9, 0x0a, 0xfd, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0xda, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xdb, 0x00, 0x00, 
+0x00, 0xe9, 0xf2, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0xde, 0x00, 0x00, 0x00, 0xe9, 0xe6, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xdf, 0x00, 0x00, 
+0x00, 0xe9, 0xda, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0xe0, 0x00, 0x00, 0x00, 0xe9, 0xce, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xe1, 0x00, 0x00, 
+0x00, 0xe9, 0xc2, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0xe2, 0x00, 0x00, 0x00, 0xe9, 0xb6, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xe7, 0x00, 0x00, 
+0x00, 0xe9, 0xaa, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x11, 0x01, 0x00, 0x00, 0xe9, 0x9e, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x12, 0x01, 0x00, 
+0x00, 0xe9, 0x92, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x16, 0x01, 0x00, 0x00, 0xe9, 0x86, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x21, 0x01, 0x00, 
+0x00, 0xe9, 0x7a, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x29, 0x01, 0x00, 0x00, 0xe9, 0x6e, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x2c, 0x01, 0x00, 
+0x00, 0xe9, 0x62, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x2d, 0x01, 0x00, 0x00, 0xe9, 0x56, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x2e, 0x01, 0x00, 
+0x00, 0xe9, 0x4a, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x30, 0x01, 0x00, 0x00, 0xe9, 0x3e, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x34, 0x01, 0x00, 
+0x00, 0xe9, 0x32, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x38, 0x01, 0x00, 0x00, 0xe9, 0x26, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0x3f, 0x01, 0x00, 
+0x00, 0xe9, 0x1a, 0xfc, 0xff, 0xff, 0x66, 0x90, 
+0xb8, 0x43, 0x01, 0x00, 0x00, 0xe9, 0x0e, 0xfc, 
+0xff, 0xff, 0x66, 0x90, 0xb8, 0xb3, 0x01, 0x00, 
+0x00, 0xe9, 0x02, 0xfc, 0xff, 0xff, 0x00, 0x00, 
+0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x70, 0x69, 0x65, 0x2f, 0x72, 0x65, 0x73, 0x74, 
+0x6f, 0x72, 0x65, 0x72, 0x2e, 0x63, 0x00, 0x52, 
+0x65, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x73, 
+0x69, 0x67, 0x6e, 0x61, 0x6c, 0x20, 0x25, 0x64, 
+0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x25, 
+0x64, 0x0a, 0x00, 0x69, 0x6e, 0x63, 0x6c, 0x75, 
+0x64, 0x65, 0x2f, 0x6c, 0x6f, 0x63, 0x6b, 0x2e, 
+0x68, 0x00, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 
+0x28, 0x25, 0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 
+0x20, 0x42, 0x55, 0x47, 0x20, 0x61, 0x74, 0x20, 
+0x25, 0x73, 0x3a, 0x25, 0x64, 0x0a, 0x00, 0x52, 
+0x65, 0x6d, 0x61, 0x70, 0x20, 0x25, 0x6c, 0x78, 
+0x2d, 0x3e, 0x25, 0x6c, 0x78, 0x20, 0x6c, 0x65, 
+0x6e, 0x20, 0x25, 0x6c, 0x78, 0x0a, 0x00, 0x20, 
+0x65, 0x78, 0x69, 0x74, 0x65, 0x64, 0x2c, 0x20, 
+0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3d, 0x00, 
+0x20, 0x6b, 0x69, 0x6c, 0x6c, 0x65, 0x64, 0x20, 
+0x62, 0x79, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x61, 
+0x6c, 0x20, 0x00, 0x64, 0x69, 0x73, 0x61, 0x70, 
+0x70, 0x65, 0x61, 0x72, 0x65, 0x64, 0x20, 0x77, 
+0x69, 0x74, 0x68, 0x20, 0x00, 0x54, 0x61, 0x73, 
+0x6b, 0x20, 0x25, 0x64, 0x20, 0x25, 0x73, 0x20, 
+0x25, 0x64, 0x0a, 0x00, 0x25, 0x6c, 0x64, 0x3a, 
+0x20, 0x52, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x65, 
+0x64, 0x0a, 0x00, 0x53, 0x77, 0x69, 0x74, 0x63, 
+0x68, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x74, 
+0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6f, 
+0x72, 0x65, 0x72, 0x20, 0x25, 0x64, 0x0a, 0x00, 
+0x72, 0x74, 0x2d, 0x76, 0x64, 0x73, 0x6f, 0x00, 
+0x6c, 0x65, 0x66, 0x74, 0x20, 0x64, 0x75, 0x6d, 
+0x70, 0x65, 0x65, 0x00, 0x72, 0x69, 0x67, 0x68, 
+0x74, 0x20, 0x64, 0x75, 0x6d, 0x70, 0x65, 0x65, 
+0x00, 0x09, 0x6d, 0x6d, 0x61, 0x70, 0x28, 0x25, 
+0x6c, 0x78, 0x20, 0x2d, 0x3e, 0x20, 0x25, 0x6c, 
+0x78, 0x2c, 0x20, 0x25, 0x78, 0x20, 0x25, 0x78, 
+0x20, 0x25, 0x64, 0x29, 0x0a, 0x00, 0x52, 0x65, 
+0x73, 0x74, 0x6f, 0x72, 0x69, 0x6e, 0x67, 0x20, 
+0x45, 0x58, 0x45, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 
+0x0a, 0x00, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 
+0x65, 0x2f, 0x73, 0x6b, 0x2d, 0x69, 0x6e, 0x65, 
+0x74, 0x2e, 0x68, 0x00, 0x53, 0x45, 0x54, 0x5f, 
+0x46, 0x53, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x20, 
+0x25, 0x6c, 0x64, 0x0a, 0x00, 0x53, 0x45, 0x54, 
+0x5f, 0x47, 0x53, 0x20, 0x66, 0x61, 0x69, 0x6c, 
+0x20, 0x25, 0x6c, 0x64, 0x0a, 0x00, 0x2e, 0x64, 
+0x79, 0x6e, 0x73, 0x79, 0x6d, 0x00, 0x2e, 0x64, 
+0x79, 0x6e, 0x73, 0x74, 0x72, 0x00, 0x2e, 0x74, 
+0x65, 0x78, 0x74, 0x00, 0x5f, 0x5f, 0x76, 0x64, 
+0x73, 0x6f, 0x5f, 0x67, 0x65, 0x74, 0x74, 0x69, 
+0x6d, 0x65, 0x6f, 0x66, 0x64, 0x61, 0x79, 0x00, 
+0x5f, 0x5f, 0x76, 0x64, 0x73, 0x6f, 0x5f, 0x67, 
+0x65, 0x74, 0x63, 0x70, 0x75, 0x00, 0x5f, 0x5f, 
+0x76, 0x64, 0x73, 0x6f, 0x5f, 0x63, 0x6c, 0x6f, 
+0x63, 0x6b, 0x5f, 0x67, 0x65, 0x74, 0x74, 0x69, 
+0x6d, 0x65, 0x00, 0x5f, 0x5f, 0x76, 0x64, 0x73, 
+0x6f, 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x00, 0x76, 
+0x64, 0x73, 0x6f, 0x3a, 0x20, 0x50, 0x61, 0x72, 
+0x73, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x74, 0x20, 
+0x25, 0x6c, 0x78, 0x20, 0x25, 0x6c, 0x78, 0x0a, 
+0x00, 0x76, 0x64, 0x73, 0x6f, 0x3a, 0x20, 0x42, 
+0x61, 0x73, 0x65, 0x20, 0x61, 0x64, 0x64, 0x72, 
+0x65, 0x73, 0x73, 0x20, 0x25, 0x6c, 0x78, 0x0a, 
+0x00, 0x76, 0x64, 0x73, 0x6f, 0x3a, 0x20, 0x4e, 
+0x6f, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20, 0x61, 
+0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x66, 
+0x6f, 0x75, 0x6e, 0x64, 0x0a, 0x00, 0x61, 0x72, 
+0x63, 0x68, 0x2f, 0x78, 0x38, 0x36, 0x2f, 0x76, 
+0x64, 0x73, 0x6f, 0x2d, 0x70, 0x69, 0x65, 0x2e, 
+0x63, 0x00, 0x76, 0x64, 0x73, 0x6f, 0x3a, 0x20, 
+0x52, 0x65, 0x6d, 0x61, 0x70, 0x20, 0x25, 0x73, 
+0x20, 0x25, 0x6c, 0x78, 0x20, 0x2d, 0x3e, 0x20, 
+0x25, 0x6c, 0x78, 0x0a, 0x00, 0x30, 0x31, 0x32, 
+0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 
+0x62, 0x63, 0x64, 0x65, 0x66, 0x00, 0x70, 0x69, 
+0x65, 0x2f, 0x75, 0x74, 0x69, 0x6c, 0x2e, 0x63, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+0x20, 0x73, 0x65, 0x74, 0x20, 0x53, 0x45, 0x43, 
+0x55, 0x52, 0x45, 0x5f, 0x4e, 0x4f, 0x5f, 0x53, 
+0x45, 0x54, 0x55, 0x49, 0x44, 0x5f, 0x46, 0x49, 
+0x58, 0x55, 0x50, 0x3a, 0x20, 0x25, 0x64, 0x0a, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+0x20, 0x73, 0x65, 0x74, 0x20, 0x72, 0x65, 0x61, 
+0x6c, 0x2c, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 
+0x74, 0x69, 0x76, 0x65, 0x20, 0x61, 0x6e, 0x64, 
+0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x20, 0x75, 
+0x73, 0x65, 0x72, 0x20, 0x49, 0x44, 0x3a, 0x20, 
+0x25, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+0x20, 0x73, 0x65, 0x74, 0x20, 0x66, 0x73, 0x75, 
+0x69, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+0x20, 0x73, 0x65, 0x74, 0x20, 0x72, 0x65, 0x61, 
+0x6c, 0x2c, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 
+0x74, 0x69, 0x76, 0x65, 0x20, 0x61, 0x6e, 0x64, 
+0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x20, 0x67, 
+0x72, 0x6f, 0x75, 0x70, 0x20, 0x49, 0x44, 0x3a, 
+0x20, 0x25, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+0x20, 0x73, 0x65, 0x74, 0x20, 0x66, 0x73, 0x67, 
+0x69, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+0x20, 0x73, 0x65, 0x74, 0x20, 0x50, 0x52, 0x5f, 
+0x53, 0x45, 0x54, 0x5f, 0x53, 0x45, 0x43, 0x55, 
+0x52, 0x45, 0x42, 0x49, 0x54, 0x53, 0x3a, 0x20, 
+0x25, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+0x20, 0x64, 0x72, 0x6f, 0x70, 0x20, 0x63, 0x61, 
+0x70, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 
+0x20, 0x25, 0x64, 0x3a, 0x20, 0x25, 0x64, 0x0a, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+0x20, 0x72, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x65, 
+0x20, 0x63, 0x61, 0x70, 0x61, 0x62, 0x69, 0x6c, 
+0x69, 0x74, 0x69, 0x65, 0x73, 0x3a, 0x20, 0x25, 
+0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+0x20, 0x73, 0x65, 0x6e, 0x64, 0x20, 0x73, 0x69, 
+0x67, 0x69, 0x6e, 0x66, 0x6f, 0x20, 0x25, 0x64, 
+0x20, 0x25, 0x78, 0x20, 0x77, 0x69, 0x74, 0x68, 
+0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x25, 0x64, 
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+0x20, 0x6d, 0x61, 0x70, 0x20, 0x61, 0x20, 0x67, 
+0x75, 0x61, 0x72, 0x64, 0x20, 0x70, 0x61, 0x67, 
+0x65, 0x20, 0x25, 0x6c, 0x78, 0x20, 0x28, 0x25, 
+0x6c, 0x78, 0x29, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 
+0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 
+0x28, 0x25, 0x6c, 0x78, 0x29, 0x0a, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+0x20, 0x72, 0x65, 0x6d, 0x61, 0x70, 0x20, 0x25, 
+0x6c, 0x78, 0x20, 0x2d, 0x3e, 0x20, 0x25, 0x6c, 
+0x78, 0x20, 0x28, 0x25, 0x6c, 0x78, 0x29, 0x0a, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+0x20, 0x72, 0x65, 0x6d, 0x61, 0x70, 0x20, 0x25, 
+0x6c, 0x78, 0x20, 0x2d, 0x3e, 0x20, 0x25, 0x6c, 
+0x78, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x46, 
+0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 
+0x20, 0x72, 0x65, 0x63, 0x6f, 0x76, 0x65, 0x72, 
+0x20, 0x66, 0x75, 0x74, 0x65, 0x78, 0x20, 0x72, 
+0x6f, 0x62, 0x75, 0x73, 0x74, 0x20, 0x6c, 0x69, 
+0x73, 0x74, 0x3a, 0x20, 0x25, 0x64, 0x0a, 0x00, 
+0x52, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x69, 0x6e, 
+0x67, 0x20, 0x73, 0x63, 0x68, 0x65, 0x64, 0x75, 
+0x6c, 0x65, 0x72, 0x20, 0x70, 0x61, 0x72, 0x61, 
+0x6d, 0x73, 0x20, 0x25, 0x64, 0x2e, 0x25, 0x64, 
+0x2e, 0x25, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+0x25, 0x6c, 0x64, 0x3a, 0x20, 0x43, 0x6f, 0x6c, 
+0x6c, 0x65, 0x63, 0x74, 0x20, 0x61, 0x20, 0x7a, 
+0x6f, 0x6d, 0x62, 0x69, 0x65, 0x20, 0x77, 0x69, 
+0x74, 0x68, 0x20, 0x28, 0x70, 0x69, 0x64, 0x20, 
+0x25, 0x64, 0x2c, 0x20, 0x25, 0x64, 0x29, 0x0a, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x54, 
+0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x70, 0x69, 
+0x64, 0x20, 0x6d, 0x69, 0x73, 0x6d, 0x61, 0x74, 
+0x63, 0x68, 0x20, 0x25, 0x64, 0x2f, 0x25, 0x64, 
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x73, 
+0x69, 0x67, 0x6e, 0x61, 0x6c, 0x73, 0x20, 0x25, 
+0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x52, 
+0x65, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x72, 0x20, 
+0x61, 0x62, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 
+0x20, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 
+0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72, 
+0x20, 0x25, 0x6c, 0x64, 0x0a, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+0x20, 0x75, 0x6e, 0x6d, 0x61, 0x70, 0x20, 0x28, 
+0x25, 0x70, 0x2d, 0x25, 0x70, 0x29, 0x3a, 0x20, 
+0x25, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x72, 0x65, 0x73, 
+0x74, 0x6f, 0x72, 0x65, 0x20, 0x25, 0x6c, 0x78, 
+0x20, 0x6d, 0x61, 0x70, 0x70, 0x69, 0x6e, 0x67, 
+0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x25, 0x6c, 
+0x78, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x6d, 
+0x61, 0x64, 0x76, 0x69, 0x73, 0x65, 0x28, 0x25, 
+0x6c, 0x78, 0x2c, 0x20, 0x25, 0x6c, 0x75, 0x2c, 
+0x20, 0x25, 0x6c, 0x64, 0x29, 0x20, 0x66, 0x61, 
+0x69, 0x6c, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 
+0x68, 0x20, 0x25, 0x6c, 0x64, 0x0a, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x63, 0x72, 0x65, 
+0x61, 0x74, 0x65, 0x20, 0x75, 0x73, 0x65, 0x72, 
+0x66, 0x61, 0x75, 0x6c, 0x74, 0x66, 0x64, 0x3a, 
+0x20, 0x25, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x6e, 0x65, 0x67, 
+0x6f, 0x74, 0x69, 0x61, 0x74, 0x65, 0x20, 0x75, 
+0x73, 0x65, 0x72, 0x66, 0x61, 0x75, 0x6c, 0x74, 
+0x66, 0x64, 0x20, 0x41, 0x50, 0x49, 0x3a, 0x20, 
+0x25, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x72, 0x65, 0x67, 
+0x69, 0x73, 0x74, 0x65, 0x72, 0x20, 0x25, 0x6c, 
+0x78, 0x2d, 0x25, 0x6c, 0x78, 0x20, 0x69, 0x6e, 
+0x20, 0x75, 0x73, 0x65, 0x72, 0x66, 0x61, 0x75, 
+0x6c, 0x74, 0x66, 0x64, 0x3a, 0x20, 0x25, 0x64, 
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x73, 0x65, 0x6e, 
+0x64, 0x20, 0x75, 0x73, 0x65, 0x72, 0x66, 0x61, 
+0x75, 0x6c, 0x74, 0x66, 0x64, 0x20, 0x74, 0x6f, 
+0x20, 0x6c, 0x61, 0x7a, 0x79, 0x20, 0x70, 0x61, 
+0x67, 0x65, 0x73, 0x20, 0x64, 0x61, 0x65, 0x6d, 
+0x6f, 0x6e, 0x3a, 0x20, 0x25, 0x64, 0x0a, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x70, 
+0x72, 0x63, 0x74, 0x6c, 0x20, 0x66, 0x61, 0x69, 
+0x6c, 0x65, 0x64, 0x20, 0x40, 0x25, 0x64, 0x20, 
+0x77, 0x69, 0x74, 0x68, 0x20, 0x25, 0x6c, 0x64, 
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x72, 0x65, 0x73, 
+0x74, 0x6f, 0x72, 0x65, 0x20, 0x45, 0x58, 0x45, 
+0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x28, 0x25, 
+0x64, 0x29, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x6c, 0x6f, 0x63, 
+0x6b, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x70, 
+0x69, 0x64, 0x20, 0x25, 0x64, 0x0a, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x73, 0x65, 0x74, 
+0x20, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x70, 0x69, 
+0x64, 0x20, 0x25, 0x6c, 0x64, 0x2f, 0x25, 0x73, 
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x75, 0x6e, 0x6c, 
+0x6f, 0x63, 0x6b, 0x20, 0x6c, 0x61, 0x73, 0x74, 
+0x5f, 0x70, 0x69, 0x64, 0x20, 0x25, 0x6c, 0x64, 
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x63, 0x72, 0x65, 
+0x61, 0x74, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x69, 
+0x78, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x72, 0x20, 
+0x2d, 0x20, 0x25, 0x64, 0x0a, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x72, 0x65, 0x6d, 
+0x6f, 0x76, 0x65, 0x20, 0x74, 0x65, 0x6d, 0x70, 
+0x6f, 0x72, 0x61, 0x74, 0x79, 0x20, 0x70, 0x6f, 
+0x73, 0x69, 0x78, 0x20, 0x74, 0x69, 0x6d, 0x65, 
+0x72, 0x20, 0x25, 0x6c, 0x78, 0x0a, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x63, 0x72, 0x65, 
+0x61, 0x74, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 
+0x72, 0x73, 0x2c, 0x20, 0x6b, 0x65, 0x72, 0x6e, 
+0x65, 0x6c, 0x20, 0x64, 0x6f, 0x6e, 0x27, 0x74, 
+0x20, 0x67, 0x69, 0x76, 0x65, 0x20, 0x74, 0x68, 
+0x65, 0x6d, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x65, 
+0x71, 0x75, 0x65, 0x6e, 0x74, 0x6c, 0x79, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x72, 0x65, 0x73, 
+0x74, 0x6f, 0x72, 0x65, 0x20, 0x70, 0x6f, 0x73, 
+0x69, 0x78, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x72, 
+0x73, 0x20, 0x25, 0x6c, 0x64, 0x0a, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x55, 
+0x6e, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 
+0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x73, 
+0x69, 0x67, 0x6e, 0x61, 0x6c, 0x73, 0x20, 0x25, 
+0x6c, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x70, 0x69, 0x65, 0x3a, 0x20, 0x54, 0x75, 0x72, 
+0x6e, 0x69, 0x6e, 0x67, 0x20, 0x72, 0x65, 0x70, 
+0x61, 0x69, 0x72, 0x20, 0x6f, 0x66, 0x66, 0x20, 
+0x66, 0x6f, 0x72, 0x20, 0x25, 0x64, 0x20, 0x28, 
+0x72, 0x65, 0x75, 0x73, 0x65, 0x20, 0x25, 0x64, 
+0x29, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x46, 
+0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 
+0x20, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6f, 0x66, 
+0x66, 0x20, 0x72, 0x65, 0x70, 0x61, 0x69, 0x72, 
+0x20, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x6f, 0x6e, 
+0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20, 
+0x28, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x25, 0x6d, 
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x46, 
+0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 
+0x20, 0x72, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x65, 
+0x20, 0x6f, 0x66, 0x20, 0x53, 0x4f, 0x5f, 0x52, 
+0x45, 0x55, 0x53, 0x45, 0x41, 0x44, 0x44, 0x52, 
+0x20, 0x6f, 0x6e, 0x20, 0x73, 0x6f, 0x63, 0x6b, 
+0x65, 0x74, 0x20, 0x28, 0x25, 0x64, 0x29, 0x3a, 
+0x20, 0x25, 0x6d, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x52, 
+0x65, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x72, 0x20, 
+0x66, 0x61, 0x69, 0x6c, 0x20, 0x25, 0x6c, 0x64, 
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x76, 0x64, 0x73, 0x6f, 0x3a, 0x20, 0x6a, 0x6d, 
+0x70, 0x3a, 0x20, 0x25, 0x6c, 0x78, 0x2f, 0x25, 
+0x6c, 0x78, 0x20, 0x2d, 0x3e, 0x20, 0x25, 0x6c, 
+0x78, 0x2f, 0x25, 0x6c, 0x78, 0x20, 0x28, 0x69, 
+0x6e, 0x64, 0x65, 0x78, 0x20, 0x25, 0x64, 0x29, 
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x76, 
+0x64, 0x73, 0x6f, 0x3a, 0x20, 0x53, 0x65, 0x63, 
+0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6e, 0x61, 0x6d, 
+0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e, 
+0x6f, 0x74, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x76, 0x64, 0x73, 0x6f, 0x3a, 0x20, 0x4e, 0x6f, 
+0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 
+0x64, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 
+0x6e, 0x73, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x76, 0x64, 0x73, 0x6f, 0x3a, 0x20, 0x45, 0x6c, 
+0x66, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 
+0x20, 0x6d, 0x61, 0x67, 0x69, 0x63, 0x20, 0x6d, 
+0x69, 0x73, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x0a, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x76, 
+0x64, 0x73, 0x6f, 0x3a, 0x20, 0x55, 0x6e, 0x61, 
+0x62, 0x6c, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x72, 
+0x65, 0x6d, 0x61, 0x70, 0x20, 0x25, 0x6c, 0x78, 
+0x20, 0x2d, 0x3e, 0x20, 0x25, 0x6c, 0x78, 0x20, 
+0x25, 0x6c, 0x78, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x76, 
+0x64, 0x73, 0x6f, 0x3a, 0x20, 0x46, 0x61, 0x69, 
+0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x75, 
+0x6e, 0x6d, 0x61, 0x70, 0x20, 0x25, 0x73, 0x0a, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x76, 0x64, 0x73, 0x6f, 0x3a, 0x20, 0x52, 0x75, 
+0x6e, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x76, 0x64, 
+0x73, 0x6f, 0x20, 0x6d, 0x69, 0x73, 0x6d, 0x61, 
+0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x64, 0x75, 
+0x6d, 0x70, 0x65, 0x65, 0x2c, 0x20, 0x67, 0x65, 
+0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x70, 
+0x72, 0x6f, 0x78, 0x79, 0x0a, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x76, 
+0x64, 0x73, 0x6f, 0x3a, 0x20, 0x46, 0x61, 0x69, 
+0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x70, 
+0x72, 0x6f, 0x78, 0x69, 0x66, 0x79, 0x20, 0x64, 
+0x75, 0x6d, 0x70, 0x65, 0x65, 0x20, 0x63, 0x6f, 
+0x6e, 0x74, 0x65, 0x6e, 0x74, 0x73, 0x0a, 0x00, 
+0x76, 0x64, 0x73, 0x6f, 0x3a, 0x20, 0x52, 0x75, 
+0x6e, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x76, 0x64, 
+0x73, 0x6f, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 
+0x65, 0x73, 0x20, 0x64, 0x75, 0x6d, 0x70, 0x65, 
+0x65, 0x2c, 0x20, 0x72, 0x65, 0x6d, 0x61, 0x70, 
+0x20, 0x69, 0x6e, 0x70, 0x6c, 0x61, 0x63, 0x65, 
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x6f, 0x70, 0x65, 
+0x6e, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 
+0x6f, 0x72, 0x79, 0x20, 0x25, 0x73, 0x3a, 0x20, 
+0x25, 0x64, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x64, 0x65, 0x74, 
+0x61, 0x63, 0x68, 0x20, 0x6d, 0x6f, 0x75, 0x6e, 
+0x74, 0x20, 0x25, 0x73, 0x3a, 0x20, 0x25, 0x64, 
+0x0a, 0x3a, 0x20, 0x25, 0x6d, 0x0a, 0x00, 0x00, 
+0x45, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x28, 0x25, 
+0x73, 0x3a, 0x25, 0x64, 0x29, 0x3a, 0x20, 0x43, 
+0x61, 0x6e, 0x27, 0x74, 0x20, 0x72, 0x65, 0x6d, 
+0x6f, 0x76, 0x65, 0x20, 0x74, 0x6d, 0x70, 0x20, 
+0x64, 0x69, 0x72, 0x20, 0x25, 0x73, 0x3a, 0x20, 
+0x25, 0x64, 0x0a, 0x3a, 0x20, 0x25, 0x6d, 0x0a, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x70, 0x69, 0x65, 0x3a, 0x30, 0x78, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+
+};
+
+#endif /* __restorer_h__ */
@@ -28,6 +28,8 @@
 #include "crtools.h"
 #include "lock.h"
 #include "restorer.h"
+#include "uffd.h"
+#include "util-pie.h"
 
 #include "protobuf/creds.pb-c.h"
 
@@ -529,6 +531,56 @@ void __export_unmap(void)
 	 */
 }
 
+/*
+ * Register lazy VMAs in a userfaultfd and hand it over to the
+ * lazy-pages daemon, which will populate them on faults.
+ */
+static int enable_lazy_pages(struct task_restore_args *args)
+{
+	struct uffdio_api api = { .api = UFFD_API, .features = LAZY_PAGES_UFFD_FEATURES, };
+	int i, uffd, ret = -1;
+
+	uffd = sys_userfaultfd(0);
+	if (uffd < 0) {
+		pr_err("Can't create userfaultfd: %d\n", uffd);
+		goto out;
+	}
+
+	ret = sys_ioctl(uffd, UFFDIO_API, (unsigned long)&api);
+	if (ret) {
+		pr_err("Can't negotiate userfaultfd API: %d\n", ret);
+		goto out_close;
+	}
+
+	for (i = 0; i < args->nr_vmas; i++) {
+		VmaEntry *vma_entry = args->tgt_vmas + i;
+		struct uffdio_register reg = {
+			.range.start	= vma_entry->start,
+			.range.len	= vma_entry_len(vma_entry),
+			.mode		= UFFDIO_REGISTER_MODE_MISSING,
+		};
+
+		if (!vma_entry_is(vma_entry, VMA_AREA_LAZY))
+			continue;
+
+		ret = sys_ioctl(uffd, UFFDIO_REGISTER, (unsigned long)&reg);
+		if (ret) {
+			pr_err("Can't register %"PRIx64"-%"PRIx64" in userfaultfd: %d\n",
+					vma_entry->start, vma_entry->end, ret);
+			goto out_close;
+		}
+	}
+
+	ret = send_fd(args->lazy_pages_sk, NULL, 0, uffd);
+	if (ret)
+		pr_err("Can't send userfaultfd to lazy pages daemon: %d\n", ret);
+out_close:
+	sys_close(uffd);
+out:
+	sys_close(args->lazy_pages_sk);
+	return ret;
+}
+
 /*
  * This function unmaps all VMAs, which don't belong to
  * the restored process or the restorer.
@@ -763,6 +815,9 @@ long __export_restore_task(struct task_restore_args *args)
 		}
 	}
 
+	if (args->lazy_pages_sk >= 0 && enable_lazy_pages(args))
+		goto core_restore_end;
+
 	ret = 0;
 
 	/*
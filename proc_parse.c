@@ -66,22 +66,150 @@ int parse_cpuinfo_features(int (*handler)(char *tok))
 	return 0;
 }
 
-/* check the @line starts with "%lx-%lx" format */
-static bool is_vma_range_fmt(char *line)
+/*
+ * (s)maps of a big task is megabytes of text, so it's read in big
+ * chunks and cut into lines in place, nothing is allocated.
+ */
+struct proc_lines {
+	int	fd;
+	char	*pos;
+	char	*end;
+};
+
+static struct {
+	char buf[16 * PAGE_SIZE];
+	char end; /* '\0' */
+} __lines_buf;
+
+#define LINES_BUF_SIZE sizeof(__lines_buf.buf)
+
+static int proc_lines_next(struct proc_lines *l, char **line)
+{
+	char *nl;
+	size_t len;
+	ssize_t ret;
+
+	while (1) {
+		nl = memchr(l->pos, '\n', l->end - l->pos);
+		if (nl) {
+			*nl = '\0';
+			*line = l->pos;
+			l->pos = nl + 1;
+			return 1;
+		}
+
+		len = l->end - l->pos;
+		if (len == LINES_BUF_SIZE) {
+			pr_err("Too long line in proc file\n");
+			return -1;
+		}
+
+		memmove(__lines_buf.buf, l->pos, len);
+		l->pos = __lines_buf.buf;
+		l->end = l->pos + len;
+
+		ret = read(l->fd, l->end, LINES_BUF_SIZE - len);
+		if (ret < 0) {
+			pr_perror("Can't read proc file");
+			return -1;
+		}
+
+		if (ret == 0) {
+			if (!len)
+				return 0;
+			/* The last line without a \n */
+			*l->end = '\0';
+			*line = l->pos;
+			l->pos = l->end;
+			return 1;
+		}
+
+		l->end += ret;
+	}
+}
+
+static inline unsigned int hex_digit_val(char c)
 {
-	while (*line && is_hex_digit(*line))
-		line++;
+	if (c <= '9')
+		return c - '0';
+	return (c | 0x20) - 'a' + 10;
+}
+
+static char *get_hex(char *p, unsigned long *v)
+{
+	char *s = p;
+
+	*v = 0;
+	while (is_hex_digit(*p))
+		*v = (*v << 4) | hex_digit_val(*p++);
 
-	if (*line++ != '-')
-		return false;
+	return p == s ? NULL : p;
+}
 
-	while (*line && is_hex_digit(*line))
-		line++;
+static char *get_dec(char *p, unsigned long *v)
+{
+	char *s = p;
 
-	if (*line++ != ' ')
-		return false;
+	*v = 0;
+	while (*p >= '0' && *p <= '9')
+		*v = *v * 10 + (*p++ - '0');
 
-	return true;
+	return p == s ? NULL : p;
+}
+
+struct vma_range {
+	unsigned long	start, end;
+	unsigned long	pgoff, ino;
+	unsigned long	dev_maj, dev_min;
+	char		r, w, x, s;
+	char		*path;	/* "" for anonymous */
+};
+
+/*
+ * Parses the "%lx-%lx %c%c%c%c %lx %x:%x %lu path" line, returns
+ * 0 if it's not a range one (e.g. one of smaps fields).
+ */
+static int parse_vma_range(char *line, struct vma_range *v)
+{
+	char *p = line;
+
+	p = get_hex(p, &v->start);
+	if (!p || *p++ != '-')
+		return 0;
+	p = get_hex(p, &v->end);
+	if (!p || *p++ != ' ')
+		return 0;
+
+	if (!p[0] || !p[1] || !p[2] || !p[3] || p[4] != ' ')
+		goto err;
+	v->r = p[0];
+	v->w = p[1];
+	v->x = p[2];
+	v->s = p[3];
+	p += 5;
+
+	p = get_hex(p, &v->pgoff);
+	if (!p || *p++ != ' ')
+		goto err;
+	p = get_hex(p, &v->dev_maj);
+	if (!p || *p++ != ':')
+		goto err;
+	p = get_hex(p, &v->dev_min);
+	if (!p || *p++ != ' ')
+		goto err;
+	p = get_dec(p, &v->ino);
+	if (!p)
+		goto err;
+
+	while (*p == ' ')
+		p++;
+	v->path = p;
+
+	return 1;
+
+err:
+	pr_err("Can't parse: %s\n", line);
+	return -1;
 }
 
 static int parse_vmflags(char *buf, struct vma_area *vma_area)
@@ -142,43 +270,58 @@ static inline int is_anon_shmem_map(dev_t dev)
 	return kerndat_shmem_dev == dev;
 }
 
-int parse_smaps(pid_t pid, struct vm_area_list *vma_area_list, bool use_map_files)
+int parse_maps(pid_t pid, struct vm_area_list *vma_area_list, unsigned int flags)
 {
 	struct vma_area *vma_area = NULL;
-	unsigned long start, end, pgoff;
+	struct proc_lines lines = { .fd = -1, };
+	struct vma_range vr;
 	bool prev_growsdown = false;
-	unsigned long ino;
-	char r, w, x, s;
-	int dev_maj, dev_min;
+	long mem_kb = -1;
+	unsigned long start;
 	int ret = -1;
 
 	DIR *map_files_dir = NULL;
-	FILE *smaps = NULL;
 
 	vma_area_list->nr = 0;
 	vma_area_list->longest = 0;
 	vma_area_list->priv_size = 0;
 	INIT_LIST_HEAD(&vma_area_list->h);
 
-	smaps = fopen_proc(pid, "smaps");
-	if (!smaps)
+	/*
+	 * The smaps makes kernel walk the page tables to count Rss
+	 * and friends, but it's the only place to get VmFlags from.
+	 */
+	if (flags & PROC_VMAS_VMFLAGS)
+		lines.fd = open_proc(pid, "smaps");
+	else
+		lines.fd = open_proc(pid, "maps");
+	if (lines.fd < 0)
 		goto err;
+	lines.pos = lines.end = __lines_buf.buf;
 
-	if (use_map_files) {
+	if (flags & PROC_VMAS_MAP_FILES) {
 		map_files_dir = opendir_proc(pid, "map_files");
 		if (!map_files_dir) /* old kernel? */
 			goto err;
 	}
 
 	while (1) {
-		int num;
-		char file_path[6];
-		bool eof;
+		char *line;
+		int eof, range = 0;
 
-		eof = (fgets(buf, BUF_SIZE, smaps) == NULL);
+		eof = proc_lines_next(&lines, &line);
+		if (eof < 0)
+			goto err;
+		eof = !eof;
 
-		if (!eof && !is_vma_range_fmt(buf)) {
-			if (!strncmp(buf, "Nonlinear", 9)) {
+		if (!eof) {
+			range = parse_vma_range(line, &vr);
+			if (range < 0)
+				goto err;
+		}
+
+		if (!eof && !range) {
+			if (!strncmp(line, "Nonlinear", 9)) {
 				BUG_ON(!vma_area);
 				pr_err("Nonlinear mapping found %016"PRIx64"-%016"PRIx64"\n",
 				       vma_area->vma.start, vma_area->vma.end);
@@ -188,16 +331,30 @@ int parse_smaps(pid_t pid, struct vm_area_list *vma_area_list, bool use_map_file
 				 */
 				vma_area = NULL;
 				goto err;
-			} else if (!strncmp(buf, "VmFlags: ", 9)) {
+			} else if (!strncmp(line, "VmFlags: ", 9)) {
 				BUG_ON(!vma_area);
-				if (parse_vmflags(&buf[9], vma_area))
+				if (parse_vmflags(&line[9], vma_area))
 					goto err;
 				continue;
+			} else if (!strncmp(line, "Rss:", 4) ||
+				   !strncmp(line, "Swap:", 5)) {
+				unsigned long kb;
+				char *p = strchr(line, ':') + 1;
+
+				while (*p == ' ')
+					p++;
+				if (get_dec(p, &kb))
+					mem_kb = (mem_kb < 0 ? 0 : mem_kb) + kb;
+				continue;
 			} else
 				continue;
 		}
 
 		if (vma_area) {
+			/* Lets page dumping skip the VMA without reading pagemap */
+			vma_area->no_pages = (mem_kb == 0);
+			mem_kb = -1;
+
 			/* If we've split the stack vma, only the lowest one has the guard page. */
 			if ((vma_area->vma.flags & MAP_GROWSDOWN) && !prev_growsdown)
 				vma_area->vma.start -= PAGE_SIZE; /* Guard page */
@@ -221,20 +378,17 @@ int parse_smaps(pid_t pid, struct vm_area_list *vma_area_list, bool use_map_file
 		if (!vma_area)
 			goto err;
 
-		memset(file_path, 0, 6);
-		num = sscanf(buf, "%lx-%lx %c%c%c%c %lx %x:%x %lu %5s",
-			     &start, &end, &r, &w, &x, &s, &pgoff, &dev_maj,
-			     &dev_min, &ino, file_path);
-		if (num < 10) {
-			pr_err("Can't parse: %s\n", buf);
-			goto err;
-		}
+		start = vr.start;
 
-		if (map_files_dir) {
+		/*
+		 * Anonymous mappings have no map_files entries, so don't
+		 * waste a syscall on them.
+		 */
+		if (map_files_dir && (vr.ino || vr.dev_maj || vr.dev_min)) {
 			char path[32];
 
 			/* Figure out if it's file mapping */
-			snprintf(path, sizeof(path), "%lx-%lx", start, end);
+			snprintf(path, sizeof(path), "%lx-%lx", vr.start, vr.end);
 
 			/*
 			 * Note that we "open" it in dumper process space
@@ -260,36 +414,43 @@ int parse_smaps(pid_t pid, struct vm_area_list *vma_area_list, bool use_map_file
 			}
 		}
 
-		vma_area->vma.start	= start;
-		vma_area->vma.end	= end;
-		vma_area->vma.pgoff	= pgoff;
+		vma_area->vma.start	= vr.start;
+		vma_area->vma.end	= vr.end;
+		vma_area->vma.pgoff	= vr.pgoff;
 		vma_area->vma.prot	= PROT_NONE;
 
-		if (r == 'r')
+		if (vr.r == 'r')
 			vma_area->vma.prot |= PROT_READ;
-		if (w == 'w')
+		if (vr.w == 'w')
 			vma_area->vma.prot |= PROT_WRITE;
-		if (x == 'x')
+		if (vr.x == 'x')
 			vma_area->vma.prot |= PROT_EXEC;
 
-		if (s == 's')
+		if (vr.s == 's')
 			vma_area->vma.flags = MAP_SHARED;
-		else if (s == 'p')
+		else if (vr.s == 'p')
 			vma_area->vma.flags = MAP_PRIVATE;
 		else {
-			pr_err("Unexpected VMA met (%c)\n", s);
+			pr_err("Unexpected VMA met (%c)\n", vr.s);
 			goto err;
 		}
 
+		/*
+		 * Without VmFlags at hands at least the main stack
+		 * is known to grow down.
+		 */
+		if (!(flags & PROC_VMAS_VMFLAGS) && !strcmp(vr.path, "[stack]"))
+			vma_area->vma.flags |= MAP_GROWSDOWN;
+
 		if (vma_area->vma.status != 0) {
 			continue;
-		} else if (strstr(buf, "[vsyscall]") || strstr(buf, "[vectors]")) {
+		} else if (!strcmp(vr.path, "[vsyscall]") || !strcmp(vr.path, "[vectors]")) {
 			vma_area->vma.status |= VMA_AREA_VSYSCALL;
-		} else if (strstr(buf, "[vdso]")) {
+		} else if (!strcmp(vr.path, "[vdso]")) {
 			vma_area->vma.status |= VMA_AREA_REGULAR;
 			if ((vma_area->vma.prot & VDSO_PROT) == VDSO_PROT)
 				vma_area->vma.status |= VMA_AREA_VDSO;
-		} else if (strstr(buf, "[heap]")) {
+		} else if (!strcmp(vr.path, "[heap]")) {
 			vma_area->vma.status |= VMA_AREA_REGULAR | VMA_AREA_HEAP;
 		} else {
 			vma_area->vma.status = VMA_AREA_REGULAR;
@@ -324,8 +485,8 @@ int parse_smaps(pid_t pid, struct vm_area_list *vma_area_list, bool use_map_file
 				vma_area->vma.status |= VMA_ANON_SHARED;
 				vma_area->vma.shmid = st_buf.st_ino;
 
-				if (!strcmp(file_path, "/SYSV")) {
-					pr_info("path: %s\n", file_path);
+				if (!strncmp(vr.path, "/SYSV", 5)) {
+					pr_info("path: %s\n", vr.path);
 					vma_area->vma.status |= VMA_AREA_SYSVIPC;
 				}
 			} else {
@@ -340,7 +501,7 @@ int parse_smaps(pid_t pid, struct vm_area_list *vma_area_list, bool use_map_file
 			 */
 			if (vma_area->vma.flags & MAP_SHARED) {
 				vma_area->vma.status |= VMA_ANON_SHARED;
-				vma_area->vma.shmid = ino;
+				vma_area->vma.shmid = vr.ino;
 			} else {
 				vma_area->vma.status |= VMA_ANON_PRIVATE;
 			}
@@ -352,8 +513,8 @@ int parse_smaps(pid_t pid, struct vm_area_list *vma_area_list, bool use_map_file
 	ret = 0;
 
 err:
-	if (smaps)
-		fclose(smaps);
+	if (lines.fd >= 0)
+		close(lines.fd);
 
 	if (map_files_dir)
 		closedir(map_files_dir);
@@ -1111,7 +1272,7 @@ static int parse_file_lock_buf(char *buf, struct file_lock *fl,
 
 int parse_file_locks(void)
 {
-	struct file_lock *fl;
+	struct file_lock *fl = NULL;
 
 	FILE	*fl_locks;
 	int	ret = 0;
@@ -1126,15 +1287,17 @@ int parse_file_locks(void)
 	while (fgets(buf, BUF_SIZE, fl_locks)) {
 		is_blocked = strstr(buf, "->") != NULL;
 
-		fl = alloc_file_lock();
+		/* Locks of other tasks don't need one, so it's reused */
 		if (!fl) {
-			pr_perror("Alloc file lock failed!");
-			ret = -1;
-			goto err;
+			fl = alloc_file_lock();
+			if (!fl) {
+				pr_perror("Alloc file lock failed!");
+				ret = -1;
+				goto err;
+			}
 		}
 
 		if (parse_file_lock_buf(buf, fl, is_blocked)) {
-			xfree(fl);
 			ret = -1;
 			goto err;
 		}
@@ -1145,7 +1308,6 @@ int parse_file_locks(void)
 			 * into dump, so we only collect file locks
 			 * belong to these tasks.
 			 */
-			xfree(fl);
 			continue;
 		}
 
@@ -1160,7 +1322,6 @@ int parse_file_locks(void)
 			 */
 			pr_perror("We have a blocked file lock!");
 			ret = -1;
-			xfree(fl);
 			goto err;
 		}
 
@@ -1170,9 +1331,11 @@ int parse_file_locks(void)
 			fl->start, fl->end);
 
 		list_add_tail(&fl->list, &file_lock_list);
+		fl = NULL;
 	}
 
 err:
+	xfree(fl);
 	fclose(fl_locks);
 	return ret;
 }
@@ -534,7 +534,7 @@ int do_pb_read_one(int fd, void **pobj, int type, bool eof)
 
 	*pobj = NULL;
 
-	ret = read(fd, &size, sizeof(size));
+	ret = img_buf_read(fd, &size, sizeof(size));
 	if (ret == 0) {
 		if (eof) {
 			return 0;
@@ -557,7 +557,7 @@ int do_pb_read_one(int fd, void **pobj, int type, bool eof)
 			goto err;
 	}
 
-	ret = read(fd, buf, size);
+	ret = img_buf_read(fd, buf, size);
 	if (ret < 0) {
 		pr_perror("Can't read %d bytes from file %s",
 			  size, image_name(fd));
@@ -588,7 +588,8 @@ err:
 /*
  * Writes PB record (header + packed object pointed by @obj)
  * to file @fd, using @getpksize to get packed size and @pack
- * to implement packing
+ * to implement packing. The header and the object go in one
+ * write.
  *
  *  0 on success
  * -1 on error
@@ -606,29 +607,24 @@ int pb_write_one(int fd, void *obj, int type)
 	}
 
 	size = cr_pb_descs[type].getpksize(obj);
-	if (size > (u32)sizeof(local)) {
-		buf = xmalloc(size);
+	if (size + sizeof(size) > sizeof(local)) {
+		buf = xmalloc(size + sizeof(size));
 		if (!buf)
 			goto err;
 	}
 
-	packed = cr_pb_descs[type].pack(obj, buf);
+	packed = cr_pb_descs[type].pack(obj, buf + sizeof(size));
 	if (packed != size) {
 		pr_err("Failed packing PB object %p\n", obj);
 		goto err;
 	}
 
-	ret = write(fd, &size, sizeof(size));
-	if (ret != sizeof(size)) {
-		ret = -1;
-		pr_perror("Can't write %d bytes", (int)sizeof(size));
-		goto err;
-	}
+	memcpy(buf, &size, sizeof(size));
 
-	ret = write(fd, buf, size);
-	if (ret != size) {
+	ret = img_buf_write(fd, buf, size + sizeof(size));
+	if (ret != size + sizeof(size)) {
 		ret = -1;
-		pr_perror("Can't write %d bytes", size);
+		pr_perror("Can't write %d bytes", (int)(size + sizeof(size)));
 		goto err;
 	}
 
@@ -656,6 +652,11 @@ int collect_image(struct collect_image_info *cinfo)
 			return -1;
 	}
 
+	if (img_buf_attach(fd, O_RSTR)) {
+		close(fd);
+		return -1;
+	}
+
 	if (cinfo->flags & COLLECT_SHARED) {
 		o_alloc = shmalloc;
 		o_free = shfree_last;
@@ -690,7 +691,7 @@ int collect_image(struct collect_image_info *cinfo)
 			cr_pb_descs[cinfo->pb_type].free(msg, NULL);
 	}
 
-	close(fd);
+	close_image(fd);
 	pr_debug(" `- ... done\n");
 	return ret;
 }
@@ -0,0 +1,88 @@
+#ifndef __PB_CORE_X86__
+#define __PB_CORE_X86__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _UserX86RegsEntry UserX86RegsEntry;
+typedef struct _UserX86XsaveEntry UserX86XsaveEntry;
+typedef struct _UserX86FpregsEntry UserX86FpregsEntry;
+typedef struct _ThreadInfoX86 ThreadInfoX86;
+struct _UserX86RegsEntry { ProtobufCMessage base;
+ uint64_t r15;
+ uint64_t r14;
+ uint64_t r13;
+ uint64_t r12;
+ uint64_t bp;
+ uint64_t bx;
+ uint64_t r11;
+ uint64_t r10;
+ uint64_t r9;
+ uint64_t r8;
+ uint64_t ax;
+ uint64_t cx;
+ uint64_t dx;
+ uint64_t si;
+ uint64_t di;
+ uint64_t orig_ax;
+ uint64_t ip;
+ uint64_t cs;
+ uint64_t flags;
+ uint64_t sp;
+ uint64_t ss;
+ uint64_t fs_base;
+ uint64_t gs_base;
+ uint64_t ds;
+ uint64_t es;
+ uint64_t fs;
+ uint64_t gs;
+};
+#define USER_X86_REGS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_x86_regs_entry__descriptor) }
+extern const ProtobufCMessageDescriptor user_x86_regs_entry__descriptor;
+void user_x86_regs_entry__init(UserX86RegsEntry *m);
+size_t user_x86_regs_entry__get_packed_size(const UserX86RegsEntry *m);
+size_t user_x86_regs_entry__pack(const UserX86RegsEntry *m, uint8_t *out);
+UserX86RegsEntry *user_x86_regs_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void user_x86_regs_entry__free_unpacked(UserX86RegsEntry *m, ProtobufCAllocator *a);
+struct _UserX86XsaveEntry { ProtobufCMessage base;
+ uint64_t xstate_bv;
+ size_t n_ymmh_space; uint32_t *ymmh_space;
+};
+#define USER_X86_XSAVE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_x86_xsave_entry__descriptor) }
+extern const ProtobufCMessageDescriptor user_x86_xsave_entry__descriptor;
+void user_x86_xsave_entry__init(UserX86XsaveEntry *m);
+size_t user_x86_xsave_entry__get_packed_size(const UserX86XsaveEntry *m);
+size_t user_x86_xsave_entry__pack(const UserX86XsaveEntry *m, uint8_t *out);
+UserX86XsaveEntry *user_x86_xsave_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void user_x86_xsave_entry__free_unpacked(UserX86XsaveEntry *m, ProtobufCAllocator *a);
+struct _UserX86FpregsEntry { ProtobufCMessage base;
+ uint32_t cwd;
+ uint32_t swd;
+ uint32_t twd;
+ uint32_t fop;
+ uint64_t rip;
+ uint64_t rdp;
+ uint32_t mxcsr;
+ uint32_t mxcsr_mask;
+ size_t n_st_space; uint32_t *st_space;
+ size_t n_xmm_space; uint32_t *xmm_space;
+ size_t n_padding; uint32_t *padding;
+ UserX86XsaveEntry *xsave;
+};
+#define USER_X86_FPREGS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&user_x86_fpregs_entry__descriptor) }
+extern const ProtobufCMessageDescriptor user_x86_fpregs_entry__descriptor;
+void user_x86_fpregs_entry__init(UserX86FpregsEntry *m);
+size_t user_x86_fpregs_entry__get_packed_size(const UserX86FpregsEntry *m);
+size_t user_x86_fpregs_entry__pack(const UserX86FpregsEntry *m, uint8_t *out);
+UserX86FpregsEntry *user_x86_fpregs_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void user_x86_fpregs_entry__free_unpacked(UserX86FpregsEntry *m, ProtobufCAllocator *a);
+struct _ThreadInfoX86 { ProtobufCMessage base;
+ uint64_t clear_tid_addr;
+ UserX86RegsEntry *gpregs;
+ UserX86FpregsEntry *fpregs;
+};
+#define THREAD_INFO_X86__INIT { PROTOBUF_C_MESSAGE_INIT(&thread_info_x86__descriptor) }
+extern const ProtobufCMessageDescriptor thread_info_x86__descriptor;
+void thread_info_x86__init(ThreadInfoX86 *m);
+size_t thread_info_x86__get_packed_size(const ThreadInfoX86 *m);
+size_t thread_info_x86__pack(const ThreadInfoX86 *m, uint8_t *out);
+ThreadInfoX86 *thread_info_x86__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void thread_info_x86__free_unpacked(ThreadInfoX86 *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1,98 @@
+#ifndef __PB_CORE__
+#define __PB_CORE__
+#include <google/protobuf-c/protobuf-c.h>
+#include "core-x86.pb-c.h"
+#include "core-arm.pb-c.h"
+typedef struct _TaskCoreEntry TaskCoreEntry;
+typedef struct _TaskKobjIdsEntry TaskKobjIdsEntry;
+typedef struct _ThreadSasEntry ThreadSasEntry;
+typedef struct _ThreadCoreEntry ThreadCoreEntry;
+typedef struct _CoreEntry CoreEntry;
+typedef enum _CoreEntry__March { CORE_ENTRY__MARCH__UNKNOWN = 0, CORE_ENTRY__MARCH__X86_64 = 1, CORE_ENTRY__MARCH__ARM = 2 } CoreEntry__March;
+extern const ProtobufCEnumDescriptor core_entry__march__descriptor;
+struct _TaskCoreEntry { ProtobufCMessage base;
+ uint32_t task_state;
+ uint32_t exit_code;
+ uint32_t personality;
+ uint32_t flags;
+ uint64_t blk_sigset;
+ char *comm;
+};
+#define TASK_CORE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&task_core_entry__descriptor) }
+extern const ProtobufCMessageDescriptor task_core_entry__descriptor;
+void task_core_entry__init(TaskCoreEntry *m);
+size_t task_core_entry__get_packed_size(const TaskCoreEntry *m);
+size_t task_core_entry__pack(const TaskCoreEntry *m, uint8_t *out);
+TaskCoreEntry *task_core_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void task_core_entry__free_unpacked(TaskCoreEntry *m, ProtobufCAllocator *a);
+struct _TaskKobjIdsEntry { ProtobufCMessage base;
+ uint32_t vm_id;
+ uint32_t files_id;
+ uint32_t fs_id;
+ uint32_t sighand_id;
+ protobuf_c_boolean has_pid_ns_id;
+ uint32_t pid_ns_id;
+ protobuf_c_boolean has_net_ns_id;
+ uint32_t net_ns_id;
+ protobuf_c_boolean has_ipc_ns_id;
+ uint32_t ipc_ns_id;
+ protobuf_c_boolean has_uts_ns_id;
+ uint32_t uts_ns_id;
+ protobuf_c_boolean has_mnt_ns_id;
+ uint32_t mnt_ns_id;
+};
+#define TASK_KOBJ_IDS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&task_kobj_ids_entry__descriptor) }
+extern const ProtobufCMessageDescriptor task_kobj_ids_entry__descriptor;
+void task_kobj_ids_entry__init(TaskKobjIdsEntry *m);
+size_t task_kobj_ids_entry__get_packed_size(const TaskKobjIdsEntry *m);
+size_t task_kobj_ids_entry__pack(const TaskKobjIdsEntry *m, uint8_t *out);
+TaskKobjIdsEntry *task_kobj_ids_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void task_kobj_ids_entry__free_unpacked(TaskKobjIdsEntry *m, ProtobufCAllocator *a);
+struct _ThreadSasEntry { ProtobufCMessage base;
+ uint64_t ss_sp;
+ uint64_t ss_size;
+ uint32_t ss_flags;
+};
+#define THREAD_SAS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&thread_sas_entry__descriptor) }
+extern const ProtobufCMessageDescriptor thread_sas_entry__descriptor;
+void thread_sas_entry__init(ThreadSasEntry *m);
+size_t thread_sas_entry__get_packed_size(const ThreadSasEntry *m);
+size_t thread_sas_entry__pack(const ThreadSasEntry *m, uint8_t *out);
+ThreadSasEntry *thread_sas_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void thread_sas_entry__free_unpacked(ThreadSasEntry *m, ProtobufCAllocator *a);
+struct _ThreadCoreEntry { ProtobufCMessage base;
+ uint64_t futex_rla;
+ uint32_t futex_rla_len;
+ protobuf_c_boolean has_sched_nice;
+ int32_t sched_nice;
+ protobuf_c_boolean has_sched_policy;
+ uint32_t sched_policy;
+ protobuf_c_boolean has_sched_prio;
+ uint32_t sched_prio;
+ protobuf_c_boolean has_blk_sigset;
+ uint64_t blk_sigset;
+ ThreadSasEntry *sas;
+};
+#define THREAD_CORE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&thread_core_entry__descriptor) }
+extern const ProtobufCMessageDescriptor thread_core_entry__descriptor;
+void thread_core_entry__init(ThreadCoreEntry *m);
+size_t thread_core_entry__get_packed_size(const ThreadCoreEntry *m);
+size_t thread_core_entry__pack(const ThreadCoreEntry *m, uint8_t *out);
+ThreadCoreEntry *thread_core_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void thread_core_entry__free_unpacked(ThreadCoreEntry *m, ProtobufCAllocator *a);
+struct _CoreEntry { ProtobufCMessage base;
+ CoreEntry__March mtype;
+ ThreadInfoX86 *thread_info;
+ ThreadInfoArm *ti_arm;
+ TaskCoreEntry *tc;
+ TaskKobjIdsEntry *ids;
+ ThreadCoreEntry *thread_core;
+};
+#define CORE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&core_entry__descriptor) }
+extern const ProtobufCMessageDescriptor core_entry__descriptor;
+void core_entry__init(CoreEntry *m);
+size_t core_entry__get_packed_size(const CoreEntry *m);
+size_t core_entry__pack(const CoreEntry *m, uint8_t *out);
+CoreEntry *core_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void core_entry__free_unpacked(CoreEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1 @@
+#include "creds.pb-c.h"
@@ -0,0 +1,28 @@
+#ifndef __PB_CREDS__
+#define __PB_CREDS__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _CredsEntry CredsEntry;
+struct _CredsEntry { ProtobufCMessage base;
+ uint32_t uid;
+ uint32_t gid;
+ uint32_t euid;
+ uint32_t egid;
+ uint32_t suid;
+ uint32_t sgid;
+ uint32_t fsuid;
+ uint32_t fsgid;
+ size_t n_cap_inh; uint32_t *cap_inh;
+ size_t n_cap_prm; uint32_t *cap_prm;
+ size_t n_cap_eff; uint32_t *cap_eff;
+ size_t n_cap_bnd; uint32_t *cap_bnd;
+ uint32_t secbits;
+ size_t n_groups; uint32_t *groups;
+};
+#define CREDS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&creds_entry__descriptor) }
+extern const ProtobufCMessageDescriptor creds_entry__descriptor;
+void creds_entry__init(CredsEntry *m);
+size_t creds_entry__get_packed_size(const CredsEntry *m);
+size_t creds_entry__pack(const CredsEntry *m, uint8_t *out);
+CredsEntry *creds_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void creds_entry__free_unpacked(CredsEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1 @@
+#include "eventfd.pb-c.h"
@@ -0,0 +1,19 @@
+#ifndef __PB_EVENTFD__
+#define __PB_EVENTFD__
+#include <google/protobuf-c/protobuf-c.h>
+#include "fown.pb-c.h"
+typedef struct _EventfdFileEntry EventfdFileEntry;
+struct _EventfdFileEntry { ProtobufCMessage base;
+ uint32_t id;
+ uint32_t flags;
+ FownEntry *fown;
+ uint64_t counter;
+};
+#define EVENTFD_FILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&eventfd_file_entry__descriptor) }
+extern const ProtobufCMessageDescriptor eventfd_file_entry__descriptor;
+void eventfd_file_entry__init(EventfdFileEntry *m);
+size_t eventfd_file_entry__get_packed_size(const EventfdFileEntry *m);
+size_t eventfd_file_entry__pack(const EventfdFileEntry *m, uint8_t *out);
+EventfdFileEntry *eventfd_file_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void eventfd_file_entry__free_unpacked(EventfdFileEntry *m, ProtobufCAllocator *a);
+#endif
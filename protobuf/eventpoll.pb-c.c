@@ -0,0 +1 @@
+#include "eventpoll.pb-c.h"
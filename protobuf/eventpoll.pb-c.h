@@ -0,0 +1,32 @@
+#ifndef __PB_EVENTPOLL__
+#define __PB_EVENTPOLL__
+#include <google/protobuf-c/protobuf-c.h>
+#include "fown.pb-c.h"
+typedef struct _EventpollTfdEntry EventpollTfdEntry;
+typedef struct _EventpollFileEntry EventpollFileEntry;
+struct _EventpollTfdEntry { ProtobufCMessage base;
+ uint32_t id;
+ uint32_t tfd;
+ uint32_t events;
+ uint64_t data;
+};
+#define EVENTPOLL_TFD_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&eventpoll_tfd_entry__descriptor) }
+extern const ProtobufCMessageDescriptor eventpoll_tfd_entry__descriptor;
+void eventpoll_tfd_entry__init(EventpollTfdEntry *m);
+size_t eventpoll_tfd_entry__get_packed_size(const EventpollTfdEntry *m);
+size_t eventpoll_tfd_entry__pack(const EventpollTfdEntry *m, uint8_t *out);
+EventpollTfdEntry *eventpoll_tfd_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void eventpoll_tfd_entry__free_unpacked(EventpollTfdEntry *m, ProtobufCAllocator *a);
+struct _EventpollFileEntry { ProtobufCMessage base;
+ uint32_t id;
+ uint32_t flags;
+ FownEntry *fown;
+};
+#define EVENTPOLL_FILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&eventpoll_file_entry__descriptor) }
+extern const ProtobufCMessageDescriptor eventpoll_file_entry__descriptor;
+void eventpoll_file_entry__init(EventpollFileEntry *m);
+size_t eventpoll_file_entry__get_packed_size(const EventpollFileEntry *m);
+size_t eventpoll_file_entry__pack(const EventpollFileEntry *m, uint8_t *out);
+EventpollFileEntry *eventpoll_file_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void eventpoll_file_entry__free_unpacked(EventpollFileEntry *m, ProtobufCAllocator *a);
+#endif
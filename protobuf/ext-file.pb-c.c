@@ -0,0 +1 @@
+#include "ext-file.pb-c.h"
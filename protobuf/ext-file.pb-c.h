@@ -0,0 +1,17 @@
+#ifndef __PB_EXT_FILE__
+#define __PB_EXT_FILE__
+#include <google/protobuf-c/protobuf-c.h>
+#include "fown.pb-c.h"
+typedef struct _ExtFileEntry ExtFileEntry;
+struct _ExtFileEntry { ProtobufCMessage base;
+ uint32_t id;
+ FownEntry *fown;
+};
+#define EXT_FILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&ext_file_entry__descriptor) }
+extern const ProtobufCMessageDescriptor ext_file_entry__descriptor;
+void ext_file_entry__init(ExtFileEntry *m);
+size_t ext_file_entry__get_packed_size(const ExtFileEntry *m);
+size_t ext_file_entry__pack(const ExtFileEntry *m, uint8_t *out);
+ExtFileEntry *ext_file_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void ext_file_entry__free_unpacked(ExtFileEntry *m, ProtobufCAllocator *a);
+#endif
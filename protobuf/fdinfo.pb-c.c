@@ -0,0 +1 @@
+#include "fdinfo.pb-c.h"
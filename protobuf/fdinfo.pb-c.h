@@ -0,0 +1,20 @@
+#ifndef __PB_FDINFO__
+#define __PB_FDINFO__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _FdinfoEntry FdinfoEntry;
+typedef enum _FdTypes { FD_TYPES__UND = 0, FD_TYPES__REG = 1, FD_TYPES__PIPE = 2, FD_TYPES__FIFO = 3, FD_TYPES__INETSK = 4, FD_TYPES__UNIXSK = 5, FD_TYPES__EVENTFD = 6, FD_TYPES__EVENTPOLL = 7, FD_TYPES__INOTIFY = 8, FD_TYPES__SIGNALFD = 9, FD_TYPES__PACKETSK = 10, FD_TYPES__TTY = 11, FD_TYPES__FANOTIFY = 12, FD_TYPES__NETLINKSK = 13, FD_TYPES__NS = 14, FD_TYPES__TUN = 15, FD_TYPES__EXT = 16 } FdTypes;
+extern const ProtobufCEnumDescriptor fd_types__descriptor;
+struct _FdinfoEntry { ProtobufCMessage base;
+ uint32_t id;
+ uint32_t flags;
+ FdTypes type;
+ uint32_t fd;
+};
+#define FDINFO_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&fdinfo_entry__descriptor) }
+extern const ProtobufCMessageDescriptor fdinfo_entry__descriptor;
+void fdinfo_entry__init(FdinfoEntry *m);
+size_t fdinfo_entry__get_packed_size(const FdinfoEntry *m);
+size_t fdinfo_entry__pack(const FdinfoEntry *m, uint8_t *out);
+FdinfoEntry *fdinfo_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void fdinfo_entry__free_unpacked(FdinfoEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1,19 @@
+#ifndef __PB_FH__
+#define __PB_FH__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _FhEntry FhEntry;
+typedef enum _FhEntrySizes { FH_ENTRY_SIZES__min_entries = 16 } FhEntrySizes;
+extern const ProtobufCEnumDescriptor fh_entry_sizes__descriptor;
+struct _FhEntry { ProtobufCMessage base;
+ uint32_t bytes;
+ uint32_t type;
+ size_t n_handle; uint64_t *handle;
+};
+#define FH_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&fh_entry__descriptor) }
+extern const ProtobufCMessageDescriptor fh_entry__descriptor;
+void fh_entry__init(FhEntry *m);
+size_t fh_entry__get_packed_size(const FhEntry *m);
+size_t fh_entry__pack(const FhEntry *m, uint8_t *out);
+FhEntry *fh_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void fh_entry__free_unpacked(FhEntry *m, ProtobufCAllocator *a);
+#endif
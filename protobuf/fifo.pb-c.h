@@ -0,0 +1,16 @@
+#ifndef __PB_FIFO__
+#define __PB_FIFO__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _FifoEntry FifoEntry;
+struct _FifoEntry { ProtobufCMessage base;
+ uint32_t id;
+ uint32_t pipe_id;
+};
+#define FIFO_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&fifo_entry__descriptor) }
+extern const ProtobufCMessageDescriptor fifo_entry__descriptor;
+void fifo_entry__init(FifoEntry *m);
+size_t fifo_entry__get_packed_size(const FifoEntry *m);
+size_t fifo_entry__pack(const FifoEntry *m, uint8_t *out);
+FifoEntry *fifo_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void fifo_entry__free_unpacked(FifoEntry *m, ProtobufCAllocator *a);
+#endif
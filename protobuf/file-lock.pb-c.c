@@ -0,0 +1 @@
+#include "file-lock.pb-c.h"
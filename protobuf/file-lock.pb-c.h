@@ -0,0 +1,20 @@
+#ifndef __PB_FILE_LOCK__
+#define __PB_FILE_LOCK__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _FileLockEntry FileLockEntry;
+struct _FileLockEntry { ProtobufCMessage base;
+ uint32_t flag;
+ uint32_t type;
+ int32_t pid;
+ int32_t fd;
+ int64_t start;
+ int64_t len;
+};
+#define FILE_LOCK_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&file_lock_entry__descriptor) }
+extern const ProtobufCMessageDescriptor file_lock_entry__descriptor;
+void file_lock_entry__init(FileLockEntry *m);
+size_t file_lock_entry__get_packed_size(const FileLockEntry *m);
+size_t file_lock_entry__pack(const FileLockEntry *m, uint8_t *out);
+FileLockEntry *file_lock_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void file_lock_entry__free_unpacked(FileLockEntry *m, ProtobufCAllocator *a);
+#endif
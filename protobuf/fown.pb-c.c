@@ -0,0 +1 @@
+#include "fown.pb-c.h"
@@ -0,0 +1,18 @@
+#ifndef __PB_FS__
+#define __PB_FS__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _FsEntry FsEntry;
+struct _FsEntry { ProtobufCMessage base;
+ uint32_t cwd_id;
+ uint32_t root_id;
+ protobuf_c_boolean has_umask;
+ uint32_t umask;
+};
+#define FS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&fs_entry__descriptor) }
+extern const ProtobufCMessageDescriptor fs_entry__descriptor;
+void fs_entry__init(FsEntry *m);
+size_t fs_entry__get_packed_size(const FsEntry *m);
+size_t fs_entry__pack(const FsEntry *m, uint8_t *out);
+FsEntry *fs_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void fs_entry__free_unpacked(FsEntry *m, ProtobufCAllocator *a);
+#endif
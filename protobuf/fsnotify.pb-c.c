@@ -0,0 +1 @@
+#include "fsnotify.pb-c.h"
@@ -0,0 +1,94 @@
+#ifndef __PB_FSNOTIFY__
+#define __PB_FSNOTIFY__
+#include <google/protobuf-c/protobuf-c.h>
+#include "fh.pb-c.h"
+#include "fown.pb-c.h"
+typedef struct _InotifyWdEntry InotifyWdEntry;
+typedef struct _InotifyFileEntry InotifyFileEntry;
+typedef struct _FanotifyInodeMarkEntry FanotifyInodeMarkEntry;
+typedef struct _FanotifyMountMarkEntry FanotifyMountMarkEntry;
+typedef struct _FanotifyMarkEntry FanotifyMarkEntry;
+typedef struct _FanotifyFileEntry FanotifyFileEntry;
+typedef enum _MarkType { MARK_TYPE__INODE = 1, MARK_TYPE__MOUNT = 2 } MarkType;
+extern const ProtobufCEnumDescriptor mark_type__descriptor;
+struct _InotifyWdEntry { ProtobufCMessage base;
+ uint32_t id;
+ uint64_t i_ino;
+ uint32_t mask;
+ uint32_t ignored_mask;
+ uint32_t s_dev;
+ uint32_t wd;
+ FhEntry *f_handle;
+};
+#define INOTIFY_WD_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&inotify_wd_entry__descriptor) }
+extern const ProtobufCMessageDescriptor inotify_wd_entry__descriptor;
+void inotify_wd_entry__init(InotifyWdEntry *m);
+size_t inotify_wd_entry__get_packed_size(const InotifyWdEntry *m);
+size_t inotify_wd_entry__pack(const InotifyWdEntry *m, uint8_t *out);
+InotifyWdEntry *inotify_wd_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void inotify_wd_entry__free_unpacked(InotifyWdEntry *m, ProtobufCAllocator *a);
+struct _InotifyFileEntry { ProtobufCMessage base;
+ uint32_t id;
+ uint32_t flags;
+ FownEntry *fown;
+};
+#define INOTIFY_FILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&inotify_file_entry__descriptor) }
+extern const ProtobufCMessageDescriptor inotify_file_entry__descriptor;
+void inotify_file_entry__init(InotifyFileEntry *m);
+size_t inotify_file_entry__get_packed_size(const InotifyFileEntry *m);
+size_t inotify_file_entry__pack(const InotifyFileEntry *m, uint8_t *out);
+InotifyFileEntry *inotify_file_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void inotify_file_entry__free_unpacked(InotifyFileEntry *m, ProtobufCAllocator *a);
+struct _FanotifyInodeMarkEntry { ProtobufCMessage base;
+ uint64_t i_ino;
+ FhEntry *f_handle;
+};
+#define FANOTIFY_INODE_MARK_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&fanotify_inode_mark_entry__descriptor) }
+extern const ProtobufCMessageDescriptor fanotify_inode_mark_entry__descriptor;
+void fanotify_inode_mark_entry__init(FanotifyInodeMarkEntry *m);
+size_t fanotify_inode_mark_entry__get_packed_size(const FanotifyInodeMarkEntry *m);
+size_t fanotify_inode_mark_entry__pack(const FanotifyInodeMarkEntry *m, uint8_t *out);
+FanotifyInodeMarkEntry *fanotify_inode_mark_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void fanotify_inode_mark_entry__free_unpacked(FanotifyInodeMarkEntry *m, ProtobufCAllocator *a);
+struct _FanotifyMountMarkEntry { ProtobufCMessage base;
+ uint32_t mnt_id;
+};
+#define FANOTIFY_MOUNT_MARK_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&fanotify_mount_mark_entry__descriptor) }
+extern const ProtobufCMessageDescriptor fanotify_mount_mark_entry__descriptor;
+void fanotify_mount_mark_entry__init(FanotifyMountMarkEntry *m);
+size_t fanotify_mount_mark_entry__get_packed_size(const FanotifyMountMarkEntry *m);
+size_t fanotify_mount_mark_entry__pack(const FanotifyMountMarkEntry *m, uint8_t *out);
+FanotifyMountMarkEntry *fanotify_mount_mark_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void fanotify_mount_mark_entry__free_unpacked(FanotifyMountMarkEntry *m, ProtobufCAllocator *a);
+struct _FanotifyMarkEntry { ProtobufCMessage base;
+ uint32_t id;
+ MarkType type;
+ uint32_t mflags;
+ uint32_t mask;
+ uint32_t ignored_mask;
+ uint32_t s_dev;
+ FanotifyInodeMarkEntry *ie;
+ FanotifyMountMarkEntry *me;
+};
+#define FANOTIFY_MARK_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&fanotify_mark_entry__descriptor) }
+extern const ProtobufCMessageDescriptor fanotify_mark_entry__descriptor;
+void fanotify_mark_entry__init(FanotifyMarkEntry *m);
+size_t fanotify_mark_entry__get_packed_size(const FanotifyMarkEntry *m);
+size_t fanotify_mark_entry__pack(const FanotifyMarkEntry *m, uint8_t *out);
+FanotifyMarkEntry *fanotify_mark_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void fanotify_mark_entry__free_unpacked(FanotifyMarkEntry *m, ProtobufCAllocator *a);
+struct _FanotifyFileEntry { ProtobufCMessage base;
+ uint32_t id;
+ uint32_t flags;
+ FownEntry *fown;
+ uint32_t faflags;
+ uint32_t evflags;
+};
+#define FANOTIFY_FILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&fanotify_file_entry__descriptor) }
+extern const ProtobufCMessageDescriptor fanotify_file_entry__descriptor;
+void fanotify_file_entry__init(FanotifyFileEntry *m);
+size_t fanotify_file_entry__get_packed_size(const FanotifyFileEntry *m);
+size_t fanotify_file_entry__pack(const FanotifyFileEntry *m, uint8_t *out);
+FanotifyFileEntry *fanotify_file_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void fanotify_file_entry__free_unpacked(FanotifyFileEntry *m, ProtobufCAllocator *a);
+#endif
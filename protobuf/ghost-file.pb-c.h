@@ -0,0 +1,21 @@
+#ifndef __PB_GHOST_FILE__
+#define __PB_GHOST_FILE__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _GhostFileEntry GhostFileEntry;
+struct _GhostFileEntry { ProtobufCMessage base;
+ uint32_t uid;
+ uint32_t gid;
+ uint32_t mode;
+ protobuf_c_boolean has_dev;
+ uint32_t dev;
+ protobuf_c_boolean has_ino;
+ uint64_t ino;
+};
+#define GHOST_FILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&ghost_file_entry__descriptor) }
+extern const ProtobufCMessageDescriptor ghost_file_entry__descriptor;
+void ghost_file_entry__init(GhostFileEntry *m);
+size_t ghost_file_entry__get_packed_size(const GhostFileEntry *m);
+size_t ghost_file_entry__pack(const GhostFileEntry *m, uint8_t *out);
+GhostFileEntry *ghost_file_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void ghost_file_entry__free_unpacked(GhostFileEntry *m, ProtobufCAllocator *a);
+#endif
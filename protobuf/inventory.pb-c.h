@@ -0,0 +1,21 @@
+#ifndef __PB_INVENTORY__
+#define __PB_INVENTORY__
+#include <google/protobuf-c/protobuf-c.h>
+#include "core.pb-c.h"
+typedef struct _InventoryEntry InventoryEntry;
+struct _InventoryEntry { ProtobufCMessage base;
+ uint32_t img_version;
+ protobuf_c_boolean has_fdinfo_per_id;
+ protobuf_c_boolean fdinfo_per_id;
+ TaskKobjIdsEntry *root_ids;
+ protobuf_c_boolean has_ns_per_id;
+ protobuf_c_boolean ns_per_id;
+};
+#define INVENTORY_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&inventory_entry__descriptor) }
+extern const ProtobufCMessageDescriptor inventory_entry__descriptor;
+void inventory_entry__init(InventoryEntry *m);
+size_t inventory_entry__get_packed_size(const InventoryEntry *m);
+size_t inventory_entry__pack(const InventoryEntry *m, uint8_t *out);
+InventoryEntry *inventory_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void inventory_entry__free_unpacked(InventoryEntry *m, ProtobufCAllocator *a);
+#endif
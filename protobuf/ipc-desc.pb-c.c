@@ -0,0 +1 @@
+#include "ipc-desc.pb-c.h"
@@ -0,0 +1 @@
+#include "ipc-msg.pb-c.h"
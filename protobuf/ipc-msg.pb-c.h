@@ -0,0 +1,30 @@
+#ifndef __PB_IPC_MSG__
+#define __PB_IPC_MSG__
+#include <google/protobuf-c/protobuf-c.h>
+#include "ipc-desc.pb-c.h"
+typedef struct _IpcMsg IpcMsg;
+typedef struct _IpcMsgEntry IpcMsgEntry;
+struct _IpcMsg { ProtobufCMessage base;
+ uint64_t mtype;
+ uint32_t msize;
+};
+#define IPC_MSG__INIT { PROTOBUF_C_MESSAGE_INIT(&ipc_msg__descriptor) }
+extern const ProtobufCMessageDescriptor ipc_msg__descriptor;
+void ipc_msg__init(IpcMsg *m);
+size_t ipc_msg__get_packed_size(const IpcMsg *m);
+size_t ipc_msg__pack(const IpcMsg *m, uint8_t *out);
+IpcMsg *ipc_msg__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void ipc_msg__free_unpacked(IpcMsg *m, ProtobufCAllocator *a);
+struct _IpcMsgEntry { ProtobufCMessage base;
+ IpcDescEntry *desc;
+ uint32_t qbytes;
+ uint32_t qnum;
+};
+#define IPC_MSG_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&ipc_msg_entry__descriptor) }
+extern const ProtobufCMessageDescriptor ipc_msg_entry__descriptor;
+void ipc_msg_entry__init(IpcMsgEntry *m);
+size_t ipc_msg_entry__get_packed_size(const IpcMsgEntry *m);
+size_t ipc_msg_entry__pack(const IpcMsgEntry *m, uint8_t *out);
+IpcMsgEntry *ipc_msg_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void ipc_msg_entry__free_unpacked(IpcMsgEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1,17 @@
+#ifndef __PB_IPC_SEM__
+#define __PB_IPC_SEM__
+#include <google/protobuf-c/protobuf-c.h>
+#include "ipc-desc.pb-c.h"
+typedef struct _IpcSemEntry IpcSemEntry;
+struct _IpcSemEntry { ProtobufCMessage base;
+ IpcDescEntry *desc;
+ uint32_t nsems;
+};
+#define IPC_SEM_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&ipc_sem_entry__descriptor) }
+extern const ProtobufCMessageDescriptor ipc_sem_entry__descriptor;
+void ipc_sem_entry__init(IpcSemEntry *m);
+size_t ipc_sem_entry__get_packed_size(const IpcSemEntry *m);
+size_t ipc_sem_entry__pack(const IpcSemEntry *m, uint8_t *out);
+IpcSemEntry *ipc_sem_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void ipc_sem_entry__free_unpacked(IpcSemEntry *m, ProtobufCAllocator *a);
+#endif
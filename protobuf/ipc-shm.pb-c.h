@@ -0,0 +1,17 @@
+#ifndef __PB_IPC_SHM__
+#define __PB_IPC_SHM__
+#include <google/protobuf-c/protobuf-c.h>
+#include "ipc-desc.pb-c.h"
+typedef struct _IpcShmEntry IpcShmEntry;
+struct _IpcShmEntry { ProtobufCMessage base;
+ IpcDescEntry *desc;
+ uint64_t size;
+};
+#define IPC_SHM_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&ipc_shm_entry__descriptor) }
+extern const ProtobufCMessageDescriptor ipc_shm_entry__descriptor;
+void ipc_shm_entry__init(IpcShmEntry *m);
+size_t ipc_shm_entry__get_packed_size(const IpcShmEntry *m);
+size_t ipc_shm_entry__pack(const IpcShmEntry *m, uint8_t *out);
+IpcShmEntry *ipc_shm_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void ipc_shm_entry__free_unpacked(IpcShmEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1 @@
+#include "ipc-var.pb-c.h"
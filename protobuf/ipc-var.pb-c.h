@@ -0,0 +1,26 @@
+#ifndef __PB_IPC_VAR__
+#define __PB_IPC_VAR__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _IpcVarEntry IpcVarEntry;
+struct _IpcVarEntry { ProtobufCMessage base;
+ size_t n_sem_ctls; uint32_t *sem_ctls;
+ uint32_t msg_ctlmax;
+ uint32_t msg_ctlmnb;
+ uint32_t msg_ctlmni;
+ uint32_t auto_msgmni;
+ uint64_t shm_ctlmax;
+ uint64_t shm_ctlall;
+ uint32_t shm_ctlmni;
+ uint32_t shm_rmid_forced;
+ uint32_t mq_queues_max;
+ uint32_t mq_msg_max;
+ uint32_t mq_msgsize_max;
+};
+#define IPC_VAR_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&ipc_var_entry__descriptor) }
+extern const ProtobufCMessageDescriptor ipc_var_entry__descriptor;
+void ipc_var_entry__init(IpcVarEntry *m);
+size_t ipc_var_entry__get_packed_size(const IpcVarEntry *m);
+size_t ipc_var_entry__pack(const IpcVarEntry *m, uint8_t *out);
+IpcVarEntry *ipc_var_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void ipc_var_entry__free_unpacked(IpcVarEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1 @@
+#include "mm.pb-c.h"
@@ -0,0 +1,27 @@
+#ifndef __PB_MM__
+#define __PB_MM__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _MmEntry MmEntry;
+struct _MmEntry { ProtobufCMessage base;
+ uint64_t mm_start_code;
+ uint64_t mm_end_code;
+ uint64_t mm_start_data;
+ uint64_t mm_end_data;
+ uint64_t mm_start_stack;
+ uint64_t mm_start_brk;
+ uint64_t mm_brk;
+ uint64_t mm_arg_start;
+ uint64_t mm_arg_end;
+ uint64_t mm_env_start;
+ uint64_t mm_env_end;
+ uint32_t exe_file_id;
+ size_t n_mm_saved_auxv; uint64_t *mm_saved_auxv;
+};
+#define MM_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&mm_entry__descriptor) }
+extern const ProtobufCMessageDescriptor mm_entry__descriptor;
+void mm_entry__init(MmEntry *m);
+size_t mm_entry__get_packed_size(const MmEntry *m);
+size_t mm_entry__pack(const MmEntry *m, uint8_t *out);
+MmEntry *mm_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void mm_entry__free_unpacked(MmEntry *m, ProtobufCAllocator *a);
+#endif
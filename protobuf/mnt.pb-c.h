@@ -0,0 +1,31 @@
+#ifndef __PB_MNT__
+#define __PB_MNT__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _MntEntry MntEntry;
+typedef enum _Fstype { FSTYPE__UNSUPPORTED = 0, FSTYPE__PROC = 1, FSTYPE__SYSFS = 2, FSTYPE__DEVTMPFS = 3, FSTYPE__BINFMT_MISC = 4, FSTYPE__TMPFS = 5, FSTYPE__DEVPTS = 6, FSTYPE__SIMFS = 7 } Fstype;
+extern const ProtobufCEnumDescriptor fstype__descriptor;
+struct _MntEntry { ProtobufCMessage base;
+ uint32_t fstype;
+ uint32_t mnt_id;
+ uint32_t root_dev;
+ uint32_t parent_mnt_id;
+ uint32_t flags;
+ char *root;
+ char *mountpoint;
+ char *source;
+ char *options;
+ protobuf_c_boolean has_shared_id;
+ uint32_t shared_id;
+ protobuf_c_boolean has_master_id;
+ uint32_t master_id;
+ protobuf_c_boolean has_with_plugin;
+ protobuf_c_boolean with_plugin;
+};
+#define MNT_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&mnt_entry__descriptor) }
+extern const ProtobufCMessageDescriptor mnt_entry__descriptor;
+void mnt_entry__init(MntEntry *m);
+size_t mnt_entry__get_packed_size(const MntEntry *m);
+size_t mnt_entry__pack(const MntEntry *m, uint8_t *out);
+MntEntry *mnt_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void mnt_entry__free_unpacked(MntEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1,25 @@
+#ifndef __PB_NETDEV__
+#define __PB_NETDEV__
+#include <google/protobuf-c/protobuf-c.h>
+#include "tun.pb-c.h"
+typedef struct _NetDeviceEntry NetDeviceEntry;
+typedef enum _NdType { ND_TYPE__LOOPBACK = 1, ND_TYPE__VETH = 2, ND_TYPE__TUN = 3, ND_TYPE__EXTLINK = 4 } NdType;
+extern const ProtobufCEnumDescriptor nd_type__descriptor;
+struct _NetDeviceEntry { ProtobufCMessage base;
+ NdType type;
+ uint32_t ifindex;
+ uint32_t mtu;
+ uint32_t flags;
+ char *name;
+ TunLinkEntry *tun;
+ protobuf_c_boolean has_address;
+ ProtobufCBinaryData address;
+};
+#define NET_DEVICE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&net_device_entry__descriptor) }
+extern const ProtobufCMessageDescriptor net_device_entry__descriptor;
+void net_device_entry__init(NetDeviceEntry *m);
+size_t net_device_entry__get_packed_size(const NetDeviceEntry *m);
+size_t net_device_entry__pack(const NetDeviceEntry *m, uint8_t *out);
+NetDeviceEntry *net_device_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void net_device_entry__free_unpacked(NetDeviceEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1,18 @@
+#ifndef __PB_NS__
+#define __PB_NS__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _NsFileEntry NsFileEntry;
+struct _NsFileEntry { ProtobufCMessage base;
+ uint32_t id;
+ uint32_t ns_id;
+ uint32_t ns_cflag;
+ uint32_t flags;
+};
+#define NS_FILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&ns_file_entry__descriptor) }
+extern const ProtobufCMessageDescriptor ns_file_entry__descriptor;
+void ns_file_entry__init(NsFileEntry *m);
+size_t ns_file_entry__get_packed_size(const NsFileEntry *m);
+size_t ns_file_entry__pack(const NsFileEntry *m, uint8_t *out);
+NsFileEntry *ns_file_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void ns_file_entry__free_unpacked(NsFileEntry *m, ProtobufCAllocator *a);
+#endif
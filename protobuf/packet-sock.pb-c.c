@@ -0,0 +1 @@
+#include "packet-sock.pb-c.h"
@@ -0,0 +1,66 @@
+#ifndef __PB_PACKET_SOCK__
+#define __PB_PACKET_SOCK__
+#include <google/protobuf-c/protobuf-c.h>
+#include "fown.pb-c.h"
+#include "sk-opts.pb-c.h"
+typedef struct _PacketMclist PacketMclist;
+typedef struct _PacketRing PacketRing;
+typedef struct _PacketSockEntry PacketSockEntry;
+struct _PacketMclist { ProtobufCMessage base;
+ uint32_t index;
+ uint32_t type;
+ ProtobufCBinaryData addr;
+};
+#define PACKET_MCLIST__INIT { PROTOBUF_C_MESSAGE_INIT(&packet_mclist__descriptor) }
+extern const ProtobufCMessageDescriptor packet_mclist__descriptor;
+void packet_mclist__init(PacketMclist *m);
+size_t packet_mclist__get_packed_size(const PacketMclist *m);
+size_t packet_mclist__pack(const PacketMclist *m, uint8_t *out);
+PacketMclist *packet_mclist__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void packet_mclist__free_unpacked(PacketMclist *m, ProtobufCAllocator *a);
+struct _PacketRing { ProtobufCMessage base;
+ uint32_t block_size;
+ uint32_t block_nr;
+ uint32_t frame_size;
+ uint32_t frame_nr;
+ uint32_t retire_tmo;
+ uint32_t sizeof_priv;
+ uint32_t features;
+};
+#define PACKET_RING__INIT { PROTOBUF_C_MESSAGE_INIT(&packet_ring__descriptor) }
+extern const ProtobufCMessageDescriptor packet_ring__descriptor;
+void packet_ring__init(PacketRing *m);
+size_t packet_ring__get_packed_size(const PacketRing *m);
+size_t packet_ring__pack(const PacketRing *m, uint8_t *out);
+PacketRing *packet_ring__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void packet_ring__free_unpacked(PacketRing *m, ProtobufCAllocator *a);
+struct _PacketSockEntry { ProtobufCMessage base;
+ uint32_t id;
+ uint32_t type;
+ uint32_t protocol;
+ uint32_t flags;
+ uint32_t ifindex;
+ FownEntry *fown;
+ SkOptsEntry *opts;
+ uint32_t version;
+ uint32_t reserve;
+ protobuf_c_boolean aux_data;
+ protobuf_c_boolean orig_dev;
+ protobuf_c_boolean vnet_hdr;
+ protobuf_c_boolean loss;
+ uint32_t timestamp;
+ uint32_t copy_thresh;
+ size_t n_mclist; PacketMclist **mclist;
+ protobuf_c_boolean has_fanout;
+ uint32_t fanout;
+ PacketRing *rx_ring;
+ PacketRing *tx_ring;
+};
+#define PACKET_SOCK_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&packet_sock_entry__descriptor) }
+extern const ProtobufCMessageDescriptor packet_sock_entry__descriptor;
+void packet_sock_entry__init(PacketSockEntry *m);
+size_t packet_sock_entry__get_packed_size(const PacketSockEntry *m);
+size_t packet_sock_entry__pack(const PacketSockEntry *m, uint8_t *out);
+PacketSockEntry *packet_sock_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void packet_sock_entry__free_unpacked(PacketSockEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1 @@
+#include "pagemap.pb-c.h"
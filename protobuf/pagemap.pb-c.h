@@ -0,0 +1,33 @@
+#ifndef __PB_PAGEMAP__
+#define __PB_PAGEMAP__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _PagemapHead PagemapHead;
+typedef struct _PagemapEntry PagemapEntry;
+struct _PagemapHead { ProtobufCMessage base;
+ uint32_t pages_id;
+};
+#define PAGEMAP_HEAD__INIT { PROTOBUF_C_MESSAGE_INIT(&pagemap_head__descriptor) }
+extern const ProtobufCMessageDescriptor pagemap_head__descriptor;
+void pagemap_head__init(PagemapHead *m);
+size_t pagemap_head__get_packed_size(const PagemapHead *m);
+size_t pagemap_head__pack(const PagemapHead *m, uint8_t *out);
+PagemapHead *pagemap_head__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void pagemap_head__free_unpacked(PagemapHead *m, ProtobufCAllocator *a);
+struct _PagemapEntry { ProtobufCMessage base;
+ uint64_t vaddr;
+ uint32_t nr_pages;
+ protobuf_c_boolean has_in_parent;
+ protobuf_c_boolean in_parent;
+ protobuf_c_boolean has_comp_len;
+ uint32_t comp_len;
+ protobuf_c_boolean has_zero;
+ protobuf_c_boolean zero;
+};
+#define PAGEMAP_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&pagemap_entry__descriptor) }
+extern const ProtobufCMessageDescriptor pagemap_entry__descriptor;
+void pagemap_entry__init(PagemapEntry *m);
+size_t pagemap_entry__get_packed_size(const PagemapEntry *m);
+size_t pagemap_entry__pack(const PagemapEntry *m, uint8_t *out);
+PagemapEntry *pagemap_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void pagemap_entry__free_unpacked(PagemapEntry *m, ProtobufCAllocator *a);
+#endif
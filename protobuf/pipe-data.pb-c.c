@@ -0,0 +1 @@
+#include "pipe-data.pb-c.h"
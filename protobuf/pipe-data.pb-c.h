@@ -0,0 +1,18 @@
+#ifndef __PB_PIPE_DATA__
+#define __PB_PIPE_DATA__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _PipeDataEntry PipeDataEntry;
+struct _PipeDataEntry { ProtobufCMessage base;
+ uint32_t pipe_id;
+ uint32_t bytes;
+ protobuf_c_boolean has_size;
+ uint32_t size;
+};
+#define PIPE_DATA_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&pipe_data_entry__descriptor) }
+extern const ProtobufCMessageDescriptor pipe_data_entry__descriptor;
+void pipe_data_entry__init(PipeDataEntry *m);
+size_t pipe_data_entry__get_packed_size(const PipeDataEntry *m);
+size_t pipe_data_entry__pack(const PipeDataEntry *m, uint8_t *out);
+PipeDataEntry *pipe_data_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void pipe_data_entry__free_unpacked(PipeDataEntry *m, ProtobufCAllocator *a);
+#endif
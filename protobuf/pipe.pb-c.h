@@ -0,0 +1,19 @@
+#ifndef __PB_PIPE__
+#define __PB_PIPE__
+#include <google/protobuf-c/protobuf-c.h>
+#include "fown.pb-c.h"
+typedef struct _PipeEntry PipeEntry;
+struct _PipeEntry { ProtobufCMessage base;
+ uint32_t id;
+ uint32_t pipe_id;
+ uint32_t flags;
+ FownEntry *fown;
+};
+#define PIPE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&pipe_entry__descriptor) }
+extern const ProtobufCMessageDescriptor pipe_entry__descriptor;
+void pipe_entry__init(PipeEntry *m);
+size_t pipe_entry__get_packed_size(const PipeEntry *m);
+size_t pipe_entry__pack(const PipeEntry *m, uint8_t *out);
+PipeEntry *pipe_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void pipe_entry__free_unpacked(PipeEntry *m, ProtobufCAllocator *a);
+#endif
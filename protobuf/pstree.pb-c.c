@@ -0,0 +1 @@
+#include "pstree.pb-c.h"
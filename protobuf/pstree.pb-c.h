@@ -0,0 +1,19 @@
+#ifndef __PB_PSTREE__
+#define __PB_PSTREE__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _PstreeEntry PstreeEntry;
+struct _PstreeEntry { ProtobufCMessage base;
+ uint32_t pid;
+ uint32_t ppid;
+ uint32_t pgid;
+ uint32_t sid;
+ size_t n_threads; uint32_t *threads;
+};
+#define PSTREE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&pstree_entry__descriptor) }
+extern const ProtobufCMessageDescriptor pstree_entry__descriptor;
+void pstree_entry__init(PstreeEntry *m);
+size_t pstree_entry__get_packed_size(const PstreeEntry *m);
+size_t pstree_entry__pack(const PstreeEntry *m, uint8_t *out);
+PstreeEntry *pstree_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void pstree_entry__free_unpacked(PstreeEntry *m, ProtobufCAllocator *a);
+#endif
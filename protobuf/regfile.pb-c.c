@@ -0,0 +1 @@
+#include "regfile.pb-c.h"
@@ -0,0 +1,20 @@
+#ifndef __PB_REGFILE__
+#define __PB_REGFILE__
+#include <google/protobuf-c/protobuf-c.h>
+#include "fown.pb-c.h"
+typedef struct _RegFileEntry RegFileEntry;
+struct _RegFileEntry { ProtobufCMessage base;
+ uint32_t id;
+ uint32_t flags;
+ uint64_t pos;
+ FownEntry *fown;
+ char *name;
+};
+#define REG_FILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&reg_file_entry__descriptor) }
+extern const ProtobufCMessageDescriptor reg_file_entry__descriptor;
+void reg_file_entry__init(RegFileEntry *m);
+size_t reg_file_entry__get_packed_size(const RegFileEntry *m);
+size_t reg_file_entry__pack(const RegFileEntry *m, uint8_t *out);
+RegFileEntry *reg_file_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void reg_file_entry__free_unpacked(RegFileEntry *m, ProtobufCAllocator *a);
+#endif
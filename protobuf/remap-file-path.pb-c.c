@@ -0,0 +1 @@
+#include "remap-file-path.pb-c.h"
@@ -0,0 +1,16 @@
+#ifndef __PB_REMAP_FILE_PATH__
+#define __PB_REMAP_FILE_PATH__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _RemapFilePathEntry RemapFilePathEntry;
+struct _RemapFilePathEntry { ProtobufCMessage base;
+ uint32_t orig_id;
+ uint32_t remap_id;
+};
+#define REMAP_FILE_PATH_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&remap_file_path_entry__descriptor) }
+extern const ProtobufCMessageDescriptor remap_file_path_entry__descriptor;
+void remap_file_path_entry__init(RemapFilePathEntry *m);
+size_t remap_file_path_entry__get_packed_size(const RemapFilePathEntry *m);
+size_t remap_file_path_entry__pack(const RemapFilePathEntry *m, uint8_t *out);
+RemapFilePathEntry *remap_file_path_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void remap_file_path_entry__free_unpacked(RemapFilePathEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1 @@
+#include "rlimit.pb-c.h"
@@ -0,0 +1,16 @@
+#ifndef __PB_RLIMIT__
+#define __PB_RLIMIT__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _RlimitEntry RlimitEntry;
+struct _RlimitEntry { ProtobufCMessage base;
+ uint64_t cur;
+ uint64_t max;
+};
+#define RLIMIT_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&rlimit_entry__descriptor) }
+extern const ProtobufCMessageDescriptor rlimit_entry__descriptor;
+void rlimit_entry__init(RlimitEntry *m);
+size_t rlimit_entry__get_packed_size(const RlimitEntry *m);
+size_t rlimit_entry__pack(const RlimitEntry *m, uint8_t *out);
+RlimitEntry *rlimit_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void rlimit_entry__free_unpacked(RlimitEntry *m, ProtobufCAllocator *a);
+#endif
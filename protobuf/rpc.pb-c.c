@@ -0,0 +1 @@
+#include "rpc.pb-c.h"
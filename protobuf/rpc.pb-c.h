@@ -0,0 +1,84 @@
+#ifndef __PB_RPC__
+#define __PB_RPC__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _CriuOpts CriuOpts;
+typedef struct _CriuDumpResp CriuDumpResp;
+typedef struct _CriuRestoreResp CriuRestoreResp;
+typedef struct _CriuReq CriuReq;
+typedef struct _CriuResp CriuResp;
+typedef enum _CriuReqType { CRIU_REQ_TYPE__EMPTY = 0, CRIU_REQ_TYPE__DUMP = 1, CRIU_REQ_TYPE__RESTORE = 2, CRIU_REQ_TYPE__CHECK = 3 } CriuReqType;
+extern const ProtobufCEnumDescriptor criu_req_type__descriptor;
+struct _CriuOpts { ProtobufCMessage base;
+ int32_t images_dir_fd;
+ protobuf_c_boolean has_pid;
+ int32_t pid;
+ protobuf_c_boolean has_leave_running;
+ protobuf_c_boolean leave_running;
+ protobuf_c_boolean has_ext_unix_sk;
+ protobuf_c_boolean ext_unix_sk;
+ protobuf_c_boolean has_tcp_established;
+ protobuf_c_boolean tcp_established;
+ protobuf_c_boolean has_evasive_devices;
+ protobuf_c_boolean evasive_devices;
+ protobuf_c_boolean has_shell_job;
+ protobuf_c_boolean shell_job;
+ protobuf_c_boolean has_file_locks;
+ protobuf_c_boolean file_locks;
+ protobuf_c_boolean has_log_level;
+ int32_t log_level;
+ char *log_file;
+ char *progress_socket;
+};
+#define CRIU_OPTS__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_opts__descriptor) }
+extern const ProtobufCMessageDescriptor criu_opts__descriptor;
+void criu_opts__init(CriuOpts *m);
+size_t criu_opts__get_packed_size(const CriuOpts *m);
+size_t criu_opts__pack(const CriuOpts *m, uint8_t *out);
+CriuOpts *criu_opts__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void criu_opts__free_unpacked(CriuOpts *m, ProtobufCAllocator *a);
+struct _CriuDumpResp { ProtobufCMessage base;
+ protobuf_c_boolean has_restored;
+ protobuf_c_boolean restored;
+};
+#define CRIU_DUMP_RESP__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_dump_resp__descriptor) }
+extern const ProtobufCMessageDescriptor criu_dump_resp__descriptor;
+void criu_dump_resp__init(CriuDumpResp *m);
+size_t criu_dump_resp__get_packed_size(const CriuDumpResp *m);
+size_t criu_dump_resp__pack(const CriuDumpResp *m, uint8_t *out);
+CriuDumpResp *criu_dump_resp__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void criu_dump_resp__free_unpacked(CriuDumpResp *m, ProtobufCAllocator *a);
+struct _CriuRestoreResp { ProtobufCMessage base;
+ int32_t pid;
+};
+#define CRIU_RESTORE_RESP__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_restore_resp__descriptor) }
+extern const ProtobufCMessageDescriptor criu_restore_resp__descriptor;
+void criu_restore_resp__init(CriuRestoreResp *m);
+size_t criu_restore_resp__get_packed_size(const CriuRestoreResp *m);
+size_t criu_restore_resp__pack(const CriuRestoreResp *m, uint8_t *out);
+CriuRestoreResp *criu_restore_resp__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void criu_restore_resp__free_unpacked(CriuRestoreResp *m, ProtobufCAllocator *a);
+struct _CriuReq { ProtobufCMessage base;
+ CriuReqType type;
+ CriuOpts *opts;
+};
+#define CRIU_REQ__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_req__descriptor) }
+extern const ProtobufCMessageDescriptor criu_req__descriptor;
+void criu_req__init(CriuReq *m);
+size_t criu_req__get_packed_size(const CriuReq *m);
+size_t criu_req__pack(const CriuReq *m, uint8_t *out);
+CriuReq *criu_req__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void criu_req__free_unpacked(CriuReq *m, ProtobufCAllocator *a);
+struct _CriuResp { ProtobufCMessage base;
+ CriuReqType type;
+ protobuf_c_boolean success;
+ CriuDumpResp *dump;
+ CriuRestoreResp *restore;
+};
+#define CRIU_RESP__INIT { PROTOBUF_C_MESSAGE_INIT(&criu_resp__descriptor) }
+extern const ProtobufCMessageDescriptor criu_resp__descriptor;
+void criu_resp__init(CriuResp *m);
+size_t criu_resp__get_packed_size(const CriuResp *m);
+size_t criu_resp__pack(const CriuResp *m, uint8_t *out);
+CriuResp *criu_resp__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void criu_resp__free_unpacked(CriuResp *m, ProtobufCAllocator *a);
+#endif
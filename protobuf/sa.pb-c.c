@@ -0,0 +1 @@
+#include "sa.pb-c.h"
@@ -0,0 +1,18 @@
+#ifndef __PB_SA__
+#define __PB_SA__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _SaEntry SaEntry;
+struct _SaEntry { ProtobufCMessage base;
+ uint64_t sigaction;
+ uint64_t flags;
+ uint64_t restorer;
+ uint64_t mask;
+};
+#define SA_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&sa_entry__descriptor) }
+extern const ProtobufCMessageDescriptor sa_entry__descriptor;
+void sa_entry__init(SaEntry *m);
+size_t sa_entry__get_packed_size(const SaEntry *m);
+size_t sa_entry__pack(const SaEntry *m, uint8_t *out);
+SaEntry *sa_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void sa_entry__free_unpacked(SaEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1 @@
+#include "siginfo.pb-c.h"
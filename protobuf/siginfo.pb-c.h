@@ -0,0 +1,15 @@
+#ifndef __PB_SIGINFO__
+#define __PB_SIGINFO__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _SiginfoEntry SiginfoEntry;
+struct _SiginfoEntry { ProtobufCMessage base;
+ ProtobufCBinaryData siginfo;
+};
+#define SIGINFO_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&siginfo_entry__descriptor) }
+extern const ProtobufCMessageDescriptor siginfo_entry__descriptor;
+void siginfo_entry__init(SiginfoEntry *m);
+size_t siginfo_entry__get_packed_size(const SiginfoEntry *m);
+size_t siginfo_entry__pack(const SiginfoEntry *m, uint8_t *out);
+SiginfoEntry *siginfo_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void siginfo_entry__free_unpacked(SiginfoEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1 @@
+#include "signalfd.pb-c.h"
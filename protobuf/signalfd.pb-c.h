@@ -0,0 +1,19 @@
+#ifndef __PB_SIGNALFD__
+#define __PB_SIGNALFD__
+#include <google/protobuf-c/protobuf-c.h>
+#include "fown.pb-c.h"
+typedef struct _SignalfdEntry SignalfdEntry;
+struct _SignalfdEntry { ProtobufCMessage base;
+ uint32_t id;
+ uint32_t flags;
+ FownEntry *fown;
+ uint64_t sigmask;
+};
+#define SIGNALFD_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&signalfd_entry__descriptor) }
+extern const ProtobufCMessageDescriptor signalfd_entry__descriptor;
+void signalfd_entry__init(SignalfdEntry *m);
+size_t signalfd_entry__get_packed_size(const SignalfdEntry *m);
+size_t signalfd_entry__pack(const SignalfdEntry *m, uint8_t *out);
+SignalfdEntry *signalfd_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void signalfd_entry__free_unpacked(SignalfdEntry *m, ProtobufCAllocator *a);
+#endif
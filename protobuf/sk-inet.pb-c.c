@@ -0,0 +1 @@
+#include "sk-inet.pb-c.h"
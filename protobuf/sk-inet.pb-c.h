@@ -0,0 +1,32 @@
+#ifndef __PB_SK_INET__
+#define __PB_SK_INET__
+#include <google/protobuf-c/protobuf-c.h>
+#include "fown.pb-c.h"
+#include "sk-opts.pb-c.h"
+typedef struct _InetSkEntry InetSkEntry;
+struct _InetSkEntry { ProtobufCMessage base;
+ uint32_t id;
+ uint32_t ino;
+ uint32_t family;
+ uint32_t type;
+ uint32_t proto;
+ uint32_t state;
+ uint32_t src_port;
+ uint32_t dst_port;
+ uint32_t flags;
+ uint32_t backlog;
+ size_t n_src_addr; uint32_t *src_addr;
+ size_t n_dst_addr; uint32_t *dst_addr;
+ FownEntry *fown;
+ SkOptsEntry *opts;
+ protobuf_c_boolean has_v6only;
+ protobuf_c_boolean v6only;
+};
+#define INET_SK_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&inet_sk_entry__descriptor) }
+extern const ProtobufCMessageDescriptor inet_sk_entry__descriptor;
+void inet_sk_entry__init(InetSkEntry *m);
+size_t inet_sk_entry__get_packed_size(const InetSkEntry *m);
+size_t inet_sk_entry__pack(const InetSkEntry *m, uint8_t *out);
+InetSkEntry *inet_sk_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void inet_sk_entry__free_unpacked(InetSkEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1,40 @@
+#ifndef __PB_SK_OPTS__
+#define __PB_SK_OPTS__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _SkOptsEntry SkOptsEntry;
+typedef enum _SkShutdown { SK_SHUTDOWN__NONE = 0, SK_SHUTDOWN__READ = 1, SK_SHUTDOWN__WRITE = 2, SK_SHUTDOWN__BOTH = 3 } SkShutdown;
+extern const ProtobufCEnumDescriptor sk_shutdown__descriptor;
+struct _SkOptsEntry { ProtobufCMessage base;
+ uint32_t so_sndbuf;
+ uint32_t so_rcvbuf;
+ uint64_t so_snd_tmo_sec;
+ uint64_t so_snd_tmo_usec;
+ uint64_t so_rcv_tmo_sec;
+ uint64_t so_rcv_tmo_usec;
+ protobuf_c_boolean has_reuseaddr;
+ protobuf_c_boolean reuseaddr;
+ protobuf_c_boolean has_so_priority;
+ uint32_t so_priority;
+ protobuf_c_boolean has_so_rcvlowat;
+ uint32_t so_rcvlowat;
+ protobuf_c_boolean has_so_mark;
+ uint32_t so_mark;
+ protobuf_c_boolean has_so_passcred;
+ protobuf_c_boolean so_passcred;
+ protobuf_c_boolean has_so_passsec;
+ protobuf_c_boolean so_passsec;
+ protobuf_c_boolean has_so_dontroute;
+ protobuf_c_boolean so_dontroute;
+ protobuf_c_boolean has_so_no_check;
+ protobuf_c_boolean so_no_check;
+ char *so_bound_dev;
+ size_t n_so_filter; uint64_t *so_filter;
+};
+#define SK_OPTS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&sk_opts_entry__descriptor) }
+extern const ProtobufCMessageDescriptor sk_opts_entry__descriptor;
+void sk_opts_entry__init(SkOptsEntry *m);
+size_t sk_opts_entry__get_packed_size(const SkOptsEntry *m);
+size_t sk_opts_entry__pack(const SkOptsEntry *m, uint8_t *out);
+SkOptsEntry *sk_opts_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void sk_opts_entry__free_unpacked(SkOptsEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1 @@
+#include "sk-packet.pb-c.h"
@@ -0,0 +1,16 @@
+#ifndef __PB_SK_PACKET__
+#define __PB_SK_PACKET__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _SkPacketEntry SkPacketEntry;
+struct _SkPacketEntry { ProtobufCMessage base;
+ uint32_t id_for;
+ uint32_t length;
+};
+#define SK_PACKET_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&sk_packet_entry__descriptor) }
+extern const ProtobufCMessageDescriptor sk_packet_entry__descriptor;
+void sk_packet_entry__init(SkPacketEntry *m);
+size_t sk_packet_entry__get_packed_size(const SkPacketEntry *m);
+size_t sk_packet_entry__pack(const SkPacketEntry *m, uint8_t *out);
+SkPacketEntry *sk_packet_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void sk_packet_entry__free_unpacked(SkPacketEntry *m, ProtobufCAllocator *a);
+#endif
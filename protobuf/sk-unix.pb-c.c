@@ -0,0 +1 @@
+#include "sk-unix.pb-c.h"
@@ -0,0 +1,43 @@
+#ifndef __PB_SK_UNIX__
+#define __PB_SK_UNIX__
+#include <google/protobuf-c/protobuf-c.h>
+#include "fown.pb-c.h"
+#include "sk-opts.pb-c.h"
+typedef struct _FilePermsEntry FilePermsEntry;
+typedef struct _UnixSkEntry UnixSkEntry;
+struct _FilePermsEntry { ProtobufCMessage base;
+ uint32_t mode;
+ uint32_t uid;
+ uint32_t gid;
+};
+#define FILE_PERMS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&file_perms_entry__descriptor) }
+extern const ProtobufCMessageDescriptor file_perms_entry__descriptor;
+void file_perms_entry__init(FilePermsEntry *m);
+size_t file_perms_entry__get_packed_size(const FilePermsEntry *m);
+size_t file_perms_entry__pack(const FilePermsEntry *m, uint8_t *out);
+FilePermsEntry *file_perms_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void file_perms_entry__free_unpacked(FilePermsEntry *m, ProtobufCAllocator *a);
+struct _UnixSkEntry { ProtobufCMessage base;
+ uint32_t id;
+ uint32_t ino;
+ uint32_t type;
+ uint32_t state;
+ uint32_t flags;
+ uint32_t uflags;
+ uint32_t backlog;
+ uint32_t peer;
+ FownEntry *fown;
+ SkOptsEntry *opts;
+ ProtobufCBinaryData name;
+ protobuf_c_boolean has_shutdown;
+ SkShutdown shutdown;
+ FilePermsEntry *file_perms;
+};
+#define UNIX_SK_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&unix_sk_entry__descriptor) }
+extern const ProtobufCMessageDescriptor unix_sk_entry__descriptor;
+void unix_sk_entry__init(UnixSkEntry *m);
+size_t unix_sk_entry__get_packed_size(const UnixSkEntry *m);
+size_t unix_sk_entry__pack(const UnixSkEntry *m, uint8_t *out);
+UnixSkEntry *unix_sk_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void unix_sk_entry__free_unpacked(UnixSkEntry *m, ProtobufCAllocator *a);
+#endif
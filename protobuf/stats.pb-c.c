@@ -0,0 +1 @@
+#include "stats.pb-c.h"
@@ -0,0 +1,94 @@
+#ifndef __PB_STATS__
+#define __PB_STATS__
+#include <google/protobuf-c/protobuf-c.h>
+#include "fdinfo.pb-c.h"
+typedef struct _FdTypeStatsEntry FdTypeStatsEntry;
+typedef struct _DumpStatsEntry DumpStatsEntry;
+typedef struct _RestoreStatsEntry RestoreStatsEntry;
+typedef struct _StatsEntry StatsEntry;
+struct _FdTypeStatsEntry { ProtobufCMessage base;
+ FdTypes type;
+ uint32_t count;
+ uint32_t time;
+};
+#define FD_TYPE_STATS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&fd_type_stats_entry__descriptor) }
+extern const ProtobufCMessageDescriptor fd_type_stats_entry__descriptor;
+void fd_type_stats_entry__init(FdTypeStatsEntry *m);
+size_t fd_type_stats_entry__get_packed_size(const FdTypeStatsEntry *m);
+size_t fd_type_stats_entry__pack(const FdTypeStatsEntry *m, uint8_t *out);
+FdTypeStatsEntry *fd_type_stats_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void fd_type_stats_entry__free_unpacked(FdTypeStatsEntry *m, ProtobufCAllocator *a);
+struct _DumpStatsEntry { ProtobufCMessage base;
+ uint32_t freezing_time;
+ uint32_t frozen_time;
+ uint32_t memdump_time;
+ uint32_t memwrite_time;
+ uint64_t pages_scanned;
+ uint64_t pages_skipped_parent;
+ uint64_t pages_written;
+ protobuf_c_boolean has_pages_zero;
+ uint64_t pages_zero;
+ protobuf_c_boolean has_infect_time;
+ uint32_t infect_time;
+ protobuf_c_boolean has_cure_time;
+ uint32_t cure_time;
+ protobuf_c_boolean has_files_time;
+ uint32_t files_time;
+ protobuf_c_boolean has_sockets_time;
+ uint32_t sockets_time;
+ protobuf_c_boolean has_mounts_time;
+ uint32_t mounts_time;
+ protobuf_c_boolean has_namespaces_time;
+ uint32_t namespaces_time;
+ protobuf_c_boolean has_shmem_time;
+ uint32_t shmem_time;
+ protobuf_c_boolean has_tasks;
+ uint32_t tasks;
+ protobuf_c_boolean has_pages_bytes;
+ uint64_t pages_bytes;
+ protobuf_c_boolean has_pages_rate;
+ uint32_t pages_rate;
+ size_t n_fd_types; FdTypeStatsEntry **fd_types;
+};
+#define DUMP_STATS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&dump_stats_entry__descriptor) }
+extern const ProtobufCMessageDescriptor dump_stats_entry__descriptor;
+void dump_stats_entry__init(DumpStatsEntry *m);
+size_t dump_stats_entry__get_packed_size(const DumpStatsEntry *m);
+size_t dump_stats_entry__pack(const DumpStatsEntry *m, uint8_t *out);
+DumpStatsEntry *dump_stats_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void dump_stats_entry__free_unpacked(DumpStatsEntry *m, ProtobufCAllocator *a);
+struct _RestoreStatsEntry { ProtobufCMessage base;
+ uint64_t pages_compared;
+ uint64_t pages_skipped_cow;
+ uint32_t forking_time;
+ uint32_t restore_time;
+ protobuf_c_boolean has_fds_time;
+ uint64_t fds_time;
+ protobuf_c_boolean has_premap_time;
+ uint64_t premap_time;
+ protobuf_c_boolean has_pages_read_time;
+ uint64_t pages_read_time;
+ protobuf_c_boolean has_sigreturn_time;
+ uint64_t sigreturn_time;
+ protobuf_c_boolean has_tasks;
+ uint32_t tasks;
+};
+#define RESTORE_STATS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&restore_stats_entry__descriptor) }
+extern const ProtobufCMessageDescriptor restore_stats_entry__descriptor;
+void restore_stats_entry__init(RestoreStatsEntry *m);
+size_t restore_stats_entry__get_packed_size(const RestoreStatsEntry *m);
+size_t restore_stats_entry__pack(const RestoreStatsEntry *m, uint8_t *out);
+RestoreStatsEntry *restore_stats_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void restore_stats_entry__free_unpacked(RestoreStatsEntry *m, ProtobufCAllocator *a);
+struct _StatsEntry { ProtobufCMessage base;
+ DumpStatsEntry *dump;
+ RestoreStatsEntry *restore;
+};
+#define STATS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&stats_entry__descriptor) }
+extern const ProtobufCMessageDescriptor stats_entry__descriptor;
+void stats_entry__init(StatsEntry *m);
+size_t stats_entry__get_packed_size(const StatsEntry *m);
+size_t stats_entry__pack(const StatsEntry *m, uint8_t *out);
+StatsEntry *stats_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void stats_entry__free_unpacked(StatsEntry *m, ProtobufCAllocator *a);
+#endif
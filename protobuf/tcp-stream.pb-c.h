@@ -0,0 +1,31 @@
+#ifndef __PB_TCP_STREAM__
+#define __PB_TCP_STREAM__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _TcpStreamEntry TcpStreamEntry;
+struct _TcpStreamEntry { ProtobufCMessage base;
+ uint32_t inq_len;
+ uint32_t inq_seq;
+ uint32_t outq_len;
+ uint32_t outq_seq;
+ uint32_t opt_mask;
+ uint32_t snd_wscale;
+ uint32_t mss_clamp;
+ protobuf_c_boolean has_rcv_wscale;
+ uint32_t rcv_wscale;
+ protobuf_c_boolean has_timestamp;
+ uint32_t timestamp;
+ protobuf_c_boolean has_cork;
+ protobuf_c_boolean cork;
+ protobuf_c_boolean has_nodelay;
+ protobuf_c_boolean nodelay;
+ protobuf_c_boolean has_unsq_len;
+ uint32_t unsq_len;
+};
+#define TCP_STREAM_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&tcp_stream_entry__descriptor) }
+extern const ProtobufCMessageDescriptor tcp_stream_entry__descriptor;
+void tcp_stream_entry__init(TcpStreamEntry *m);
+size_t tcp_stream_entry__get_packed_size(const TcpStreamEntry *m);
+size_t tcp_stream_entry__pack(const TcpStreamEntry *m, uint8_t *out);
+TcpStreamEntry *tcp_stream_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void tcp_stream_entry__free_unpacked(TcpStreamEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1 @@
+#include "timer.pb-c.h"
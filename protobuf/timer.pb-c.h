@@ -0,0 +1,38 @@
+#ifndef __PB_TIMER__
+#define __PB_TIMER__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _ItimerEntry ItimerEntry;
+typedef struct _PosixTimerEntry PosixTimerEntry;
+struct _ItimerEntry { ProtobufCMessage base;
+ uint64_t isec;
+ uint64_t iusec;
+ uint64_t vsec;
+ uint64_t vusec;
+};
+#define ITIMER_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&itimer_entry__descriptor) }
+extern const ProtobufCMessageDescriptor itimer_entry__descriptor;
+void itimer_entry__init(ItimerEntry *m);
+size_t itimer_entry__get_packed_size(const ItimerEntry *m);
+size_t itimer_entry__pack(const ItimerEntry *m, uint8_t *out);
+ItimerEntry *itimer_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void itimer_entry__free_unpacked(ItimerEntry *m, ProtobufCAllocator *a);
+struct _PosixTimerEntry { ProtobufCMessage base;
+ uint32_t it_id;
+ uint32_t clock_id;
+ uint32_t si_signo;
+ uint32_t it_sigev_notify;
+ uint64_t sival_ptr;
+ uint32_t overrun;
+ uint64_t isec;
+ uint64_t insec;
+ uint64_t vsec;
+ uint64_t vnsec;
+};
+#define POSIX_TIMER_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&posix_timer_entry__descriptor) }
+extern const ProtobufCMessageDescriptor posix_timer_entry__descriptor;
+void posix_timer_entry__init(PosixTimerEntry *m);
+size_t posix_timer_entry__get_packed_size(const PosixTimerEntry *m);
+size_t posix_timer_entry__pack(const PosixTimerEntry *m, uint8_t *out);
+PosixTimerEntry *posix_timer_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void posix_timer_entry__free_unpacked(PosixTimerEntry *m, ProtobufCAllocator *a);
+#endif
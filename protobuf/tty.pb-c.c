@@ -0,0 +1 @@
+#include "tty.pb-c.h"
@@ -0,0 +1,86 @@
+#ifndef __PB_TTY__
+#define __PB_TTY__
+#include <google/protobuf-c/protobuf-c.h>
+#include "fown.pb-c.h"
+typedef struct _WinsizeEntry WinsizeEntry;
+typedef struct _TermiosEntry TermiosEntry;
+typedef struct _TtyPtyEntry TtyPtyEntry;
+typedef struct _TtyInfoEntry TtyInfoEntry;
+typedef struct _TtyFileEntry TtyFileEntry;
+typedef enum _TtyType { TTY_TYPE__UNKNOWN = 0, TTY_TYPE__PTY = 1 } TtyType;
+extern const ProtobufCEnumDescriptor tty_type__descriptor;
+struct _WinsizeEntry { ProtobufCMessage base;
+ uint32_t ws_row;
+ uint32_t ws_col;
+ uint32_t ws_xpixel;
+ uint32_t ws_ypixel;
+};
+#define WINSIZE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&winsize_entry__descriptor) }
+extern const ProtobufCMessageDescriptor winsize_entry__descriptor;
+void winsize_entry__init(WinsizeEntry *m);
+size_t winsize_entry__get_packed_size(const WinsizeEntry *m);
+size_t winsize_entry__pack(const WinsizeEntry *m, uint8_t *out);
+WinsizeEntry *winsize_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void winsize_entry__free_unpacked(WinsizeEntry *m, ProtobufCAllocator *a);
+struct _TermiosEntry { ProtobufCMessage base;
+ uint32_t c_iflag;
+ uint32_t c_oflag;
+ uint32_t c_cflag;
+ uint32_t c_lflag;
+ uint32_t c_line;
+ uint32_t c_ispeed;
+ uint32_t c_ospeed;
+ size_t n_c_cc; uint32_t *c_cc;
+};
+#define TERMIOS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&termios_entry__descriptor) }
+extern const ProtobufCMessageDescriptor termios_entry__descriptor;
+void termios_entry__init(TermiosEntry *m);
+size_t termios_entry__get_packed_size(const TermiosEntry *m);
+size_t termios_entry__pack(const TermiosEntry *m, uint8_t *out);
+TermiosEntry *termios_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void termios_entry__free_unpacked(TermiosEntry *m, ProtobufCAllocator *a);
+struct _TtyPtyEntry { ProtobufCMessage base;
+ uint32_t index;
+};
+#define TTY_PTY_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&tty_pty_entry__descriptor) }
+extern const ProtobufCMessageDescriptor tty_pty_entry__descriptor;
+void tty_pty_entry__init(TtyPtyEntry *m);
+size_t tty_pty_entry__get_packed_size(const TtyPtyEntry *m);
+size_t tty_pty_entry__pack(const TtyPtyEntry *m, uint8_t *out);
+TtyPtyEntry *tty_pty_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void tty_pty_entry__free_unpacked(TtyPtyEntry *m, ProtobufCAllocator *a);
+struct _TtyInfoEntry { ProtobufCMessage base;
+ uint32_t id;
+ TtyType type;
+ protobuf_c_boolean locked;
+ protobuf_c_boolean exclusive;
+ protobuf_c_boolean packet_mode;
+ uint32_t sid;
+ uint32_t pgrp;
+ uint32_t rdev;
+ TermiosEntry *termios;
+ TermiosEntry *termios_locked;
+ WinsizeEntry *winsize;
+ TtyPtyEntry *pty;
+};
+#define TTY_INFO_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&tty_info_entry__descriptor) }
+extern const ProtobufCMessageDescriptor tty_info_entry__descriptor;
+void tty_info_entry__init(TtyInfoEntry *m);
+size_t tty_info_entry__get_packed_size(const TtyInfoEntry *m);
+size_t tty_info_entry__pack(const TtyInfoEntry *m, uint8_t *out);
+TtyInfoEntry *tty_info_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void tty_info_entry__free_unpacked(TtyInfoEntry *m, ProtobufCAllocator *a);
+struct _TtyFileEntry { ProtobufCMessage base;
+ uint32_t id;
+ uint32_t tty_info_id;
+ uint32_t flags;
+ FownEntry *fown;
+};
+#define TTY_FILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&tty_file_entry__descriptor) }
+extern const ProtobufCMessageDescriptor tty_file_entry__descriptor;
+void tty_file_entry__init(TtyFileEntry *m);
+size_t tty_file_entry__get_packed_size(const TtyFileEntry *m);
+size_t tty_file_entry__pack(const TtyFileEntry *m, uint8_t *out);
+TtyFileEntry *tty_file_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void tty_file_entry__free_unpacked(TtyFileEntry *m, ProtobufCAllocator *a);
+#endif
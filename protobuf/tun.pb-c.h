@@ -0,0 +1,34 @@
+#ifndef __PB_TUN__
+#define __PB_TUN__
+#include <google/protobuf-c/protobuf-c.h>
+#include "fown.pb-c.h"
+typedef struct _TunfileEntry TunfileEntry;
+typedef struct _TunLinkEntry TunLinkEntry;
+struct _TunfileEntry { ProtobufCMessage base;
+ uint32_t id;
+ char *netdev;
+ protobuf_c_boolean has_detached;
+ protobuf_c_boolean detached;
+};
+#define TUNFILE_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&tunfile_entry__descriptor) }
+extern const ProtobufCMessageDescriptor tunfile_entry__descriptor;
+void tunfile_entry__init(TunfileEntry *m);
+size_t tunfile_entry__get_packed_size(const TunfileEntry *m);
+size_t tunfile_entry__pack(const TunfileEntry *m, uint8_t *out);
+TunfileEntry *tunfile_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void tunfile_entry__free_unpacked(TunfileEntry *m, ProtobufCAllocator *a);
+struct _TunLinkEntry { ProtobufCMessage base;
+ uint32_t flags;
+ int32_t owner;
+ int32_t group;
+ uint32_t vnethdr;
+ uint32_t sndbuf;
+};
+#define TUN_LINK_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&tun_link_entry__descriptor) }
+extern const ProtobufCMessageDescriptor tun_link_entry__descriptor;
+void tun_link_entry__init(TunLinkEntry *m);
+size_t tun_link_entry__get_packed_size(const TunLinkEntry *m);
+size_t tun_link_entry__pack(const TunLinkEntry *m, uint8_t *out);
+TunLinkEntry *tun_link_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void tun_link_entry__free_unpacked(TunLinkEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1,16 @@
+#ifndef __PB_UTSNS__
+#define __PB_UTSNS__
+#include <google/protobuf-c/protobuf-c.h>
+typedef struct _UtsnsEntry UtsnsEntry;
+struct _UtsnsEntry { ProtobufCMessage base;
+ char *nodename;
+ char *domainname;
+};
+#define UTSNS_ENTRY__INIT { PROTOBUF_C_MESSAGE_INIT(&utsns_entry__descriptor) }
+extern const ProtobufCMessageDescriptor utsns_entry__descriptor;
+void utsns_entry__init(UtsnsEntry *m);
+size_t utsns_entry__get_packed_size(const UtsnsEntry *m);
+size_t utsns_entry__pack(const UtsnsEntry *m, uint8_t *out);
+UtsnsEntry *utsns_entry__unpack(ProtobufCAllocator *a, size_t len, const uint8_t *data);
+void utsns_entry__free_unpacked(UtsnsEntry *m, ProtobufCAllocator *a);
+#endif
@@ -0,0 +1 @@
+#include "vma.pb-c.h"
@@ -16,6 +16,46 @@
 
 struct pstree_item *root_item;
 
+#define PSTREE_HASH_SIZE	1024
+static struct hlist_head pstree_real_hash[PSTREE_HASH_SIZE];
+static struct hlist_head pstree_virt_hash[PSTREE_HASH_SIZE];
+
+void pstree_hash_real(struct pstree_item *item)
+{
+	hlist_del_init(&item->real_hash);
+	hlist_add_head(&item->real_hash,
+			&pstree_real_hash[(unsigned)item->pid.real % PSTREE_HASH_SIZE]);
+}
+
+void pstree_hash_virt(struct pstree_item *item)
+{
+	hlist_del_init(&item->virt_hash);
+	hlist_add_head(&item->virt_hash,
+			&pstree_virt_hash[(unsigned)item->pid.virt % PSTREE_HASH_SIZE]);
+}
+
+struct pstree_item *pstree_item_by_real(pid_t pid)
+{
+	struct pstree_item *item;
+
+	hlist_for_each_entry(item, &pstree_real_hash[(unsigned)pid % PSTREE_HASH_SIZE], real_hash)
+		if (item->pid.real == pid)
+			return item;
+
+	return NULL;
+}
+
+struct pstree_item *pstree_item_by_virt(pid_t pid)
+{
+	struct pstree_item *item;
+
+	hlist_for_each_entry(item, &pstree_virt_hash[(unsigned)pid % PSTREE_HASH_SIZE], virt_hash)
+		if (item->pid.virt == pid)
+			return item;
+
+	return NULL;
+}
+
 void core_entry_free(CoreEntry *core)
 {
 	if (core) {
@@ -123,6 +163,8 @@ void free_pstree(struct pstree_item *root_item)
 
 		parent = item->parent;
 		list_del(&item->sibling);
+		hlist_del_init(&item->real_hash);
+		hlist_del_init(&item->virt_hash);
 		pstree_free_cores(item);
 		xfree(item->threads);
 		xfree(item);
@@ -147,6 +189,8 @@ struct pstree_item *__alloc_pstree_item(bool rst)
 
 	INIT_LIST_HEAD(&item->children);
 	INIT_LIST_HEAD(&item->sibling);
+	INIT_HLIST_NODE(&item->real_hash);
+	INIT_HLIST_NODE(&item->virt_hash);
 
 	item->pid.virt = -1;
 	item->pid.real = -1;
@@ -311,6 +355,7 @@ static int read_pstree_image(void)
 
 		pi->pid.virt = e->pid;
 		max_pid = max((int)e->pid, max_pid);
+		pstree_hash_virt(pi);
 
 		pi->pgid = e->pgid;
 		max_pid = max((int)e->pgid, max_pid);
@@ -339,14 +384,11 @@ static int read_pstree_image(void)
 			}
 
 			if (parent == NULL) {
-				for_each_pstree_item(parent) {
-					if (parent->pid.virt == e->ppid)
-						break;
-				}
-
-				if (parent == NULL) {
+				parent = pstree_item_by_virt(e->ppid);
+				if (parent == NULL || parent == pi) {
 					pr_err("Can't find a parent for %d\n", pi->pid.virt);
 					pstree_entry__free_unpacked(e, NULL);
+					hlist_del_init(&pi->virt_hash);
 					xfree(pi);
 					goto err;
 				}
@@ -421,6 +463,7 @@ static int prepare_pstree_ids(void)
 		helper->pid.virt = item->sid;
 		helper->state = TASK_HELPER;
 		helper->parent = root_item;
+		pstree_hash_virt(helper);
 		list_add_tail(&helper->sibling, &helpers);
 		task_entries->nr_helpers++;
 
@@ -495,6 +538,7 @@ static int prepare_pstree_ids(void)
 
 			child->pgid = item->pgid;
 			child->pid.virt = ++max_pid;
+			pstree_hash_virt(child);
 			child->parent = item;
 			list_move(&child->sibling, &item->children);
 
@@ -515,11 +559,7 @@ static int prepare_pstree_ids(void)
 		if (!item->pgid || item->pid.virt == item->pgid)
 			continue;
 
-		for_each_pstree_item(gleader) {
-			if (gleader->pid.virt == item->pgid)
-				break;
-		}
-
+		gleader = pstree_item_by_virt(item->pgid);
 		if (gleader) {
 			item->rst->pgrp_leader = gleader;
 			continue;
@@ -541,6 +581,7 @@ static int prepare_pstree_ids(void)
 		helper->pid.virt = item->pgid;
 		helper->state = TASK_HELPER;
 		helper->parent = item;
+		pstree_hash_virt(helper);
 		list_add(&helper->sibling, &item->children);
 		task_entries->nr_helpers++;
 		item->rst->pgrp_leader = helper;
@@ -687,12 +728,5 @@ bool restore_before_setsid(struct pstree_item *child)
 
 bool pid_in_pstree(pid_t pid)
 {
-	struct pstree_item *item;
-
-	for_each_pstree_item(item) {
-		if (item->pid.real == pid)
-			return true;
-	}
-
-	return false;
+	return pstree_item_by_real(pid) != NULL;
 }
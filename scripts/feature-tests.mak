@@ -55,3 +55,32 @@ int main(void)
 	return strlcat(dst, src, sizeof(dst));
 }
 endef
+
+define UFFD_TEST
+
+#include <linux/userfaultfd.h>
+
+int main(void)
+{
+	struct uffdio_api api = {
+		.api = UFFD_API,
+		.features = UFFD_FEATURE_EVENT_UNMAP,
+	};
+	struct uffd_msg msg;
+
+	msg.event = UFFD_EVENT_FORK;
+	msg.arg.remove.start = 0;
+
+	return (int)api.api;
+}
+endef
+
+define ZLIB_TEST
+
+#include <zlib.h>
+
+int main(void)
+{
+	return compressBound(4096) < 4096;
+}
+endef
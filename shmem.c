@@ -10,6 +10,7 @@
 #include "page-xfer.h"
 #include "rst-malloc.h"
 #include "vma.h"
+#include "compress.h"
 
 #include "protobuf.h"
 #include "protobuf/pagemap.pb-c.h"
@@ -144,6 +145,7 @@ static int shmem_wait_and_open(int pid, struct shmem_info *si)
 static int restore_shmem_content(void *addr, struct shmem_info *si)
 {
 	int fd, fd_pg, ret = 0;
+	void *zbuf = NULL;
 
 	fd = open_image(CR_FD_SHMEM_PAGEMAP, O_RSTR, si->shmid);
 	if (fd < 0) {
@@ -157,7 +159,7 @@ static int restore_shmem_content(void *addr, struct shmem_info *si)
 	}
 
 	while (1) {
-		unsigned long vaddr;
+		unsigned long vaddr, comp_len = 0;
 		unsigned nr_pages;
 
 		if (fd >= 0) {
@@ -169,6 +171,13 @@ static int restore_shmem_content(void *addr, struct shmem_info *si)
 
 			vaddr = (unsigned long)decode_pointer(pe->vaddr);
 			nr_pages = pe->nr_pages;
+			if (pe->has_comp_len)
+				comp_len = pe->comp_len;
+			if (pe->zero) {
+				/* Fresh shmem is zeroed already */
+				pagemap_entry__free_unpacked(pe, NULL);
+				continue;
+			}
 
 			pagemap_entry__free_unpacked(pe, NULL);
 		} else {
@@ -185,6 +194,25 @@ static int restore_shmem_content(void *addr, struct shmem_info *si)
 		if (vaddr + nr_pages * PAGE_SIZE > si->size)
 			break;
 
+		if (comp_len) {
+			if (!zbuf) {
+				zbuf = xmalloc(compress_bound(COMPRESS_CHUNK_SIZE));
+				if (!zbuf) {
+					ret = -1;
+					break;
+				}
+			}
+
+			if (nr_pages > COMPRESS_CHUNK_PAGES ||
+			    read_compressed_pages(fd_pg, zbuf, comp_len, addr + vaddr,
+					    nr_pages * PAGE_SIZE)) {
+				ret = -1;
+				break;
+			}
+
+			continue;
+		}
+
 		ret = read(fd_pg, addr + vaddr, nr_pages * PAGE_SIZE);
 		if (ret != nr_pages * PAGE_SIZE) {
 			ret = -1;
@@ -193,6 +221,7 @@ static int restore_shmem_content(void *addr, struct shmem_info *si)
 
 	}
 
+	xfree(zbuf);
 	close_safe(&fd_pg);
 	close_safe(&fd);
 	return ret;
@@ -311,10 +340,8 @@ int add_shmem_area(pid_t pid, VmaEntry *vma)
 
 static int dump_one_shmem(struct shmem_info_dump *si)
 {
-	struct iovec *iovs;
 	struct page_pipe *pp;
 	struct page_pipe_buf *ppb;
-	struct page_xfer xfer;
 	int err, ret = -1, fd;
 	unsigned char *map = NULL;
 	void *addr = NULL;
@@ -350,13 +377,9 @@ static int dump_one_shmem(struct shmem_info_dump *si)
 	if (err)
 		goto err_unmap;
 
-	iovs = xmalloc(((nrpages + 1) / 2) * sizeof(struct iovec));
-	if (!iovs)
-		goto err_unmap;
-
-	pp = create_page_pipe((nrpages + 1) / 2, iovs);
+	pp = create_page_pipe(0);
 	if (!pp)
-		goto err_iovs;
+		goto err_unmap;
 
 	for (pfn = 0; pfn < nrpages; pfn++) {
 		if (!(map[pfn] & PAGE_RSS))
@@ -374,17 +397,9 @@ static int dump_one_shmem(struct shmem_info_dump *si)
 			goto err_pp;
 		}
 
-	err = open_page_xfer(&xfer, CR_FD_SHMEM_PAGEMAP, si->shmid);
-	if (err)
-		goto err_pp;
-
-	ret = page_xfer_dump_pages(&xfer, pp, (unsigned long)addr);
-
-	xfer.close(&xfer);
+	ret = dump_page_pipe(pp, CR_FD_SHMEM_PAGEMAP, si->shmid, (unsigned long)addr);
 err_pp:
 	destroy_page_pipe(pp);
-err_iovs:
-	xfree(iovs);
 err_unmap:
 	munmap(addr,  si->size);
 err:
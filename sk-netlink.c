@@ -32,6 +32,9 @@ int netlink_receive_one(struct nlmsghdr *hdr, void *arg)
 	unsigned long *groups;
 
 	m = NLMSG_DATA(hdr);
+	if (!sk_ino_wanted(m->ndiag_ino))
+		return 0;
+
 	pr_info("Collect netlink sock 0x%x\n", m->ndiag_ino);
 
 	sd = xmalloc(sizeof(*sd));
@@ -63,15 +63,44 @@ struct unix_sk_listen_icon {
 	struct unix_sk_listen_icon	*next;
 };
 
-#define SK_HASH_SIZE		32
+#define ICONS_HASH_SIZE_MIN	64
 
-static struct unix_sk_listen_icon *unix_listen_icons[SK_HASH_SIZE];
+/* Grows the same way as the sockets hash does */
+static struct unix_sk_listen_icon **unix_listen_icons;
+static unsigned int icons_hash_size;
+static unsigned int nr_icons;
 
-static struct unix_sk_listen_icon *lookup_unix_listen_icons(int peer_ino)
+static int icons_hash_grow(void)
+{
+	unsigned int i, size = icons_hash_size ? icons_hash_size * 2 : ICONS_HASH_SIZE_MIN;
+	struct unix_sk_listen_icon **hash, *ic, *next;
+
+	hash = xzalloc(size * sizeof(*hash));
+	if (!hash)
+		return -1;
+
+	for (i = 0; i < icons_hash_size; i++)
+		for (ic = unix_listen_icons[i]; ic; ic = next) {
+			next = ic->next;
+			ic->next = hash[ic->peer_ino % size];
+			hash[ic->peer_ino % size] = ic;
+		}
+
+	xfree(unix_listen_icons);
+	unix_listen_icons = hash;
+	icons_hash_size = size;
+
+	return 0;
+}
+
+static struct unix_sk_listen_icon *lookup_unix_listen_icons(unsigned int peer_ino)
 {
 	struct unix_sk_listen_icon *ic;
 
-	for (ic = unix_listen_icons[peer_ino % SK_HASH_SIZE];
+	if (!unix_listen_icons)
+		return NULL;
+
+	for (ic = unix_listen_icons[peer_ino % icons_hash_size];
 			ic; ic = ic->next)
 		if (ic->peer_ino == peer_ino)
 			return ic;
@@ -469,16 +498,21 @@ static int unix_collect_one(const struct unix_diag_msg *m,
 		 */
 		for (i = 0; i < d->nr_icons; i++) {
 			struct unix_sk_listen_icon *e, **chain;
-			int n;
+			unsigned int n;
+
+			if (nr_icons >= icons_hash_size &&
+					icons_hash_grow() && !unix_listen_icons)
+				goto err;
 
 			e = xzalloc(sizeof(*e));
 			if (!e)
 				goto err;
 
 			n = d->icons[i];
-			chain = &unix_listen_icons[n % SK_HASH_SIZE];
+			chain = &unix_listen_icons[n % icons_hash_size];
 			e->next = *chain;
 			*chain = e;
+			nr_icons++;
 
 			pr_debug("\t\tCollected icon %d\n", d->icons[i]);
 
@@ -510,6 +544,7 @@ skip:
 	return ret;
 }
 
+/* When arg is given, the socket's peer inode is put there */
 int unix_receive_one(struct nlmsghdr *h, void *arg)
 {
 	struct unix_diag_msg *m = NLMSG_DATA(h);
@@ -518,6 +553,9 @@ int unix_receive_one(struct nlmsghdr *h, void *arg)
 	parse_rtattr(tb, UNIX_DIAG_MAX, (struct rtattr *)(m + 1),
 		     h->nlmsg_len - NLMSG_LENGTH(sizeof(*m)));
 
+	if (arg && tb[UNIX_DIAG_PEER])
+		*(unsigned int *)arg = *(u32 *)RTA_DATA(tb[UNIX_DIAG_PEER]);
+
 	return unix_collect_one(m, tb);
 }
 
@@ -7,6 +7,8 @@
 #include <linux/if.h>
 #include <linux/filter.h>
 #include <string.h>
+#include <stdlib.h>
+#include <dirent.h>
 
 #include "libnetlink.h"
 #include "sockets.h"
@@ -19,6 +21,7 @@
 #include "sk-packet.h"
 #include "namespaces.h"
 #include "net.h"
+#include "pstree.h"
 
 #ifndef NETLINK_SOCK_DIAG
 #define NETLINK_SOCK_DIAG NETLINK_INET_DIAG
@@ -32,7 +35,7 @@
 #define SOCKFS_MAGIC	0x534F434B
 #endif
 
-#define SK_HASH_SIZE		32
+#define SK_HASH_SIZE_MIN	256
 
 #ifndef SO_GET_FILTER
 #define SO_GET_FILTER	SO_ATTACH_FILTER
@@ -229,7 +232,51 @@ static int restore_socket_filter(int sk, SkOptsEntry *soe)
 	return ret;
 }
 
-static struct socket_desc *sockets[SK_HASH_SIZE];
+/*
+ * Collected sockets hashed by inode. There can be anything from
+ * a few to hundreds of thousands of them, so the table doubles
+ * once it has as many sockets as chains.
+ */
+static struct socket_desc **sockets;
+static unsigned int sk_hash_size;
+static unsigned int nr_sockets;
+
+static int sk_hash_grow(void)
+{
+	unsigned int i, size = sk_hash_size ? sk_hash_size * 2 : SK_HASH_SIZE_MIN;
+	struct socket_desc **hash, *sd, *next;
+
+	hash = xzalloc(size * sizeof(*hash));
+	if (!hash)
+		return -1;
+
+	for (i = 0; i < sk_hash_size; i++)
+		for (sd = sockets[i]; sd; sd = next) {
+			next = sd->next;
+			sd->next = hash[sd->ino % size];
+			hash[sd->ino % size] = sd;
+		}
+
+	xfree(sockets);
+	sockets = hash;
+	sk_hash_size = size;
+
+	return 0;
+}
+
+static struct socket_desc *__lookup_socket(unsigned int ino)
+{
+	struct socket_desc *sd;
+
+	if (!sockets)
+		return NULL;
+
+	for (sd = sockets[ino % sk_hash_size]; sd; sd = sd->next)
+		if (sd->ino == ino)
+			return sd;
+
+	return NULL;
+}
 
 struct socket_desc *lookup_socket(int ino, int family, int proto)
 {
@@ -242,30 +289,129 @@ struct socket_desc *lookup_socket(int ino, int family, int proto)
 	}
 
 	pr_debug("\tSearching for socket %x (family %d)\n", ino, family);
-	for (sd = sockets[ino % SK_HASH_SIZE]; sd; sd = sd->next)
-		if (sd->ino == ino) {
-			BUG_ON(sd->family != family);
-			return sd;
-		}
+	sd = __lookup_socket(ino);
+	if (sd)
+		BUG_ON(sd->family != family);
 
-	return NULL;
+	return sd;
 }
 
 int sk_collect_one(int ino, int family, struct socket_desc *d)
 {
 	struct socket_desc **chain;
 
+	/* Failing to grow just makes chains longer */
+	if (nr_sockets >= sk_hash_size && sk_hash_grow() && !sockets)
+		return -1;
+
 	d->ino		= ino;
 	d->family	= family;
 	d->already_dumped = 0;
 
-	chain = &sockets[ino % SK_HASH_SIZE];
+	chain = &sockets[d->ino % sk_hash_size];
 	d->next = *chain;
 	*chain = d;
+	nr_sockets++;
 
 	return 0;
 }
 
+/*
+ * When the net namespace is not dumped it can be shared with
+ * lots of other tasks and their sockets are of no interest for
+ * us. In this case only the sockets the dumped tasks have fds
+ * for are collected (plus the peers and listeners unix ones need).
+ * The inodes of those are kept sorted here.
+ */
+static bool filter_inos;
+static unsigned int *wanted_inos;
+static unsigned int nr_wanted_inos;
+
+static int cmp_ino(const void *a, const void *b)
+{
+	unsigned int x = *(unsigned int *)a, y = *(unsigned int *)b;
+
+	return x < y ? -1 : x > y;
+}
+
+static int collect_task_sk_inos(pid_t pid, unsigned int *size)
+{
+	struct dirent *de;
+	char link[32];
+	unsigned int ino;
+	DIR *fd_dir;
+	int len, ret = 0;
+
+	fd_dir = opendir_proc(pid, "fd");
+	if (!fd_dir)
+		return -1;
+
+	while ((de = readdir(fd_dir))) {
+		if (dir_dots(de))
+			continue;
+
+		len = readlinkat(dirfd(fd_dir), de->d_name, link, sizeof(link) - 1);
+		if (len < 0)
+			continue; /* Not a socket for sure */
+
+		link[len] = '\0';
+		if (sscanf(link, "socket:[%u]", &ino) != 1)
+			continue;
+
+		if (nr_wanted_inos == *size) {
+			*size = *size ? *size * 2 : 64;
+			wanted_inos = xrealloc(wanted_inos, *size * sizeof(*wanted_inos));
+			if (!wanted_inos) {
+				ret = -1;
+				break;
+			}
+		}
+
+		wanted_inos[nr_wanted_inos++] = ino;
+	}
+
+	closedir(fd_dir);
+	return ret;
+}
+
+static int collect_wanted_inos(void)
+{
+	struct pstree_item *item;
+	unsigned int i, n, size = 0;
+
+	for_each_pstree_item(item) {
+		if (item->state == TASK_DEAD)
+			continue;
+
+		if (collect_task_sk_inos(item->pid.real, &size)) {
+			xfree(wanted_inos);
+			wanted_inos = NULL;
+			nr_wanted_inos = 0;
+			return -1;
+		}
+	}
+
+	qsort(wanted_inos, nr_wanted_inos, sizeof(*wanted_inos), cmp_ino);
+
+	for (i = 0, n = 0; i < nr_wanted_inos; i++)
+		if (!n || wanted_inos[n - 1] != wanted_inos[i])
+			wanted_inos[n++] = wanted_inos[i];
+	nr_wanted_inos = n;
+	filter_inos = true;
+
+	pr_info("%u sockets are used by the dumped tasks\n", nr_wanted_inos);
+	return 0;
+}
+
+bool sk_ino_wanted(unsigned int ino)
+{
+	if (!filter_inos)
+		return true;
+
+	return nr_wanted_inos && bsearch(&ino, wanted_inos, nr_wanted_inos,
+			sizeof(*wanted_inos), cmp_ino) != NULL;
+}
+
 int do_restore_opt(int sk, int level, int name, void *val, int len)
 {
 	if (setsockopt(sk, level, name, val, len) < 0) {
@@ -477,8 +623,12 @@ int dump_socket(struct fd_parms *p, int lfd, const int fdinfo)
 static int inet_receive_one(struct nlmsghdr *h, void *arg)
 {
 	struct inet_diag_req_v2 *i = arg;
+	struct inet_diag_msg *m = NLMSG_DATA(h);
 	int type;
 
+	if (!sk_ino_wanted(m->idiag_inode))
+		return 0;
+
 	switch (i->sdiag_protocol) {
 	case IPPROTO_TCP:
 		type = SOCK_STREAM;
@@ -518,6 +668,58 @@ static int do_collect_req(int nl, struct sock_diag_req *req, int size,
 	return tmp;
 }
 
+/*
+ * Get a unix socket by its inode, then its peer and so on, as
+ * we need both ends of a pair to dump it.
+ */
+static int collect_unix_sk(int nl, struct sock_diag_req *req, unsigned int ino)
+{
+	int ret;
+
+	while (ino && !__lookup_socket(ino)) {
+		req->r.u.udiag_ino = ino;
+		ino = 0;
+
+		ret = do_rtnl_req(nl, req, sizeof(*req), unix_receive_one, &ino);
+		if (ret == -ENOENT)
+			/* Not a unix one */
+			return 0;
+		if (ret)
+			return ret;
+	}
+
+	return 0;
+}
+
+static int collect_wanted_unix(int nl)
+{
+	struct sock_diag_req req;
+	unsigned int i;
+	int ret;
+
+	memset(&req, 0, sizeof(req));
+	req.hdr.nlmsg_len	= sizeof(req);
+	req.hdr.nlmsg_type	= SOCK_DIAG_BY_FAMILY;
+	req.hdr.nlmsg_flags	= NLM_F_REQUEST | NLM_F_ACK;
+	req.hdr.nlmsg_seq	= CR_NLMSG_SEQ;
+
+	req.r.u.sdiag_family	= AF_UNIX;
+	req.r.u.udiag_states	= -1; /* All */
+	req.r.u.udiag_show	= UDIAG_SHOW_NAME | UDIAG_SHOW_VFS |
+				  UDIAG_SHOW_PEER | UDIAG_SHOW_ICONS |
+				  UDIAG_SHOW_RQLEN;
+	req.r.u.udiag_cookie[0]	= INET_DIAG_NOCOOKIE;
+	req.r.u.udiag_cookie[1]	= INET_DIAG_NOCOOKIE;
+
+	for (i = 0; i < nr_wanted_inos; i++) {
+		ret = collect_unix_sk(nl, &req, wanted_inos[i]);
+		if (ret)
+			return ret;
+	}
+
+	return 0;
+}
+
 int collect_sockets(int pid)
 {
 	int err = 0, tmp;
@@ -530,6 +732,9 @@ int collect_sockets(int pid)
 
 		if (switch_ns(pid, &net_ns_desc, &rst))
 			return -1;
+	} else if (pid != 0) {
+		if (collect_wanted_inos())
+			return -1;
 	}
 
 	nl = socket(PF_NETLINK, SOCK_RAW, NETLINK_SOCK_DIAG);
@@ -545,9 +750,14 @@ int collect_sockets(int pid)
 	req.hdr.nlmsg_flags	= NLM_F_DUMP | NLM_F_REQUEST;
 	req.hdr.nlmsg_seq	= CR_NLMSG_SEQ;
 
-	/* Collect UNIX sockets */
+	/*
+	 * Collect UNIX sockets. With the filter only the listening
+	 * ones are dumped in bulk, as in-flight connections are only
+	 * seen in their icons, the rest is requested one by one in
+	 * the end, when sockets of other families are known.
+	 */
 	req.r.u.sdiag_family	= AF_UNIX;
-	req.r.u.udiag_states	= -1; /* All */
+	req.r.u.udiag_states	= filter_inos ? (1 << TCP_LISTEN) : -1; /* All */
 	req.r.u.udiag_show	= UDIAG_SHOW_NAME | UDIAG_SHOW_VFS |
 				  UDIAG_SHOW_PEER | UDIAG_SHOW_ICONS |
 				  UDIAG_SHOW_RQLEN;
@@ -632,8 +842,19 @@ int collect_sockets(int pid)
 			err = tmp;
 	}
 
+	if (filter_inos) {
+		tmp = collect_wanted_unix(nl);
+		if (tmp)
+			err = tmp;
+	}
+
 	close(nl);
 out:
+	xfree(wanted_inos);
+	wanted_inos = NULL;
+	nr_wanted_inos = 0;
+	filter_inos = false;
+
 	if (rst >= 0) {
 		if (restore_ns(rst, &net_ns_desc) < 0)
 			err = -1;
@@ -1,27 +1,59 @@
 #include <unistd.h>
 #include <fcntl.h>
+#include <signal.h>
 #include <sys/time.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
 #include "asm/atomic.h"
+#include "cr_options.h"
 #include "protobuf.h"
 #include "stats.h"
 #include "image.h"
 #include "protobuf/stats.pb-c.h"
+#include "protobuf/fdinfo.pb-c.h"
+
+#define FD_TYPES_NR_STATS	(FD_TYPES__EXT + 1)
 
 struct timing {
 	struct timeval start;
 	struct timeval total;
 };
 
+/*
+ * Both dump and restore stats are in shared memory, so that the
+ * progress server (see below) sees them as they change.
+ */
+struct progress {
+	int		phase;
+	unsigned int	nr_tasks;
+};
+
 struct dump_stats {
+	struct progress	progress;
 	struct timing	timings[DUMP_TIME_NR_STATS];
 	unsigned long	counts[DUMP_CNT_NR_STATS];
+	atomic_t	xfer_pages;	/* page writers run in parallel */
+	struct timing	fd_timings[FD_TYPES_NR_STATS];
+	unsigned int	fd_counts[FD_TYPES_NR_STATS];
 };
 
+/*
+ * Restore timings are taken by all the tasks, so the start
+ * points are per-process and the totals (in usec) are in the
+ * shared memory. The per-task ones are summed over thousands
+ * of tasks, thus the 64 bits.
+ */
 struct restore_stats {
-	struct timing	timings[RESTORE_TIME_NS_STATS];
+	struct progress	progress;
+	u64		timings[RESTORE_TIME_NS_STATS];
 	atomic_t	counts[RESTORE_CNT_NR_STATS];
 };
 
+static struct timeval rst_starts[RESTORE_TIME_NS_STATS];
+
 struct dump_stats *dstats;
 struct restore_stats *rstats;
 
@@ -29,7 +61,10 @@ void cnt_add(int c, unsigned long val)
 {
 	if (dstats != NULL) {
 		BUG_ON(c >= DUMP_CNT_NR_STATS);
-		dstats->counts[c] += val;
+		if (c == CNT_PAGES_XFERED)
+			atomic_add(val, &dstats->xfer_pages);
+		else
+			dstats->counts[c] += val;
 	} else if (rstats != NULL) {
 		BUG_ON(c >= RESTORE_CNT_NR_STATS);
 		atomic_add(val, &rstats->counts[c]);
@@ -37,6 +72,22 @@ void cnt_add(int c, unsigned long val)
 		BUG();
 }
 
+unsigned long cnt_get(int c)
+{
+	if (dstats != NULL) {
+		BUG_ON(c >= DUMP_CNT_NR_STATS);
+		if (c == CNT_PAGES_XFERED)
+			return atomic_read(&dstats->xfer_pages);
+		return dstats->counts[c];
+	} else if (rstats != NULL) {
+		BUG_ON(c >= RESTORE_CNT_NR_STATS);
+		return atomic_read(&rstats->counts[c]);
+	}
+
+	BUG();
+	return 0;
+}
+
 static void timeval_accumulate(const struct timeval *from, const struct timeval *to,
 		struct timeval *res)
 {
@@ -55,48 +106,108 @@ static void timeval_accumulate(const struct timeval *from, const struct timeval
 	}
 }
 
-static struct timing *get_timing(int t)
+void timing_start(int t)
 {
 	if (dstats != NULL) {
 		BUG_ON(t >= DUMP_TIME_NR_STATS);
-		return &dstats->timings[t];
+		gettimeofday(&dstats->timings[t].start, NULL);
 	} else if (rstats != NULL) {
-		/*
-		 * FIXME -- this does _NOT_ work when called
-		 * from different tasks.
-		 */
 		BUG_ON(t >= RESTORE_TIME_NS_STATS);
-		return &rstats->timings[t];
-	}
-
-	BUG();
-	return NULL;
+		gettimeofday(&rst_starts[t], NULL);
+	} else
+		BUG();
 }
 
-void timing_start(int t)
+void timing_stop(int t)
 {
-	struct timing *tm;
+	struct timeval now, delta = { };
+
+	gettimeofday(&now, NULL);
+
+	if (dstats != NULL) {
+		struct timing *tm;
+
+		BUG_ON(t >= DUMP_TIME_NR_STATS);
+		tm = &dstats->timings[t];
+		timeval_accumulate(&tm->start, &now, &tm->total);
+	} else if (rstats != NULL) {
+		BUG_ON(t >= RESTORE_TIME_NS_STATS);
+		timeval_accumulate(&rst_starts[t], &now, &delta);
+		__sync_fetch_and_add(&rstats->timings[t],
+				(u64)delta.tv_sec * USEC_PER_SEC + delta.tv_usec);
+	} else
+		BUG();
+}
 
-	tm = get_timing(t);
-	gettimeofday(&tm->start, NULL);
+/*
+ * Files are not nested into each other, so one start
+ * point is enough for all the types.
+ */
+void fd_timing_start(void)
+{
+	BUG_ON(dstats == NULL);
+	gettimeofday(&dstats->fd_timings[0].start, NULL);
 }
 
-void timing_stop(int t)
+void fd_timing_stop(int type)
 {
-	struct timing *tm;
 	struct timeval now;
 
-	tm = get_timing(t);
+	if (type <= 0 || type >= FD_TYPES_NR_STATS)
+		type = 0;
+
 	gettimeofday(&now, NULL);
-	timeval_accumulate(&tm->start, &now, &tm->total);
+	timeval_accumulate(&dstats->fd_timings[0].start, &now,
+			&dstats->fd_timings[type].total);
+	dstats->fd_counts[type]++;
+}
+
+static u_int32_t timing_usec(struct timing *tm)
+{
+	return tm->total.tv_sec * USEC_PER_SEC + tm->total.tv_usec;
 }
 
 static void encode_time(int t, u_int32_t *to)
 {
-	struct timing *tm;
+	if (dstats != NULL)
+		*to = timing_usec(&dstats->timings[t]);
+	else
+		*to = rstats->timings[t];
+}
+
+static void encode_opt_time(int t, protobuf_c_boolean *has, u_int32_t *to)
+{
+	*has = true;
+	encode_time(t, to);
+}
 
-	tm = get_timing(t);
-	*to = tm->total.tv_sec * USEC_PER_SEC + tm->total.tv_usec;
+static void encode_rst_sum_time(int t, protobuf_c_boolean *has, u64 *to)
+{
+	*has = true;
+	*to = rstats->timings[t];
+}
+
+static FdTypeStatsEntry **encode_fd_stats(size_t *n)
+{
+	static FdTypeStatsEntry entries[FD_TYPES_NR_STATS];
+	static FdTypeStatsEntry *ptrs[FD_TYPES_NR_STATS];
+	int i;
+
+	*n = 0;
+	for (i = 0; i < FD_TYPES_NR_STATS; i++) {
+		FdTypeStatsEntry *e = &entries[*n];
+
+		if (!dstats->fd_counts[i])
+			continue;
+
+		fd_type_stats_entry__init(e);
+		e->type = i;
+		e->count = dstats->fd_counts[i];
+		e->time = timing_usec(&dstats->fd_timings[i]);
+		ptrs[(*n)++] = e;
+	}
+
+	return ptrs;
 }
 
 void write_stats(int what)
@@ -119,6 +230,30 @@ void write_stats(int what)
 		ds_entry.pages_scanned = dstats->counts[CNT_PAGES_SCANNED];
 		ds_entry.pages_skipped_parent = dstats->counts[CNT_PAGES_SKIPPED_PARENT];
 		ds_entry.pages_written = dstats->counts[CNT_PAGES_WRITTEN];
+		ds_entry.has_pages_zero = true;
+		ds_entry.pages_zero = dstats->counts[CNT_PAGES_ZERO];
+
+		encode_opt_time(TIME_INFECT, &ds_entry.has_infect_time, &ds_entry.infect_time);
+		encode_opt_time(TIME_CURE, &ds_entry.has_cure_time, &ds_entry.cure_time);
+		encode_opt_time(TIME_FILES, &ds_entry.has_files_time, &ds_entry.files_time);
+		encode_opt_time(TIME_SOCKETS, &ds_entry.has_sockets_time, &ds_entry.sockets_time);
+		encode_opt_time(TIME_MOUNTS, &ds_entry.has_mounts_time, &ds_entry.mounts_time);
+		encode_opt_time(TIME_NAMESPACES, &ds_entry.has_namespaces_time, &ds_entry.namespaces_time);
+		encode_opt_time(TIME_SHMEM, &ds_entry.has_shmem_time, &ds_entry.shmem_time);
+
+		ds_entry.has_tasks = true;
+		ds_entry.tasks = dstats->counts[CNT_TASKS_DUMPED];
+
+		/* Pages as they go to xfer, i.e. before compression */
+		ds_entry.has_pages_bytes = true;
+		ds_entry.pages_bytes = (u64)ds_entry.pages_written * PAGE_SIZE;
+		if (ds_entry.memwrite_time) {
+			ds_entry.has_pages_rate = true;
+			ds_entry.pages_rate = ds_entry.pages_bytes * USEC_PER_SEC /
+				1024 / ds_entry.memwrite_time;
+		}
+
+		ds_entry.fd_types = encode_fd_stats(&ds_entry.n_fd_types);
 
 		name = "dump";
 	} else if (what == RESTORE_STATS) {
@@ -129,6 +264,13 @@ void write_stats(int what)
 
 		encode_time(TIME_FORK, &rs_entry.forking_time);
 		encode_time(TIME_RESTORE, &rs_entry.restore_time);
+		encode_rst_sum_time(TIME_FDS, &rs_entry.has_fds_time, &rs_entry.fds_time);
+		encode_rst_sum_time(TIME_PREMAP, &rs_entry.has_premap_time, &rs_entry.premap_time);
+		encode_rst_sum_time(TIME_PAGES_READ, &rs_entry.has_pages_read_time, &rs_entry.pages_read_time);
+		encode_rst_sum_time(TIME_SIGRETURN, &rs_entry.has_sigreturn_time, &rs_entry.sigreturn_time);
+
+		rs_entry.has_tasks = true;
+		rs_entry.tasks = atomic_read(&rstats->counts[CNT_TASKS_RESTORED]);
 
 		name = "restore";
 	} else
@@ -144,10 +286,210 @@ void write_stats(int what)
 int init_stats(int what)
 {
 	if (what == DUMP_STATS) {
-		dstats = xmalloc(sizeof(*dstats));
-		return dstats ? 0 : -1;
+		dstats = mmap(NULL, sizeof(*dstats), PROT_READ | PROT_WRITE,
+				MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+		if (dstats == MAP_FAILED) {
+			pr_perror("Can't map dump stats");
+			dstats = NULL;
+			return -1;
+		}
+
+		return 0;
 	}
 
 	rstats = shmalloc(sizeof(struct restore_stats));
 	return rstats ? 0 : -1;
 }
+
+static struct progress *get_progress(void)
+{
+	if (dstats != NULL)
+		return &dstats->progress;
+	if (rstats != NULL)
+		return &rstats->progress;
+
+	return NULL;
+}
+
+void stats_set_phase(int phase)
+{
+	struct progress *p = get_progress();
+
+	if (p)
+		p->phase = phase;
+}
+
+void stats_set_tasks(unsigned int nr)
+{
+	struct progress *p = get_progress();
+
+	if (p)
+		p->nr_tasks = nr;
+}
+
+/*
+ * Progress server.
+ *
+ * With --progress-socket a child process listens on the given unix
+ * socket and writes a "key: value" text snapshot of the stats above
+ * to every connection, then closes it. The page transfer rate is
+ * measured between two consecutive snapshots (or since the start
+ * for the first one).
+ */
+
+static const char *phase_names[] = {
+	[PHASE_STARTING]	= "starting",
+	[PHASE_FREEZING]	= "freezing",
+	[PHASE_COLLECTING]	= "collecting",
+	[PHASE_DUMPING]		= "dumping",
+	[PHASE_DUMPING_GLOBAL]	= "dumping-global",
+	[PHASE_WRITING_PAGES]	= "writing-pages",
+	[PHASE_FORKING]		= "forking",
+	[PHASE_RESTORING]	= "restoring",
+};
+
+static pid_t progress_pid = -1;
+
+static unsigned long usec_since(struct timeval *from)
+{
+	struct timeval now, d = { };
+
+	gettimeofday(&now, NULL);
+	timeval_accumulate(from, &now, &d);
+	return d.tv_sec * USEC_PER_SEC + d.tv_usec;
+}
+
+static int progress_snapshot(char *buf, size_t size, struct timeval *start,
+		struct timeval *last, unsigned long *last_pages)
+{
+	struct progress *p = get_progress();
+	unsigned long pages, usec;
+	int len;
+
+	len = snprintf(buf, size, "phase: %s\nelapsed_usec: %lu\n",
+			phase_names[p->phase], usec_since(start));
+
+	if (dstats != NULL) {
+		pages = atomic_read(&dstats->xfer_pages);
+		usec = usec_since(last);
+
+		len += snprintf(buf + len, size - len,
+				"tasks_done: %lu\n"
+				"tasks_total: %u\n"
+				"pages_scanned: %lu\n"
+				"pages_skipped_parent: %lu\n"
+				"pages_written: %lu\n"
+				"pages_xfered: %lu\n"
+				"xfer_bytes_per_sec: %lu\n",
+				dstats->counts[CNT_TASKS_DUMPED], p->nr_tasks,
+				dstats->counts[CNT_PAGES_SCANNED],
+				dstats->counts[CNT_PAGES_SKIPPED_PARENT],
+				dstats->counts[CNT_PAGES_WRITTEN], pages,
+				usec ? (pages - *last_pages) * PAGE_SIZE * USEC_PER_SEC / usec : 0);
+
+		gettimeofday(last, NULL);
+		*last_pages = pages;
+	} else
+		len += snprintf(buf + len, size - len,
+				"tasks_done: %d\n"
+				"tasks_total: %u\n"
+				"pages_compared: %d\n"
+				"pages_skipped_cow: %d\n",
+				atomic_read(&rstats->counts[CNT_TASKS_RESTORED]), p->nr_tasks,
+				atomic_read(&rstats->counts[CNT_PAGES_COMPARED]),
+				atomic_read(&rstats->counts[CNT_PAGES_SKIPPED_COW]));
+
+	if (len >= size)
+		len = size - 1;
+
+	return len;
+}
+
+static void progress_serve(int sk)
+{
+	struct timeval start, last;
+	unsigned long last_pages = 0;
+	char buf[1024];
+
+	gettimeofday(&start, NULL);
+	last = start;
+
+	while (1) {
+		int c, len;
+
+		c = accept(sk, NULL, NULL);
+		if (c < 0) {
+			if (errno == EINTR)
+				continue;
+			pr_perror("Can't accept progress connection");
+			_exit(1);
+		}
+
+		len = progress_snapshot(buf, sizeof(buf), &start, &last, &last_pages);
+		if (write(c, buf, len) != len)
+			pr_warn("Can't write progress: %m\n");
+		close(c);
+	}
+}
+
+int progress_start(void)
+{
+	struct sockaddr_un addr;
+	int sk;
+
+	if (!opts.progress_socket)
+		return 0;
+
+	addr.sun_family = AF_UNIX;
+	if (strlen(opts.progress_socket) >= sizeof(addr.sun_path)) {
+		pr_err("Progress socket path %s is too long\n", opts.progress_socket);
+		return -1;
+	}
+	strcpy(addr.sun_path, opts.progress_socket);
+
+	sk = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (sk < 0) {
+		pr_perror("Can't create progress socket");
+		return -1;
+	}
+
+	unlink(addr.sun_path);
+	if (bind(sk, (struct sockaddr *)&addr, sizeof(addr)) || listen(sk, 16)) {
+		pr_perror("Can't bind progress socket %s", addr.sun_path);
+		close(sk);
+		return -1;
+	}
+
+	progress_pid = fork();
+	if (progress_pid == 0) {
+		prctl(PR_SET_PDEATHSIG, SIGKILL);
+		progress_serve(sk);
+	}
+
+	close(sk);
+	if (progress_pid < 0) {
+		pr_perror("Can't fork progress server");
+		unlink(addr.sun_path);
+		return -1;
+	}
+
+	pr_info("Progress is reported on %s by %d\n", addr.sun_path, progress_pid);
+	return 0;
+}
+
+pid_t progress_server_pid(void)
+{
+	return progress_pid;
+}
+
+void progress_stop(void)
+{
+	if (progress_pid <= 0)
+		return;
+
+	kill(progress_pid, SIGKILL);
+	waitpid(progress_pid, NULL, 0);
+	progress_pid = -1;
+
+	unlink(opts.progress_socket);
+}
@@ -170,6 +170,9 @@ EXCLUDE_PATTERN=""
 CLEANUP=0
 PAGE_SERVER=0
 PS_PORT=12345
+LAZY_PAGES=0
+PRE_DUMP_ITERS=""
+DUMP_OPTS=""
 COMPILE_ONLY=0
 BATCH_TEST=0
 SPECIFIED_NAME_USED=0
@@ -454,6 +457,9 @@ EOF
 	for i in `seq $ITERATIONS`; do
 		local dump_only=
 		local postdump=
+		local predumpopt=
+		local rstopt=
+		local lp_pid=
 		ddump=`readlink -fm dump/$tname/$PID/$i`
 		DUMP_PATH=$ddump
 		echo Dump $PID
@@ -485,12 +491,19 @@ EOF
 		save_fds $PID  $ddump/dump.fd
 		save_maps $PID  $ddump/dump.maps
 
+		if [ -n "$PRE_DUMP_ITERS" ]; then
+			rm -rf $ddump/pre && mkdir -p $ddump/pre
+			setsid $CRIU_CPT pre-dump $DUMP_OPTS --pre-dump-iters $PRE_DUMP_ITERS \
+				-D $ddump/pre -o pre-dump.log -v4 -t $PID $args || return 1
+			predumpopt="--track-mem --prev-images-dir=pre/last"
+		fi
+
 		if [ -n "$PIDNS" ]; then
 			nsenter -n -t $PID -- iptables -I INPUT -j DROP || return 2
 		fi
 
-		setsid $CRIU_CPT dump $opts --file-locks --tcp-established $linkremap \
-			-x --evasive-devices -D $ddump -o dump.log -v4 -t $PID $args $ARGS $snapopt $postdump
+		setsid $CRIU_CPT dump $opts $DUMP_OPTS --file-locks --tcp-established $linkremap \
+			-x --evasive-devices -D $ddump -o dump.log -v4 -t $PID $args $ARGS $snapopt $predumpopt $postdump
 		retcode=$?
 
 		#
@@ -547,8 +560,30 @@ EOF
 				done
 			done
 
+			if [ $LAZY_PAGES -eq 1 ]; then
+				rm -f $ddump/lazy-pages.socket
+				$CRIU lazy-pages -D $ddump -o lazy-pages.log -v4 &
+				lp_pid=$!
+				while [ ! -S $ddump/lazy-pages.socket ]; do
+					kill -0 $lp_pid > /dev/null 2>&1 || return 2
+					sleep 0.1
+				done
+				rstopt="--lazy-pages"
+			fi
+
 			echo Restore
-			setsid $CRIU restore --file-locks --tcp-established -x -D $ddump -o restore.log -v4 -d $args || return 2
+			setsid $CRIU restore $rstopt --file-locks --tcp-established -x -D $ddump -o restore.log -v4 -d $args || {
+				[ -n "$lp_pid" ] && kill $lp_pid
+				return 2
+			}
+
+			# The daemon exits once all the pages are in place
+			if [ -n "$lp_pid" ]; then
+				wait $lp_pid || {
+					echo "lazy-pages daemon failed"
+					return 2
+				}
+			fi
 
 			[ -n "$PIDNS" ] && PID=`cat $TPID`
 			for i in `seq 5`; do
@@ -668,6 +703,10 @@ Options:
 	-d : Dump a test process and check that this process can continue working.
 	-i : Number of ITERATIONS of dump/restore
 	-p : Test page server
+	-L : Restore with lazy pages daemon
+	-Z : Compress pages images
+	-P <NUM> : Do NUM iterations of pre-dump before dump
+	-A : Put images into archive
 	-C : Delete dump files if a test completed successfully
 	-b <commit> : Check backward compatibility
 	-x <PATTERN>: Exclude pattern
@@ -710,6 +749,23 @@ while :; do
 		shift
 		PAGE_SERVER=1
 		;;
+	  -L)
+		shift
+		LAZY_PAGES=1
+		;;
+	  -Z)
+		shift
+		DUMP_OPTS="$DUMP_OPTS --compress"
+		;;
+	  -P)
+		shift
+		PRE_DUMP_ITERS=$1
+		shift
+		;;
+	  -A)
+		shift
+		DUMP_OPTS="$DUMP_OPTS --archive"
+		;;
 	  -C)
 		shift
 		CLEANUP=1
@@ -778,6 +834,11 @@ if [ $# -gt 1 ]; then
 	exit 1
 fi
 
+if [ -n "$PRE_DUMP_ITERS" ] && [ -n "$SNAPSHOT" ]; then
+	echo "-P and -s can't be used together" 1>&2
+	exit 1
+fi
+
 if [ $COMPILE_ONLY -eq 0 ]; then
 	check_criu || exit 1
 fi
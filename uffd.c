@@ -0,0 +1,941 @@
+#include <unistd.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/uio.h>
+#include <sys/ioctl.h>
+#include <sys/epoll.h>
+#include <signal.h>
+
+#include "cr_options.h"
+#include "servicefd.h"
+#include "image.h"
+#include "util.h"
+#include "util-pie.h"
+#include "vma.h"
+#include "page-read.h"
+#include "uffd.h"
+
+#undef	LOG_PREFIX
+#define LOG_PREFIX "lazy-pages: "
+
+/*
+ * Pages are read from images and copied into tasks
+ * in chunks of this size, both on faults and while
+ * prefetching.
+ */
+#define LAZY_BUF_PAGES		64
+#define LAZY_BUF_SIZE		(LAZY_BUF_PAGES * PAGE_SIZE)
+
+#define LAZY_EPOLL_EVENTS	16
+
+/*
+ * A lazy VMA piece. The addresses are the ones from the images,
+ * the task may have mremap()-ed the piece elsewhere since then.
+ */
+struct lazy_range {
+	unsigned long		start;
+	unsigned long		end;
+	long			delta;		/* task address minus image one */
+};
+
+struct lazy_pages_info {
+	struct list_head	l;
+
+	int			pid;		/* images to read pages from */
+	int			real_pid;	/* as seen by daemon, for kill */
+	int			sk;		/* connection from restore */
+	int			uffd;
+	bool			exited;
+
+	struct lazy_range	*ranges;	/* sorted by image address */
+	unsigned int		nr_ranges;
+
+	struct iovec		*iovs;		/* pagemap index, sorted */
+	unsigned int		nr_iovs;
+
+	/*
+	 * Two readers, so that random faults don't
+	 * rewind the sequential prefetch one.
+	 */
+	struct page_read	pr;
+	struct page_read	ppr;
+
+	unsigned int		pf_iov;
+	unsigned int		pf_range;
+	unsigned long		pf_addr;
+};
+
+static LIST_HEAD(lpis);
+static void *lazy_buf;
+
+static int connect_lazy_pages(void)
+{
+	struct sockaddr_un addr;
+	int sk;
+
+	sk = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (sk < 0) {
+		pr_perror("Can't create lazy pages socket");
+		return -1;
+	}
+
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, LAZY_PAGES_SOCK_NAME);
+
+	if (connect(sk, (struct sockaddr *)&addr, sizeof(addr))) {
+		pr_perror("Can't connect to lazy pages daemon");
+		close(sk);
+		return -1;
+	}
+
+	return sk;
+}
+
+int lazy_pages_connect(int pid, struct list_head *vmas)
+{
+	struct lazy_pages_hdr hdr = { .pid = pid, };
+	struct vma_area *vma;
+	int sk;
+
+	list_for_each_entry(vma, vmas, list)
+		if (vma_area_is(vma, VMA_AREA_LAZY))
+			hdr.nr_ranges++;
+
+	pr_info("Task %d has %u lazy VMAs\n", pid, hdr.nr_ranges);
+
+	sk = connect_lazy_pages();
+	if (sk < 0)
+		return -1;
+
+	if (write_img(sk, &hdr))
+		goto err;
+
+	list_for_each_entry(vma, vmas, list) {
+		struct lazy_pages_range r;
+
+		if (!vma_area_is(vma, VMA_AREA_LAZY))
+			continue;
+
+		r.start = vma->vma.start;
+		r.end = vma->vma.end;
+		if (write_img(sk, &r))
+			goto err;
+	}
+
+	return sk;
+
+err:
+	close(sk);
+	return -1;
+}
+
+int lazy_pages_restore_done(void)
+{
+	struct lazy_pages_hdr hdr = { };
+	int sk, ret;
+
+	sk = connect_lazy_pages();
+	if (sk < 0)
+		return -1;
+
+	ret = write_img(sk, &hdr);
+	close(sk);
+
+	return ret;
+}
+
+static void put_page_read(struct page_read *pr)
+{
+	if (pr->pe)
+		pr->put_pagemap(pr);
+	pr->close(pr);
+}
+
+static void free_lazy_pages_info(struct lazy_pages_info *lpi)
+{
+	list_del(&lpi->l);
+
+	if (lpi->uffd >= 0) {
+		put_page_read(&lpi->pr);
+		put_page_read(&lpi->ppr);
+		close(lpi->uffd);
+	}
+
+	close_safe(&lpi->sk);
+	xfree(lpi->iovs);
+	xfree(lpi->ranges);
+	xfree(lpi);
+}
+
+/*
+ * Read all the pagemap entries once, so that a fault
+ * can tell a page from the image from a zero one.
+ */
+static int collect_pagemap_index(struct lazy_pages_info *lpi)
+{
+	struct page_read pr;
+	unsigned int size = 0;
+	int ret;
+
+	if (open_page_read(lpi->pid, &pr))
+		return -1;
+
+	if (!pr.put_pagemap) {
+		pr_err("%d: Lazy pages need pagemap images\n", lpi->pid);
+		pr.close(&pr);
+		return -1;
+	}
+
+	while (1) {
+		struct iovec iov;
+
+		ret = pr.get_pagemap(&pr, &iov);
+		if (ret <= 0)
+			break;
+
+		pr.put_pagemap(&pr);
+
+		if (lpi->nr_iovs == size) {
+			size = size ? size * 2 : 64;
+			if (xrealloc_safe(&lpi->iovs, size * sizeof(*lpi->iovs))) {
+				ret = -1;
+				break;
+			}
+		}
+
+		lpi->iovs[lpi->nr_iovs++] = iov;
+	}
+
+	pr.close(&pr);
+
+	pr_debug("%d: %u pagemap entries\n", lpi->pid, lpi->nr_iovs);
+	return ret;
+}
+
+static int accept_lazy_task(int lsk, int epfd, bool *done)
+{
+	struct lazy_pages_info *lpi;
+	struct lazy_pages_hdr hdr;
+	struct epoll_event ev;
+	struct ucred ucred;
+	socklen_t len = sizeof(ucred);
+	unsigned int i;
+	int sk;
+
+	sk = accept(lsk, NULL, NULL);
+	if (sk < 0) {
+		pr_perror("Can't accept lazy pages connection");
+		return -1;
+	}
+
+	if (read_img(sk, &hdr) < 0)
+		goto err_sk;
+
+	if (hdr.pid == 0) {
+		pr_info("Restore is over, no more tasks will come\n");
+		*done = true;
+		close(sk);
+		return 0;
+	}
+
+	/*
+	 * The connection comes from the task itself, so its creds
+	 * tell the pid in our namespace, the hdr one is virtual.
+	 */
+	if (getsockopt(sk, SOL_SOCKET, SO_PEERCRED, &ucred, &len)) {
+		pr_perror("Can't get lazy pages peer credentials");
+		goto err_sk;
+	}
+
+	lpi = xzalloc(sizeof(*lpi));
+	if (!lpi)
+		goto err_sk;
+
+	lpi->pid = hdr.pid;
+	lpi->real_pid = ucred.pid;
+	lpi->sk = sk;
+	lpi->uffd = -1;
+	list_add_tail(&lpi->l, &lpis);
+
+	if (!hdr.nr_ranges) {
+		pr_err("%d: No lazy VMAs\n", lpi->pid);
+		goto err;
+	}
+
+	lpi->ranges = xmalloc(hdr.nr_ranges * sizeof(*lpi->ranges));
+	if (!lpi->ranges)
+		goto err;
+
+	for (i = 0; i < hdr.nr_ranges; i++) {
+		struct lazy_pages_range r;
+
+		if (read_img(sk, &r) < 0)
+			goto err;
+
+		lpi->ranges[i].start = r.start;
+		lpi->ranges[i].end = r.end;
+		lpi->ranges[i].delta = 0;
+	}
+
+	lpi->nr_ranges = hdr.nr_ranges;
+	if (collect_pagemap_index(lpi))
+		goto err;
+
+	ev.events = EPOLLIN;
+	ev.data.ptr = lpi;
+	if (epoll_ctl(epfd, EPOLL_CTL_ADD, sk, &ev)) {
+		pr_perror("Can't add lazy pages socket to epoll");
+		goto err;
+	}
+
+	pr_info("%d: %u lazy VMAs registered\n", lpi->pid, lpi->nr_ranges);
+	return 0;
+
+err:
+	free_lazy_pages_info(lpi);
+	return -1;
+err_sk:
+	close(sk);
+	return -1;
+}
+
+static int attach_uffd(struct lazy_pages_info *lpi, int uffd, int epfd)
+{
+	struct epoll_event ev;
+
+	if (fcntl(uffd, F_SETFL, O_NONBLOCK)) {
+		pr_perror("Can't make userfaultfd non-blocking");
+		close(uffd);
+		return -1;
+	}
+
+	if (open_page_read(lpi->pid, &lpi->pr)) {
+		close(uffd);
+		return -1;
+	}
+
+	if (open_page_read(lpi->pid, &lpi->ppr)) {
+		put_page_read(&lpi->pr);
+		close(uffd);
+		return -1;
+	}
+
+	lpi->uffd = uffd;
+
+	ev.events = EPOLLIN;
+	ev.data.ptr = lpi;
+	if (epoll_ctl(epfd, EPOLL_CTL_ADD, uffd, &ev)) {
+		pr_perror("Can't add userfaultfd to epoll");
+		return -1;
+	}
+
+	return 0;
+}
+
+static int receive_uffd(struct lazy_pages_info *lpi, int epfd)
+{
+	int uffd;
+
+	uffd = recv_fd(lpi->sk);
+	epoll_ctl(epfd, EPOLL_CTL_DEL, lpi->sk, NULL);
+	close_safe(&lpi->sk);
+
+	if (uffd < 0) {
+		/* The restore of this task has failed */
+		pr_err("%d: No userfaultfd received\n", lpi->pid);
+		return -1;
+	}
+
+	if (attach_uffd(lpi, uffd, epfd))
+		return -1;
+
+	pr_info("%d: Got userfaultfd\n", lpi->pid);
+	return 0;
+}
+
+/*
+ * The task has exited (or exec-ed), there's nobody to copy pages to
+ * and nobody to kill, the pid may already belong to someone else.
+ */
+static void lazy_task_gone(struct lazy_pages_info *lpi)
+{
+	pr_info("%d: Task is gone\n", lpi->pid);
+	lpi->exited = true;
+}
+
+/*
+ * Returns 1 if the range is not there any longer (the task has
+ * unmapped it, the event about it is on its way).
+ */
+static int uffd_copy(struct lazy_pages_info *lpi, unsigned long addr,
+		void *buf, unsigned long len)
+{
+	while (len) {
+		struct uffdio_copy uc = {
+			.dst = addr,
+			.src = (unsigned long)buf,
+			.len = len,
+			.mode = 0,
+		};
+		unsigned long done;
+
+		if (!ioctl(lpi->uffd, UFFDIO_COPY, &uc))
+			break;
+
+		done = uc.copy > 0 ? uc.copy : 0;
+		if (errno == EEXIST) {
+			/*
+			 * Somebody (a fault or a prefetch) has populated the
+			 * page already, skip one and go on with the rest.
+			 */
+			done += PAGE_SIZE;
+		} else if (errno == ENOENT) {
+			pr_debug("%d: Range at %lx is gone\n", lpi->pid, addr);
+			return 1;
+		} else if (errno == ESRCH) {
+			lazy_task_gone(lpi);
+			return 0;
+		} else if (errno != EAGAIN) {
+			/*
+			 * EAGAIN means the mm is changing under us (the task
+			 * forks or mremaps), just retry what's not copied.
+			 */
+			pr_perror("%d: Can't copy %lu bytes at %lx", lpi->pid, len, addr);
+			return -1;
+		}
+
+		if (done >= len)
+			break;
+
+		addr += done;
+		buf += done;
+		len -= done;
+	}
+
+	return 0;
+}
+
+static int uffd_zero(struct lazy_pages_info *lpi, unsigned long addr)
+{
+	struct uffdio_zeropage uz = {
+		.range.start = addr,
+		.range.len = PAGE_SIZE,
+		.mode = 0,
+	};
+
+	while (ioctl(lpi->uffd, UFFDIO_ZEROPAGE, &uz)) {
+		if (errno == EEXIST || errno == ENOENT)
+			break;
+		if (errno == ESRCH) {
+			lazy_task_gone(lpi);
+			break;
+		}
+		if (errno != EAGAIN) {
+			pr_perror("%d: Can't zero page at %lx", lpi->pid, addr);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static int read_lazy_pages(struct lazy_pages_info *lpi, struct page_read *pr,
+		unsigned long addr, int nr)
+{
+	/* page_read can only walk forward */
+	if (pr->pe && addr < pr->cvaddr) {
+		pr_debug("%d: Rewind page read for %lx\n", lpi->pid, addr);
+		put_page_read(pr);
+		if (open_page_read(lpi->pid, pr))
+			return -1;
+	}
+
+	if (seek_pagemap_page(pr, addr, true))
+		return -1;
+
+	return pr->read_pages(pr, addr, nr, lazy_buf);
+}
+
+static struct iovec *find_pagemap_iov(struct lazy_pages_info *lpi, unsigned long addr)
+{
+	unsigned int lo = 0, hi = lpi->nr_iovs;
+
+	while (lo < hi) {
+		unsigned int mid = (lo + hi) / 2;
+		struct iovec *iov = &lpi->iovs[mid];
+
+		if (addr < (unsigned long)iov->iov_base)
+			hi = mid;
+		else if (addr >= (unsigned long)iov->iov_base + iov->iov_len)
+			lo = mid + 1;
+		else
+			return iov;
+	}
+
+	return NULL;
+}
+
+static struct lazy_range *find_lazy_range(struct lazy_pages_info *lpi, unsigned long addr)
+{
+	unsigned int i;
+
+	/* Ranges are sorted by image addresses, not by the task ones */
+	for (i = 0; i < lpi->nr_ranges; i++) {
+		struct lazy_range *r = &lpi->ranges[i];
+
+		if (addr >= r->start + r->delta && addr < r->end + r->delta)
+			return r;
+	}
+
+	return NULL;
+}
+
+static int handle_page_fault(struct lazy_pages_info *lpi, unsigned long addr)
+{
+	struct lazy_range *r;
+	unsigned long img;
+
+	addr &= ~((unsigned long)PAGE_SIZE - 1);
+
+	pr_debug("%d: Fault at %lx\n", lpi->pid, addr);
+
+	/* Removed by madvise() or not from images at all */
+	r = find_lazy_range(lpi, addr);
+	if (!r)
+		return uffd_zero(lpi, addr);
+
+	img = addr - r->delta;
+	if (!find_pagemap_iov(lpi, img))
+		return uffd_zero(lpi, addr);
+
+	if (read_lazy_pages(lpi, &lpi->pr, img, 1) < 0)
+		return -1;
+
+	if (lpi->pr.pe->zero)
+		return uffd_zero(lpi, addr);
+
+	return uffd_copy(lpi, addr, lazy_buf, PAGE_SIZE) < 0 ? -1 : 0;
+}
+
+/*
+ * Cut the [start, end) of the task addresses out of the ranges and
+ * either drop it or move by shift. The ranges stay sorted by image
+ * addresses, so the prefetch just re-walks them from the beginning.
+ */
+static int update_lazy_ranges(struct lazy_pages_info *lpi, unsigned long start,
+		unsigned long end, long shift, bool drop)
+{
+	struct lazy_range *rs;
+	unsigned int i, nr = 0;
+
+	if (!lpi->nr_ranges)
+		return 0;
+
+	rs = xmalloc(lpi->nr_ranges * 3 * sizeof(*rs));
+	if (!rs)
+		return -1;
+
+	for (i = 0; i < lpi->nr_ranges; i++) {
+		struct lazy_range *r = &lpi->ranges[i];
+		unsigned long ts = r->start + r->delta;
+		unsigned long te = r->end + r->delta;
+		unsigned long lo = max(ts, start);
+		unsigned long hi = min(te, end);
+
+		if (lo >= hi) {
+			rs[nr++] = *r;
+			continue;
+		}
+
+		if (ts < lo)
+			rs[nr++] = (struct lazy_range) {
+				.start = r->start,
+				.end = r->start + (lo - ts),
+				.delta = r->delta,
+			};
+
+		if (!drop)
+			rs[nr++] = (struct lazy_range) {
+				.start = r->start + (lo - ts),
+				.end = r->start + (hi - ts),
+				.delta = r->delta + shift,
+			};
+
+		if (hi < te)
+			rs[nr++] = (struct lazy_range) {
+				.start = r->start + (hi - ts),
+				.end = r->end,
+				.delta = r->delta,
+			};
+	}
+
+	xfree(lpi->ranges);
+	lpi->ranges = rs;
+	lpi->nr_ranges = nr;
+	lpi->pf_iov = 0;
+	lpi->pf_range = 0;
+
+	return 0;
+}
+
+/*
+ * The child shares the parent's images and has all the pages the
+ * parent has populated so far, so it inherits its ranges and the
+ * prefetch position. Its pid is not reported, so it can't be killed.
+ */
+static int handle_fork(struct lazy_pages_info *lpi, int uffd, int epfd)
+{
+	struct lazy_pages_info *clpi;
+
+	clpi = xzalloc(sizeof(*clpi));
+	if (!clpi) {
+		close(uffd);
+		return -1;
+	}
+
+	clpi->pid = lpi->pid;
+	clpi->sk = -1;
+	clpi->uffd = -1;
+	clpi->pf_iov = lpi->pf_iov;
+	clpi->pf_range = lpi->pf_range;
+	clpi->pf_addr = lpi->pf_addr;
+	list_add_tail(&clpi->l, &lpis);
+
+	if (lpi->nr_ranges) {
+		clpi->ranges = xmalloc(lpi->nr_ranges * sizeof(*clpi->ranges));
+		if (!clpi->ranges)
+			goto err;
+		memcpy(clpi->ranges, lpi->ranges, lpi->nr_ranges * sizeof(*clpi->ranges));
+		clpi->nr_ranges = lpi->nr_ranges;
+	}
+
+	if (lpi->nr_iovs) {
+		clpi->iovs = xmalloc(lpi->nr_iovs * sizeof(*clpi->iovs));
+		if (!clpi->iovs)
+			goto err;
+		memcpy(clpi->iovs, lpi->iovs, lpi->nr_iovs * sizeof(*clpi->iovs));
+		clpi->nr_iovs = lpi->nr_iovs;
+	}
+
+	if (attach_uffd(clpi, uffd, epfd)) {
+		uffd = -1;
+		goto err;
+	}
+
+	pr_info("%d: Forked a child with userfaultfd\n", lpi->pid);
+	return 0;
+
+err:
+	pr_err("%d: Can't serve the forked child\n", lpi->pid);
+	if (uffd >= 0)
+		close(uffd);
+	free_lazy_pages_info(clpi);
+	return -1;
+}
+
+static int handle_uffd_events(struct lazy_pages_info *lpi, int epfd)
+{
+	struct uffd_msg msg;
+	int ret;
+
+	while (1) {
+		ret = read(lpi->uffd, &msg, sizeof(msg));
+		if (ret < 0) {
+			if (errno == EAGAIN)
+				return 0;
+			pr_perror("%d: Can't read userfaultfd message", lpi->pid);
+			return -1;
+		}
+
+		if (ret != sizeof(msg)) {
+			pr_err("%d: Short userfaultfd message %d\n", lpi->pid, ret);
+			return -1;
+		}
+
+		switch (msg.event) {
+		case UFFD_EVENT_PAGEFAULT:
+			ret = handle_page_fault(lpi, msg.arg.pagefault.address);
+			break;
+		case UFFD_EVENT_FORK:
+			ret = handle_fork(lpi, msg.arg.fork.ufd, epfd);
+			break;
+		case UFFD_EVENT_REMAP:
+			pr_debug("%d: Remap %llx -> %llx (%llx)\n", lpi->pid,
+					(unsigned long long)msg.arg.remap.from,
+					(unsigned long long)msg.arg.remap.to,
+					(unsigned long long)msg.arg.remap.len);
+			ret = update_lazy_ranges(lpi, msg.arg.remap.from,
+					msg.arg.remap.from + msg.arg.remap.len,
+					msg.arg.remap.to - msg.arg.remap.from, false);
+			break;
+		case UFFD_EVENT_REMOVE:
+		case UFFD_EVENT_UNMAP:
+			pr_debug("%d: Drop %llx-%llx\n", lpi->pid,
+					(unsigned long long)msg.arg.remove.start,
+					(unsigned long long)msg.arg.remove.end);
+			ret = update_lazy_ranges(lpi, msg.arg.remove.start,
+					msg.arg.remove.end, 0, true);
+			break;
+		default:
+			pr_err("%d: Unexpected userfaultfd event %u\n", lpi->pid, msg.event);
+			ret = -1;
+			break;
+		}
+
+		if (ret)
+			return -1;
+		if (lpi->exited)
+			return 0;
+	}
+}
+
+/*
+ * Copy the next chunk of not yet faulted pages into the task.
+ * Returns 0 when there's nothing more to prefetch.
+ */
+static int prefetch_lazy_pages(struct lazy_pages_info *lpi)
+{
+	while (lpi->pf_iov < lpi->nr_iovs && lpi->pf_range < lpi->nr_ranges) {
+		struct iovec *iov = &lpi->iovs[lpi->pf_iov];
+		struct lazy_range *r = &lpi->ranges[lpi->pf_range];
+		int ret;
+		unsigned long iov_start = (unsigned long)iov->iov_base;
+		unsigned long iov_end = iov_start + iov->iov_len;
+		unsigned long start, end;
+
+		start = max(lpi->pf_addr, max(iov_start, r->start));
+		if (start >= iov_end) {
+			lpi->pf_iov++;
+			continue;
+		}
+
+		if (start >= r->end) {
+			lpi->pf_range++;
+			continue;
+		}
+
+		end = min(iov_end, r->end);
+		end = min(end, start + LAZY_BUF_SIZE);
+
+		if (read_lazy_pages(lpi, &lpi->ppr, start, (end - start) / PAGE_SIZE) < 0)
+			return -1;
+
+		ret = uffd_copy(lpi, start + r->delta, lazy_buf, end - start);
+		if (ret < 0)
+			return -1;
+
+		lpi->pf_addr = ret ? r->end : end;
+		return 1;
+	}
+
+	pr_info("%d: All pages are in place\n", lpi->pid);
+	return 0;
+}
+
+static int lazy_sk_open(void)
+{
+	struct sockaddr_un addr;
+	int sk;
+
+	sk = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (sk < 0) {
+		pr_perror("Can't create lazy pages socket");
+		return -1;
+	}
+
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, LAZY_PAGES_SOCK_NAME);
+	unlink(addr.sun_path);
+
+	if (bind(sk, (struct sockaddr *)&addr, sizeof(addr))) {
+		pr_perror("Can't bind lazy pages socket");
+		goto err;
+	}
+
+	if (listen(sk, 16)) {
+		pr_perror("Can't listen on lazy pages socket");
+		goto err;
+	}
+
+	return sk;
+
+err:
+	close(sk);
+	return -1;
+}
+
+/*
+ * Once the task is given the userfaultfd it runs on lazy VMAs, and
+ * closing the descriptor makes kernel zero-fill whatever is not yet
+ * copied. So a task we failed to serve is killed, not just dropped.
+ * This is for the daemon's own errors only, tasks that are gone are
+ * just forgotten.
+ */
+static void lazy_pages_fail(struct lazy_pages_info *lpi)
+{
+	if (lpi->real_pid > 0) {
+		pr_err("%d: Killing task %d\n", lpi->pid, lpi->real_pid);
+		if (kill(lpi->real_pid, SIGKILL))
+			pr_perror("%d: Can't kill task %d", lpi->pid, lpi->real_pid);
+	} else
+		pr_err("%d: Can't kill forked child, its memory is lost\n", lpi->pid);
+
+	free_lazy_pages_info(lpi);
+}
+
+static int lazy_pages_serve(int lsk, int epfd)
+{
+	struct epoll_event evs[LAZY_EPOLL_EVENTS];
+	struct lazy_pages_info *lpi, *n;
+	bool done = false, prefetch = false;
+	int i, nr, ret = 0;
+
+	while (!done || !list_empty(&lpis)) {
+		/*
+		 * Faults go first, the prefetch only runs when
+		 * there's nothing else to do.
+		 */
+		nr = epoll_wait(epfd, evs, LAZY_EPOLL_EVENTS, prefetch ? 0 : -1);
+		if (nr < 0) {
+			if (errno == EINTR)
+				continue;
+			pr_perror("Can't wait for lazy pages events");
+			ret = -1;
+			break;
+		}
+
+		for (i = 0; i < nr; i++) {
+			lpi = evs[i].data.ptr;
+
+			if (!lpi) {
+				if (accept_lazy_task(lsk, epfd, &done)) {
+					ret = -1;
+					goto out;
+				}
+				continue;
+			}
+
+			if (lpi->uffd < 0) {
+				if (receive_uffd(lpi, epfd)) {
+					lazy_pages_fail(lpi);
+					ret = -1;
+					continue;
+				}
+				prefetch = true;
+				continue;
+			}
+
+			if (evs[i].events & EPOLLHUP) {
+				lazy_task_gone(lpi);
+				free_lazy_pages_info(lpi);
+				continue;
+			}
+
+			if (handle_uffd_events(lpi, epfd)) {
+				lazy_pages_fail(lpi);
+				ret = -1;
+				continue;
+			}
+
+			if (lpi->exited)
+				free_lazy_pages_info(lpi);
+		}
+
+		if (nr)
+			continue;
+
+		prefetch = false;
+		list_for_each_entry_safe(lpi, n, &lpis, l) {
+			int pf;
+
+			if (lpi->uffd < 0)
+				continue;
+
+			pf = prefetch_lazy_pages(lpi);
+			if (pf >= 0 && lpi->exited) {
+				free_lazy_pages_info(lpi);
+				continue;
+			}
+
+			if (pf > 0) {
+				prefetch = true;
+				/* Round-robin between tasks */
+				list_move_tail(&lpi->l, &lpis);
+				break;
+			}
+
+			if (pf < 0) {
+				lazy_pages_fail(lpi);
+				ret = -1;
+				continue;
+			}
+
+			/*
+			 * Everything is copied, closing the userfaultfd lets
+			 * the rest of the VMAs' pages be zero-filled by kernel.
+			 */
+			free_lazy_pages_info(lpi);
+		}
+	}
+
+out:
+	/* Nobody will serve the rest of tasks after we exit */
+	if (ret)
+		list_for_each_entry_safe(lpi, n, &lpis, l)
+			lazy_pages_fail(lpi);
+
+	return ret;
+}
+
+int cr_lazy_pages(bool daemon_mode)
+{
+	int lsk, epfd, ret = -1;
+	struct epoll_event ev = { .events = EPOLLIN, .data.ptr = NULL, };
+
+	lazy_buf = xmalloc(LAZY_BUF_SIZE);
+	if (!lazy_buf)
+		return -1;
+
+	lsk = lazy_sk_open();
+	if (lsk < 0)
+		goto out_buf;
+
+	epfd = epoll_create(LAZY_EPOLL_EVENTS);
+	if (epfd < 0) {
+		pr_perror("Can't create epoll");
+		goto out_sk;
+	}
+
+	if (epoll_ctl(epfd, EPOLL_CTL_ADD, lsk, &ev)) {
+		pr_perror("Can't add lazy pages socket to epoll");
+		goto out_ep;
+	}
+
+	if (daemon_mode)
+		if (daemon(1, 0) == -1) {
+			pr_perror("Can't run in the background");
+			goto out_ep;
+		}
+
+	if (opts.pidfile) {
+		if (write_pidfile(getpid()) == -1) {
+			pr_perror("Can't write pidfile");
+			goto out_ep;
+		}
+	}
+
+	pr_info("Waiting for tasks on %s\n", LAZY_PAGES_SOCK_NAME);
+	ret = lazy_pages_serve(lsk, epfd);
+
+out_ep:
+	close(epfd);
+out_sk:
+	close(lsk);
+	unlink(LAZY_PAGES_SOCK_NAME);
+out_buf:
+	xfree(lazy_buf);
+	return ret;
+}